@@ -0,0 +1,74 @@
+// ═══════════════════════════════════════════════════════
+// ScrollNice — Background (desktop bridge)
+// Talks to the scrollnice_bridge native host. While the focused tab
+// has our content script, the desktop app sends its scrolling here
+// frame by frame (exact pixels instead of wheel notches) and each
+// frame goes to that tab. The app's active profile is kept in
+// storage as desktopProfile for the content script to follow.
+// ═══════════════════════════════════════════════════════
+
+const HOST = 'com.scrollnice.bridge';
+const RETRY_MS = 30000;   // host not installed: don't try on every tab switch
+
+let port = null;
+let lastAttempt = 0;
+let pageTab = null;       // tab the frames go to
+let pageReady = false;    // last readiness sent to the host
+
+function connect() {
+    if (port || Date.now() - lastAttempt < RETRY_MS) return;
+    lastAttempt = Date.now();
+    port = chrome.runtime.connectNative(HOST);
+    pageReady = false;
+    port.onMessage.addListener(onHostMessage);
+    port.onDisconnect.addListener(() => {
+        void chrome.runtime.lastError;   // not installed / exited: the app uses wheel events
+        port = null;
+        chrome.storage.local.remove('desktopProfile');
+    });
+}
+
+// Is the active tab one we can scroll? (Not on chrome:// pages, the
+// store, or before the content script has loaded.)
+function refreshPage() {
+    connect();
+    if (!port) return;
+    chrome.tabs.query({ active: true, lastFocusedWindow: true }, (tabs) => {
+        const tab = tabs[0];
+        if (!tab) { setPage(null); return; }
+        chrome.tabs.sendMessage(tab.id, { type: 'PING' }, (reply) => {
+            void chrome.runtime.lastError;
+            setPage(reply && reply.ok ? tab.id : null);
+        });
+    });
+}
+
+function setPage(tabId) {
+    pageTab = tabId;
+    const ready = tabId !== null;
+    if (port && ready !== pageReady) {
+        pageReady = ready;
+        port.postMessage({ type: 'page', ready });
+    }
+}
+
+function onHostMessage(msg) {
+    if (msg.type === 'scroll') {
+        if (pageTab === null) return;
+        chrome.tabs.sendMessage(pageTab, { type: 'DESKTOP_SCROLL', dy: msg.dy, dt: msg.dt },
+            () => void chrome.runtime.lastError);
+    } else if (msg.type === 'profile') {
+        chrome.storage.local.set({ desktopProfile: msg });
+    } else if (msg.type === 'status' && !msg.connected) {
+        chrome.storage.local.remove('desktopProfile');
+    }
+}
+
+chrome.tabs.onActivated.addListener(refreshPage);
+chrome.tabs.onUpdated.addListener((tabId, info) => {
+    if (info.status === 'complete') refreshPage();
+});
+chrome.windows.onFocusChanged.addListener(refreshPage);
+chrome.runtime.onStartup.addListener(refreshPage);
+chrome.runtime.onInstalled.addListener(refreshPage);
+refreshPage();
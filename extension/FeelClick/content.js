@@ -51,12 +51,22 @@ function playClickSound() {
 // ─── Init ───
 chrome.storage.local.get(null, (result) => {
     settings = { ...settings, ...result };
+    if (result.desktopProfile) followDesktopProfile(result.desktopProfile);
     if (settings.enabled) createZone();
 });
 
-chrome.runtime.onMessage.addListener((message) => {
-    if (message.type === 'UPDATE_SETTINGS') {
+chrome.runtime.onMessage.addListener((message, sender, sendResponse) => {
+    if (message.type === 'PING') {
+        sendResponse({ ok: true });
+    } else if (message.type === 'DESKTOP_SCROLL') {
+        desktopScroll(message.dy, message.dt);
+    } else if (message.type === 'UPDATE_SETTINGS') {
         settings = { ...settings, ...message.payload };
+        if (ownSettings) {
+            for (const k of Object.keys(ownSettings)) {
+                if (k in message.payload) ownSettings[k] = message.payload[k];
+            }
+        }
         if (settings.enabled) {
             if (!document.getElementById('scrollnice-zone')) createZone();
             else updateZoneUI();
@@ -68,6 +78,67 @@ chrome.runtime.onMessage.addListener((message) => {
     }
 });
 
+chrome.storage.onChanged.addListener((changes, area) => {
+    if (area !== 'local' || !changes.desktopProfile) return;
+    followDesktopProfile(changes.desktopProfile.newValue);
+    updateZoneUI();
+});
+
+// ─── Desktop bridge (background.js) ───
+// While the desktop app is linked, its active profile sets the mode and
+// click amount here too; our own values come back when it goes away.
+const DESKTOP_MODES = { click_hold: '1', split_hold: '2', hover_auto: '3' };
+let ownSettings = null;
+
+function followDesktopProfile(profile) {
+    if (profile) {
+        if (!ownSettings) ownSettings = { mode: settings.mode, scrollAmount: settings.scrollAmount };
+        settings.mode = DESKTOP_MODES[profile.mode] || settings.mode;
+        if (profile.scroll_amount > 0) settings.scrollAmount = profile.scroll_amount;
+    } else if (ownSettings) {
+        Object.assign(settings, ownSettings);
+        ownSettings = null;
+    }
+}
+
+// One call per desktop frame: dy px (+ up) over dt seconds, or a
+// one-shot click when dt is 0. Sub-pixel remainders carry over so the
+// page moves exactly as far as the engine did.
+let desktopTarget = null;
+let desktopCarry = 0;
+let desktopLast = 0;
+
+function desktopScroll(dy, dt) {
+    const now = performance.now();
+    if (!desktopTarget || now - desktopLast > 250) {
+        desktopTarget = findScrollTarget();
+        desktopCarry = 0;
+    }
+    desktopLast = now;
+    if (dt === 0) {
+        desktopTarget.scrollBy({ top: -dy, behavior: 'smooth' });
+        return;
+    }
+    desktopCarry -= dy;
+    const whole = Math.trunc(desktopCarry);
+    if (whole === 0) return;
+    desktopCarry -= whole;
+    desktopTarget.scrollBy({ top: whole, behavior: 'instant' });
+}
+
+// The document if it scrolls, else the scroll container in the middle
+// of the viewport (web apps that scroll an inner pane)
+function findScrollTarget() {
+    const root = document.scrollingElement || document.documentElement;
+    if (root.scrollHeight > root.clientHeight) return root;
+    let node = document.elementFromPoint(window.innerWidth / 2, window.innerHeight / 2);
+    for (; node && node !== document.body; node = node.parentElement) {
+        const overflow = getComputedStyle(node).overflowY;
+        if ((overflow === 'auto' || overflow === 'scroll') && node.scrollHeight > node.clientHeight) return node;
+    }
+    return root;
+}
+
 // ─── Create Zone ───
 function createZone() {
     if (document.getElementById('scrollnice-zone')) return;
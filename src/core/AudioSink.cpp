@@ -0,0 +1,123 @@
+#include "AudioSink.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace sn {
+
+namespace {
+
+// ─────── Null ───────
+// Period deadlines come off steady_clock; a late period is not made
+// up for, the same as a device that underran.
+class NullAudioSink : public AudioSink {
+public:
+    NullAudioSink(int sampleRate, size_t periodFrames)
+        : sampleRate_(sampleRate), periodFrames_(periodFrames ? periodFrames : 1) {}
+
+    bool Open(AudioFormat& format) override {
+        format.sampleRate = sampleRate_;
+        format.channels   = 2;
+        channels_         = format.channels;
+        buffer_.assign(periodFrames_ * channels_, 0.0f);
+        period_ = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>((double)periodFrames_ / sampleRate_));
+        Resume();
+        return true;
+    }
+
+    void Close() override {}
+
+    float* Acquire(size_t& frames) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wake_.wait_until(lock, deadline_, [&] { return interrupted_; })) return nullptr;
+        const auto now = Clock::now();
+        deadline_ = now - deadline_ > period_ ? now + period_ : deadline_ + period_;
+        frames = periodFrames_;
+        return buffer_.data();
+    }
+
+    void Commit(size_t frames) override { Written(buffer_.data(), frames * channels_); }
+
+    double QueuedSeconds() const override { return 0.0; }
+
+    void Resume() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deadline_ = Clock::now() + period_;
+    }
+
+    void Interrupt() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        interrupted_ = true;
+        wake_.notify_all();
+    }
+
+protected:
+    virtual void Written(const float*, size_t) {}
+
+    int channels_ = 2;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const int          sampleRate_;
+    const size_t       periodFrames_;
+    std::vector<float> buffer_;
+    Clock::duration    period_{};
+    Clock::time_point  deadline_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    bool                    interrupted_ = false;
+};
+
+// ─────── WAV file ───────
+class WavFileAudioSink : public NullAudioSink {
+public:
+    WavFileAudioSink(const std::string& path, int sampleRate, size_t periodFrames)
+        : NullAudioSink(sampleRate, periodFrames), path_(path), sampleRate_(sampleRate) {}
+
+    void Close() override {
+        std::ofstream f(path_, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) return;
+        const uint32_t dataBytes = (uint32_t)(samples_.size() * sizeof(float));
+        auto put16 = [&](uint16_t v) { f.write(reinterpret_cast<const char*>(&v), 2); };
+        auto put32 = [&](uint32_t v) { f.write(reinterpret_cast<const char*>(&v), 4); };
+        f.write("RIFF", 4); put32(36 + dataBytes); f.write("WAVE", 4);
+        f.write("fmt ", 4); put32(16);
+        put16(3);   // IEEE float
+        put16((uint16_t)channels_);
+        put32((uint32_t)sampleRate_);
+        put32((uint32_t)(sampleRate_ * channels_ * sizeof(float)));
+        put16((uint16_t)(channels_ * sizeof(float)));
+        put16(32);
+        f.write("data", 4); put32(dataBytes);
+        f.write(reinterpret_cast<const char*>(samples_.data()), dataBytes);
+    }
+
+protected:
+    void Written(const float* samples, size_t count) override {
+        samples_.insert(samples_.end(), samples, samples + count);
+    }
+
+private:
+    std::string        path_;
+    int                sampleRate_;
+    std::vector<float> samples_;
+};
+
+} // namespace
+
+std::unique_ptr<AudioSink> CreateNullAudioSink(int sampleRate, size_t periodFrames) {
+    return std::make_unique<NullAudioSink>(sampleRate, periodFrames);
+}
+
+std::unique_ptr<AudioSink> CreateWavFileAudioSink(const std::string& path, int sampleRate,
+                                                  size_t periodFrames) {
+    return std::make_unique<WavFileAudioSink>(path, sampleRate, periodFrames);
+}
+
+} // namespace sn
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// AudioSink — where SoundEngine's mixer thread writes samples
+//
+// The sink owns the timing: Acquire() blocks until the device wants
+// another period and hands out a buffer of interleaved float frames,
+// which the mixer fills and gives back with Commit(). Every call except
+// Interrupt() is made on the mixer thread, Open() included, so a sink
+// can keep per-thread state (COM, thread priority) between Open() and
+// Close().
+//
+// Backends: WASAPI (platform/win/WinWasapiSink), and the null and WAV
+// file sinks below, which pace themselves off the clock so the engine
+// runs the same way without a sound card.
+// ─────────────────────────────────────────────────────────
+
+struct AudioFormat {
+    int sampleRate = 48000;
+    int channels   = 2;
+};
+
+class AudioSink {
+public:
+    virtual ~AudioSink() = default;
+
+    // Open the device and start the stream; the sink picks the format.
+    virtual bool Open(AudioFormat& format) = 0;
+    virtual void Close() = 0;
+
+    // Wait for the next period. Returns space for `frames` frames, or
+    // nullptr once interrupted or if the device went away.
+    virtual float* Acquire(size_t& frames) = 0;
+    virtual void Commit(size_t frames) = 0;
+
+    // Seconds of audio already queued ahead of the last Acquire()d
+    // buffer: how long its first frame waits before it is heard.
+    virtual double QueuedSeconds() const = 0;
+
+    // Stop and resume the stream while nothing plays (saves the
+    // device's wakeups); Acquire() is not called in between.
+    virtual void Pause() {}
+    virtual void Resume() {}
+
+    // Any thread: make a blocked (or the next) Acquire() return nullptr.
+    virtual void Interrupt() = 0;
+};
+
+// Discards everything, one `periodFrames` period at a time in real time.
+std::unique_ptr<AudioSink> CreateNullAudioSink(int sampleRate = 48000, size_t periodFrames = 96);
+
+// Like the null sink, and writes what was mixed to a 32-bit float WAV
+// file on Close().
+std::unique_ptr<AudioSink> CreateWavFileAudioSink(const std::string& path, int sampleRate = 48000,
+                                                  size_t periodFrames = 96);
+
+} // namespace sn
@@ -0,0 +1,35 @@
+#include "BuiltinPresets.h"
+#include "PresetTables.h"   // generated from presets/*.json (see CMakeLists.txt)
+
+namespace sn {
+
+BuiltinPresetTable BuiltinPresetTables() {
+    return BuiltinPresetTable{kBuiltinPresets, kBuiltinPresetCount};
+}
+
+ProfileConfig ToProfile(const BuiltinPreset& preset) {
+    ProfileConfig p;
+    p.id   = preset.id;
+    p.name = preset.name;
+    p.apps.assign(preset.apps, preset.apps + preset.appCount);
+    p.window_classes.assign(preset.windowClasses, preset.windowClasses + preset.windowClassCount);
+    p.settings.reserve(preset.settingCount);
+    for (size_t i = 0; i < preset.settingCount; i++) {
+        const BuiltinSetting& s = preset.settings[i];
+        ProfileSetting setting;
+        setting.field  = s.field;
+        setting.number = s.number;
+        if (s.text) setting.text = s.text;
+        p.settings.push_back(std::move(setting));
+    }
+    return p;
+}
+
+std::vector<ProfileConfig> BuiltinPresets() {
+    std::vector<ProfileConfig> all;
+    all.reserve(kBuiltinPresetCount);
+    for (const auto& preset : BuiltinPresetTables()) all.push_back(ToProfile(preset));
+    return all;
+}
+
+} // namespace sn
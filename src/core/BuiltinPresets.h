@@ -0,0 +1,55 @@
+#pragma once
+#include "Config.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// Built-in presets — presets/*.json compiled into the binary
+//
+// tools/preset_gen.cpp reads the JSON sources at build time through
+// the normal loader and writes them out as constexpr tables
+// (PresetTables.h in the build tree), so the built-in profiles need no
+// file lookup or parsing at startup and still exist when a portable
+// install lost its presets folder. Settings are stored by schema row
+// exactly like ProfileSetting; the generator is rebuilt, and the tables
+// regenerated, whenever the schema changes.
+//
+// `check_presets` (tools/preset_check.cpp) compares the embedded
+// tables against the JSON sources.
+// ─────────────────────────────────────────────────────────
+
+struct BuiltinSetting {
+    uint16_t    field;    // row in the schema table (ConfigSchema.h)
+    double      number;   // Int/Bool/Double value
+    const char* text;     // String value, nullptr otherwise
+};
+
+struct BuiltinPreset {
+    const char*           id;
+    const char*           name;
+    const char* const*    apps;
+    size_t                appCount;
+    const char* const*    windowClasses;
+    size_t                windowClassCount;
+    const BuiltinSetting* settings;
+    size_t                settingCount;
+};
+
+struct BuiltinPresetTable {
+    const BuiltinPreset* begin() const { return first; }
+    const BuiltinPreset* end() const { return first + count; }
+    const BuiltinPreset* first;
+    size_t               count;
+};
+
+BuiltinPresetTable BuiltinPresetTables();
+
+ProfileConfig ToProfile(const BuiltinPreset& preset);
+
+// Every built-in preset as a profile, in file-name order.
+std::vector<ProfileConfig> BuiltinPresets();
+
+} // namespace sn
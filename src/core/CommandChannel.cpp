@@ -0,0 +1,222 @@
+#include "CommandChannel.h"
+#include <cmath>
+
+namespace sn {
+
+namespace {
+
+void Put8(std::string& out, uint8_t v) { out += (char)v; }
+void Put16(std::string& out, uint16_t v) { Put8(out, (uint8_t)v); Put8(out, (uint8_t)(v >> 8)); }
+void Put32(std::string& out, uint32_t v) { Put16(out, (uint16_t)v); Put16(out, (uint16_t)(v >> 16)); }
+void PutString(std::string& out, const std::string& s) {
+    const size_t n = s.size() < 255 ? s.size() : 255;
+    Put8(out, (uint8_t)n);
+    out.append(s, 0, n);
+}
+
+std::string Frame(const std::string& body) {
+    std::string out;
+    out.reserve(4 + body.size());
+    Put32(out, (uint32_t)body.size());
+    return out + body;
+}
+
+// Bounds-checked reads off a body; any short read fails the decode
+class Reader {
+public:
+    explicit Reader(const std::string& s) : s_(s) {}
+    bool U8(uint8_t& v) {
+        if (at_ + 1 > s_.size()) return false;
+        v = (uint8_t)s_[at_++];
+        return true;
+    }
+    bool U16(uint16_t& v) {
+        uint8_t lo, hi;
+        if (!U8(lo) || !U8(hi)) return false;
+        v = (uint16_t)(lo | hi << 8);
+        return true;
+    }
+    bool U32(uint32_t& v) {
+        uint16_t lo, hi;
+        if (!U16(lo) || !U16(hi)) return false;
+        v = lo | (uint32_t)hi << 16;
+        return true;
+    }
+    bool String(std::string& v) {
+        uint8_t n;
+        if (!U8(n) || at_ + n > s_.size()) return false;
+        v.assign(s_, at_, n);
+        at_ += n;
+        return true;
+    }
+    bool Done() const { return at_ == s_.size(); }
+
+private:
+    const std::string& s_;
+    size_t             at_ = 0;
+};
+
+// The state block shared by the QueryState/Subscribe replies and the
+// feed's State event
+void PutState(std::string& out, const CommandReply& r) {
+    Put8(out, r.flags);
+    Put8(out, r.state);
+    PutString(out, r.profile);
+    PutString(out, r.mode);
+    Put16(out, r.scroll_amount);
+    Put16(out, r.continuous_speed);
+    Put16(out, r.continuous_accel);
+    Put16(out, r.hover_speed);
+}
+
+bool ReadState(Reader& in, CommandReply& r) {
+    return in.U8(r.flags) && in.U8(r.state) && in.String(r.profile) && in.String(r.mode) &&
+           in.U16(r.scroll_amount) && in.U16(r.continuous_speed) && in.U16(r.continuous_accel) &&
+           in.U16(r.hover_speed);
+}
+
+bool HasState(CommandOp op) { return op == CommandOp::QueryState || op == CommandOp::Subscribe; }
+
+uint32_t ReadLength(const std::string& s) {
+    return (uint8_t)s[0] | (uint32_t)(uint8_t)s[1] << 8 | (uint32_t)(uint8_t)s[2] << 16 |
+           (uint32_t)(uint8_t)s[3] << 24;
+}
+
+} // namespace
+
+// ───── Encoding ─────
+std::string EncodeCommand(const Command& cmd) {
+    std::string body;
+    Put8(body, (uint8_t)cmd.op);
+    switch (cmd.op) {
+    case CommandOp::ScrollBy:    Put32(body, (uint32_t)cmd.pixels); break;
+    case CommandOp::StartScroll: Put8(body, (uint8_t)cmd.direction); Put16(body, cmd.speed); break;
+    case CommandOp::SetProfile:  PutString(body, cmd.profile); break;
+    case CommandOp::Set:         Put8(body, (uint8_t)cmd.target); Put8(body, cmd.value); break;
+    case CommandOp::Subscribe:   Put32(body, cmd.pid); break;
+    case CommandOp::StopScroll:
+    case CommandOp::QueryState:  break;
+    }
+    return Frame(body);
+}
+
+std::string EncodeReply(CommandOp op, const CommandReply& reply) {
+    std::string body;
+    Put8(body, (uint8_t)reply.status);
+    if (HasState(op) && reply.status == CommandStatus::Ok) PutState(body, reply);
+    return Frame(body);
+}
+
+bool DecodeCommand(const std::string& body, Command& cmd) {
+    Reader r(body);
+    uint8_t op;
+    if (!r.U8(op)) return false;
+    cmd = Command{};
+    cmd.op = (CommandOp)op;
+    bool ok = true;
+    switch (cmd.op) {
+    case CommandOp::ScrollBy: {
+        uint32_t px = 0;
+        ok = r.U32(px) && px != 0;
+        cmd.pixels = (int32_t)px;
+        break;
+    }
+    case CommandOp::StartScroll: {
+        uint8_t dir = 0;
+        ok = r.U8(dir) && r.U16(cmd.speed) && (dir == 0x01 || dir == 0xFF);   // +1 / -1 only
+        cmd.direction = (int8_t)dir;
+        break;
+    }
+    case CommandOp::SetProfile:
+        ok = r.String(cmd.profile);
+        break;
+    case CommandOp::Set: {
+        uint8_t target = 0;
+        ok = r.U8(target) && r.U8(cmd.value) && target <= (uint8_t)CommandSwitch::WheelBlock &&
+             cmd.value <= 2;
+        cmd.target = (CommandSwitch)target;
+        break;
+    }
+    case CommandOp::Subscribe:
+        ok = r.U32(cmd.pid);
+        break;
+    case CommandOp::StopScroll:
+    case CommandOp::QueryState:
+        break;
+    default:
+        return false;
+    }
+    return ok && r.Done();
+}
+
+bool DecodeReply(CommandOp op, const std::string& body, CommandReply& reply) {
+    Reader r(body);
+    uint8_t status;
+    if (!r.U8(status) || status > (uint8_t)CommandStatus::TimedOut) return false;
+    reply = CommandReply{};
+    reply.status = (CommandStatus)status;
+    if (HasState(op) && reply.status == CommandStatus::Ok && !ReadState(r, reply)) return false;
+    return r.Done();
+}
+
+std::string EncodeFeedEvent(const FeedEvent& event) {
+    std::string body;
+    Put8(body, (uint8_t)event.kind);
+    if (event.kind == FeedEventKind::State) {
+        PutState(body, event.state);
+    } else {
+        Put32(body, (uint32_t)(int32_t)std::lround(event.dy * 1000.0));
+        Put32(body, (uint32_t)std::lround(event.dt * 1e6));
+    }
+    return Frame(body);
+}
+
+bool DecodeFeedEvent(const std::string& body, FeedEvent& event) {
+    Reader r(body);
+    uint8_t kind;
+    if (!r.U8(kind)) return false;
+    event = FeedEvent{};
+    event.kind = (FeedEventKind)kind;
+    switch (event.kind) {
+    case FeedEventKind::State:
+        if (!ReadState(r, event.state)) return false;
+        break;
+    case FeedEventKind::Scroll: {
+        uint32_t dy, dt;
+        if (!r.U32(dy) || !r.U32(dt)) return false;
+        event.dy = (int32_t)dy / 1000.0;
+        event.dt = dt / 1e6;
+        break;
+    }
+    default:
+        return false;
+    }
+    return r.Done();
+}
+
+const char* CommandStatusName(CommandStatus s) {
+    switch (s) {
+    case CommandStatus::Ok:             return "ok";
+    case CommandStatus::BadRequest:     return "bad request";
+    case CommandStatus::Rejected:       return "rejected";
+    case CommandStatus::UnknownProfile: return "unknown profile";
+    case CommandStatus::TimedOut:       return "timed out";
+    }
+    return "?";
+}
+
+// ───── Framing ─────
+bool FrameReader::Next(std::string& body) {
+    if (bad_ || buffer_.size() < 4) return false;
+    const uint32_t n = ReadLength(buffer_);
+    if (n > kMaxFrame) {
+        bad_ = true;
+        return false;
+    }
+    if (buffer_.size() < 4 + (size_t)n) return false;
+    body.assign(buffer_, 4, n);
+    buffer_.erase(0, 4 + (size_t)n);
+    return true;
+}
+
+} // namespace sn
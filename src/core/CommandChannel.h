@@ -0,0 +1,165 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace sn {
+
+// ───── Protocol ─────
+// Every message is a frame: a little-endian uint32 length, then that
+// many bytes of body (at most kMaxFrame). A request body is an opcode
+// byte and its fixed fields; a reply body is a status byte, plus the
+// state for QueryState. Strings are a length byte and UTF-8.
+//
+//   ScrollBy     i32 pixels (+ up, - down; not 0)
+//   StartScroll  i8 direction (+1 / -1, nothing else), u16 speed (0 = hover speed)
+//   StopScroll   -
+//   SetProfile   str id ("" = back to automatic switching)
+//   Set          u8 switch (CommandSwitch), u8 value (0 off, 1 on, 2 toggle)
+//   QueryState   -  → state
+//   Subscribe    u32 browser pid  → state
+//
+// where state is u8 flags (CommandStateFlag), u8 AppState, str profile,
+// str mode, then u16 scroll_amount, continuous_speed, continuous_accel,
+// hover_speed of the active profile.
+//
+// A connection carries any number of request/reply pairs, in order,
+// until a Subscribe succeeds. From then on it is a one-way feed of
+// FeedEvent frames from the app and the client sends nothing more.
+
+enum class CommandOp : uint8_t {
+    ScrollBy = 1, StartScroll, StopScroll, SetProfile, Set, QueryState, Subscribe
+};
+enum class CommandSwitch : uint8_t { Enabled, Edit, WheelBlock };
+// TimedOut: the app didn't get to the request in time and dropped it
+// (it had no effect)
+enum class CommandStatus : uint8_t { Ok, BadRequest, Rejected, UnknownProfile, TimedOut };
+
+enum CommandStateFlag : uint8_t {
+    kStateEnabled     = 1u << 0,
+    kStateEditing     = 1u << 1,
+    kStateWheelBlock  = 1u << 2,
+    kStateAutoProfile = 1u << 3,
+};
+
+struct Command {
+    CommandOp     op        = CommandOp::QueryState;
+    int32_t       pixels    = 0;                        // ScrollBy
+    int8_t        direction = 1;                        // StartScroll
+    uint16_t      speed     = 0;                        // StartScroll
+    std::string   profile;                              // SetProfile
+    CommandSwitch target    = CommandSwitch::Enabled;   // Set
+    uint8_t       value     = 2;                        // Set
+    uint32_t      pid       = 0;                        // Subscribe
+};
+
+struct CommandReply {
+    CommandStatus status = CommandStatus::Ok;
+    // QueryState, Subscribe
+    uint8_t     flags = 0;
+    uint8_t     state = 0;   // AppState
+    std::string profile;     // active profile id ("" = base config)
+    std::string mode;
+    uint16_t    scroll_amount    = 0;
+    uint16_t    continuous_speed = 0;
+    uint16_t    continuous_accel = 0;
+    uint16_t    hover_speed      = 0;
+};
+
+// ───── Scroll feed ─────
+// What a subscriber gets: the app's state whenever the active profile
+// changes, and every scroll the app routes to it (one per engine tick,
+// or one per click).
+//
+//   State   state (as in the replies above)
+//   Scroll  i32 dy in 1/1000 px (+ up), u32 dt in µs (0 = one-shot step)
+enum class FeedEventKind : uint8_t { State = 1, Scroll };
+
+struct FeedEvent {
+    FeedEventKind kind = FeedEventKind::Scroll;
+    CommandReply  state;        // State (status unused)
+    double        dy = 0.0;     // Scroll: pixels, + up
+    double        dt = 0.0;     // Scroll: seconds the delta covers; 0 = one-shot step
+};
+
+const uint32_t kMaxFrame = 1024;
+
+std::string EncodeCommand(const Command& cmd);                          // whole frame
+std::string EncodeReply(CommandOp op, const CommandReply& reply);      // whole frame
+bool DecodeCommand(const std::string& body, Command& cmd);
+bool DecodeReply(CommandOp op, const std::string& body, CommandReply& reply);
+std::string EncodeFeedEvent(const FeedEvent& event);                   // whole frame
+bool DecodeFeedEvent(const std::string& body, FeedEvent& event);
+
+const char* CommandStatusName(CommandStatus s);
+
+// Collects bytes off a stream and cuts them into frame bodies.
+class FrameReader {
+public:
+    void Append(const char* data, size_t size) { buffer_.append(data, size); }
+    // Next complete body, if any. Sets Bad() on an oversized frame: the
+    // stream can't be resynchronised, so drop the connection.
+    bool Next(std::string& body);
+    bool Bad() const { return bad_; }
+
+private:
+    std::string buffer_;
+    bool        bad_ = false;
+};
+
+// ─────────────────────────────────────────────────────────
+// CommandServer — control channel into the running instance
+//
+// Listens where only this user's processes can connect: a named pipe
+// that rejects remote clients on Windows (\\.\pipe\ScrollNice-command;
+// the default pipe DACL gives write access to the owner, SYSTEM and
+// administrators only), a 0600 Unix-domain socket on Linux
+// ($XDG_RUNTIME_DIR/scrollnice-command.sock). Up to kMaxClients
+// connections are served at once from one thread.
+//
+// The handler runs on the server thread, once per request; the app
+// hops to its UI thread from there (see main.cpp). When it accepts a
+// Subscribe, that connection joins the feed and Publish() reaches it.
+// ─────────────────────────────────────────────────────────
+class CommandServer {
+public:
+    using Handler = std::function<CommandReply(const Command&)>;
+
+    static constexpr int kMaxClients = 8;
+
+    virtual ~CommandServer() = default;
+
+    // False if the endpoint can't be created (e.g. another instance owns it).
+    virtual bool Start(Handler handler) = 0;
+    // Stop and join the server thread, dropping any clients.
+    virtual void Stop() = 0;
+    virtual std::string Endpoint() const = 0;
+
+    // Sends an EncodeFeedEvent() frame to the subscribers that gave this
+    // browser pid (0: all of them), without blocking: a subscriber that
+    // is still busy with its last frame misses this one. True if any
+    // subscriber matched. Don't call concurrently with Start/Stop.
+    virtual bool Publish(uint32_t pid, const std::string& frame) = 0;
+};
+
+// Client side of the same endpoint (the CLI, scripts).
+class CommandClient {
+public:
+    virtual ~CommandClient() = default;
+    virtual bool Connect() = 0;
+    // One request/reply round trip; false if the connection failed.
+    virtual bool Call(const Command& cmd, CommandReply& reply) = 0;
+    // Next frame body off the connection (the feed, after Subscribe);
+    // blocks until one arrives. False once the connection is gone.
+    virtual bool Receive(std::string& body) = 0;
+    // Shuts the connection down; a Call or Receive blocked on another
+    // thread returns false, and so does any later one.
+    virtual void Close() = 0;
+};
+
+// The platform implementations (defined in platform/<os>/…CommandChannel.cpp).
+std::unique_ptr<CommandServer> CreateCommandServer();
+std::unique_ptr<CommandClient> CreateCommandClient();
+
+} // namespace sn
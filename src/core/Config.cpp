@@ -1,29 +1,25 @@
 #include "Config.h"
+#include "ConfigLoader.h"
+#include "ConfigPersister.h"
 #include <fstream>
 
 namespace sn {
 
 bool ConfigStore::Load(const std::string& path) {
-    std::ifstream f(path);
-    if (!f.is_open()) { config_ = GetDefault(); return false; }
-    try {
-        nlohmann::json j;
-        f >> j;
-        config_ = j.get<AppConfig>();
-        return true;
-    } catch (...) {
-        config_ = GetDefault();
-        return false;
-    }
+    config_ = GetDefault();
+    diagnostics_.clear();
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) return false;
+    ConfigLoadResult res = LoadConfig(f, config_);
+    diagnostics_ = std::move(res.diagnostics);
+    return res.complete;
 }
 
+// Synchronous; the app saves through ConfigPersister instead.
 bool ConfigStore::Save(const std::string& path) const {
-    std::ofstream f(path);
-    if (!f.is_open()) return false;
     try {
         nlohmann::json j = config_;
-        f << j.dump(2);
-        return true;
+        return WriteFileAtomic(path, j.dump(2));
     } catch (...) { return false; }
 }
 
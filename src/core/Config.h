@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -45,16 +46,6 @@ inline void to_json(nlohmann::json& j, const ZoneConfig& z) {
          {"opacity", z.opacity}, {"color", z.color}, {"cover_image", z.cover_image},
          {"locked", z.locked}};
 }
-inline void from_json(const nlohmann::json& j, ZoneConfig& z) {
-    if (j.contains("x")) j.at("x").get_to(z.x);
-    if (j.contains("y")) j.at("y").get_to(z.y);
-    if (j.contains("width")) j.at("width").get_to(z.width);
-    if (j.contains("height")) j.at("height").get_to(z.height);
-    if (j.contains("opacity")) j.at("opacity").get_to(z.opacity);
-    if (j.contains("color")) j.at("color").get_to(z.color);
-    if (j.contains("cover_image")) j.at("cover_image").get_to(z.cover_image);
-    if (j.contains("locked")) j.at("locked").get_to(z.locked);
-}
 
 // ───── Scroll Config ─────
 struct ScrollConfig {
@@ -63,19 +54,15 @@ struct ScrollConfig {
     int continuous_speed = 8;         // base speed px/tick for hold
     int continuous_accel = 3;         // acceleration per second held
     int hover_speed = 6;              // px/tick for hover auto mode
+    int coast_ms = 0;                 // after a hold: speed decay time constant (0 = stop at once)
+    std::string backend = "wheel";    // "wheel" (wheel events) | "uia" (UI Automation ScrollPattern) | "touch" (touch pan)
 };
 
 inline void to_json(nlohmann::json& j, const ScrollConfig& s) {
     j = {{"mode", s.mode}, {"scroll_amount", s.scroll_amount},
          {"continuous_speed", s.continuous_speed}, {"continuous_accel", s.continuous_accel},
-         {"hover_speed", s.hover_speed}};
-}
-inline void from_json(const nlohmann::json& j, ScrollConfig& s) {
-    if (j.contains("mode")) j.at("mode").get_to(s.mode);
-    if (j.contains("scroll_amount")) j.at("scroll_amount").get_to(s.scroll_amount);
-    if (j.contains("continuous_speed")) j.at("continuous_speed").get_to(s.continuous_speed);
-    if (j.contains("continuous_accel")) j.at("continuous_accel").get_to(s.continuous_accel);
-    if (j.contains("hover_speed")) j.at("hover_speed").get_to(s.hover_speed);
+         {"hover_speed", s.hover_speed}, {"coast_ms", s.coast_ms},
+         {"backend", s.backend}};
 }
 
 // ───── Sound Config ─────
@@ -87,10 +74,6 @@ struct SoundConfig {
 inline void to_json(nlohmann::json& j, const SoundConfig& s) {
     j = {{"enabled", s.enabled}, {"click_sound", s.click_sound}};
 }
-inline void from_json(const nlohmann::json& j, SoundConfig& s) {
-    if (j.contains("enabled")) j.at("enabled").get_to(s.enabled);
-    if (j.contains("click_sound")) j.at("click_sound").get_to(s.click_sound);
-}
 
 // ───── Hotkey Config ─────
 struct HotkeyConfig {
@@ -103,11 +86,38 @@ inline void to_json(nlohmann::json& j, const HotkeyConfig& h) {
     j = {{"toggle_enabled", h.toggle_enabled}, {"toggle_edit", h.toggle_edit},
          {"toggle_wheel", h.toggle_wheel}};
 }
-inline void from_json(const nlohmann::json& j, HotkeyConfig& h) {
-    if (j.contains("toggle_enabled")) j.at("toggle_enabled").get_to(h.toggle_enabled);
-    if (j.contains("toggle_edit")) j.at("toggle_edit").get_to(h.toggle_edit);
-    if (j.contains("toggle_wheel")) j.at("toggle_wheel").get_to(h.toggle_wheel);
-}
+
+// ───── Profiles ─────
+// A profile overrides part of the config while a matching application
+// is in the foreground. Settings are keyed by their row in the schema
+// table (ConfigSchema.h), in table order; Int/Bool/Double values are
+// held in `number`.
+struct ProfileSetting {
+    uint16_t    field  = 0;
+    double      number = 0.0;
+    std::string text;
+
+    bool operator==(const ProfileSetting& o) const {
+        return field == o.field && number == o.number && text == o.text;
+    }
+};
+
+struct ProfileConfig {
+    std::string id;
+    std::string name;
+    std::vector<std::string> apps;            // executable names, e.g. "chrome.exe" (any case)
+    std::vector<std::string> window_classes;  // foreground window classes, e.g. "MozillaWindowClass"
+    std::vector<ProfileSetting> settings;
+
+    bool operator==(const ProfileConfig& o) const {
+        return id == o.id && name == o.name && apps == o.apps &&
+               window_classes == o.window_classes && settings == o.settings;
+    }
+    bool operator!=(const ProfileConfig& o) const { return !(*this == o); }
+};
+
+// Writes settings back as a nested "config" object (ConfigSchema.cpp).
+void to_json(nlohmann::json& j, const ProfileConfig& p);
 
 // ───── App Config (root) ─────
 struct AppConfig {
@@ -115,29 +125,41 @@ struct AppConfig {
     bool        enabled = true;
     bool        start_with_windows = false;
     bool        wheel_block = false;
+    bool        auto_profile = true;   // switch profiles with the foreground app
+    std::string language = "en";       // UI strings: locales/<language>.catalog
+    bool        metrics = false;       // serve MetricsRegistry on a local pipe/socket
     ZoneConfig  zone;
     ScrollConfig scroll;
     SoundConfig  sound;
     HotkeyConfig hotkeys;
+    std::vector<ProfileConfig> profiles;   // user profiles (built-in presets are separate)
 };
 
 inline void to_json(nlohmann::json& j, const AppConfig& c) {
     j = {{"version", c.version}, {"enabled", c.enabled},
          {"start_with_windows", c.start_with_windows}, {"wheel_block", c.wheel_block},
-         {"zone", c.zone}, {"scroll", c.scroll}, {"sound", c.sound}, {"hotkeys", c.hotkeys}};
-}
-inline void from_json(const nlohmann::json& j, AppConfig& c) {
-    if (j.contains("version")) j.at("version").get_to(c.version);
-    if (j.contains("enabled")) j.at("enabled").get_to(c.enabled);
-    if (j.contains("start_with_windows")) j.at("start_with_windows").get_to(c.start_with_windows);
-    if (j.contains("wheel_block")) j.at("wheel_block").get_to(c.wheel_block);
-    if (j.contains("zone")) j.at("zone").get_to(c.zone);
-    if (j.contains("scroll")) j.at("scroll").get_to(c.scroll);
-    if (j.contains("sound")) j.at("sound").get_to(c.sound);
-    if (j.contains("hotkeys")) j.at("hotkeys").get_to(c.hotkeys);
+         {"auto_profile", c.auto_profile}, {"language", c.language}, {"metrics", c.metrics},
+         {"zone", c.zone}, {"scroll", c.scroll}, {"sound", c.sound}, {"hotkeys", c.hotkeys},
+         {"profiles", c.profiles}};
 }
 
 // ───── Config Store ─────
+struct ConfigDiagnostic {
+    enum class Severity { Info, Warning, Error };
+    Severity    severity = Severity::Info;
+    std::string path;      // dotted key, e.g. "scroll.continuous_accel" ("" = document)
+    std::string message;
+};
+
+struct ConfigLoadResult {
+    bool complete = false;   // the whole document was read (no syntax error)
+    int  applied  = 0;       // schema fields taken from the file
+    std::vector<ConfigDiagnostic> diagnostics;
+};
+
+// Load() reads through the tolerant field-by-field loader
+// (ConfigLoader.h); Diagnostics() explains anything it had to coerce,
+// skip or default.
 class ConfigStore {
 public:
     bool Load(const std::string& path);
@@ -147,8 +169,11 @@ public:
     AppConfig& Get() { return config_; }
     const AppConfig& Get() const { return config_; }
 
+    const std::vector<ConfigDiagnostic>& Diagnostics() const { return diagnostics_; }
+
 private:
     AppConfig config_;
+    std::vector<ConfigDiagnostic> diagnostics_;
 };
 
 } // namespace sn
@@ -0,0 +1,373 @@
+#include "ConfigLoader.h"
+#include "ConfigSchema.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+
+namespace sn {
+
+// Keys written by the v2 (Slint) build that this build does not use.
+static constexpr const char* kIgnoredKeys[] = {
+    "theme", "current_profile", "wheel_block_bypass_modifier",
+    "profiles.description",
+};
+
+static bool IsIgnored(const std::string& path) {
+    for (const char* k : kIgnoredKeys)
+        if (path == k) return true;
+    return false;
+}
+
+// ───── Coercion ─────
+struct Value {
+    enum Kind { Null, Bool, Int, Float, String } kind = Null;
+    bool               b = false;
+    int64_t            i = 0;
+    double             d = 0.0;
+    const std::string* s = nullptr;
+};
+
+static const char* KindName(Value::Kind k) {
+    switch (k) {
+        case Value::Null:   return "null";
+        case Value::Bool:   return "a bool";
+        case Value::Int:    return "an integer";
+        case Value::Float:  return "a number";
+        case Value::String: return "a string";
+    }
+    return "?";
+}
+
+static bool ParseNumber(const std::string& s, double& out) {
+    if (s.empty()) return false;
+    char* end = nullptr;
+    out = std::strtod(s.c_str(), &end);
+    return end == s.c_str() + s.size() && std::isfinite(out);
+}
+
+static bool ParseBoolWord(const std::string& s, bool& out) {
+    // "off" and the three blocking modes are v2's wheel_block enum.
+    static const char* const kTrue[]  = {"true", "on", "yes", "1",
+                                         "global", "outside_zone_only", "inside_zone_only"};
+    static const char* const kFalse[] = {"false", "off", "no", "0", ""};
+    for (const char* w : kTrue)  if (s == w) { out = true;  return true; }
+    for (const char* w : kFalse) if (s == w) { out = false; return true; }
+    return false;
+}
+
+static std::string Format(const char* fmt, ...) {
+    char buf[160];
+    va_list ap;
+    va_start(ap, fmt);
+    std::vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+// Convert `v` into the field's type. Returns false (field untouched)
+// on a mismatch; `note` is set when the value had to be coerced.
+static bool Coerce(const FieldDesc& f, const Value& v, void* dst, std::string& note) {
+    switch (f.type) {
+    case FieldType::Int: {
+        double d;
+        if (v.kind == Value::Int) d = (double)v.i;
+        else if (v.kind == Value::Float) d = v.d;
+        else if (v.kind == Value::String && ParseNumber(*v.s, d)) note = "parsed from a string";
+        else return false;
+        if (!std::isfinite(d) || d < (double)INT_MIN || d > (double)INT_MAX) return false;
+        int n = (int)std::lround(d);
+        if ((double)n != d && note.empty()) note = Format("rounded %g to %d", d, n);
+        *static_cast<int*>(dst) = n;
+        return true;
+    }
+    case FieldType::Double: {
+        double d;
+        if (v.kind == Value::Int) d = (double)v.i;
+        else if (v.kind == Value::Float) d = v.d;
+        else if (v.kind == Value::String && ParseNumber(*v.s, d)) note = "parsed from a string";
+        else return false;
+        *static_cast<double*>(dst) = d;
+        return true;
+    }
+    case FieldType::Bool: {
+        bool b;
+        if (v.kind == Value::Bool) b = v.b;
+        else if (v.kind == Value::Int && (v.i == 0 || v.i == 1)) { b = v.i != 0; note = "integer read as bool"; }
+        else if (v.kind == Value::String && ParseBoolWord(*v.s, b))
+            note = Format("\"%s\" read as %s", v.s->c_str(), b ? "true" : "false");
+        else return false;
+        *static_cast<bool*>(dst) = b;
+        return true;
+    }
+    case FieldType::String:
+        if (v.kind != Value::String) return false;
+        *static_cast<std::string*>(dst) = *v.s;
+        return true;
+    }
+    return false;
+}
+
+// ───── SAX handler ─────
+// Paths are dotted keys; array elements add nothing, so every entry of
+// "profiles" is at "profiles" and its fields at "profiles.id",
+// "profiles.config.scroll.mode" and so on. A standalone preset file is
+// read as if its root object were one such entry.
+static const char   kProfiles[]      = "profiles";
+static const char   kProfileConfig[] = "profiles.config.";
+static const size_t kProfileConfigLen = sizeof(kProfileConfig) - 1;
+
+class ConfigSax {
+public:
+    using json = nlohmann::json;
+
+    // `single` set: the document is one profile (a preset file).
+    ConfigSax(AppConfig& cfg, ConfigLoadResult& res, ProfileConfig* single = nullptr)
+        : cfg_(cfg), res_(res), single_(single) {}
+
+    bool null()                                   { Value v; return Scalar(v); }
+    bool boolean(bool b)                          { Value v; v.kind = Value::Bool; v.b = b; return Scalar(v); }
+    bool number_integer(json::number_integer_t n) { Value v; v.kind = Value::Int; v.i = n; return Scalar(v); }
+    bool number_unsigned(json::number_unsigned_t n) {
+        Value v;
+        if (n <= (json::number_unsigned_t)INT64_MAX) { v.kind = Value::Int; v.i = (int64_t)n; }
+        else { v.kind = Value::Float; v.d = (double)n; }
+        return Scalar(v);
+    }
+    bool number_float(json::number_float_t d, const json::string_t&) {
+        Value v; v.kind = Value::Float; v.d = d; return Scalar(v);
+    }
+    bool string(json::string_t& s) { Value v; v.kind = Value::String; v.s = &s; return Scalar(v); }
+    bool binary(json::binary_t&)   { Value v; return Scalar(v); }
+
+    bool start_object(std::size_t) {
+        if (skip_) { skip_++; return true; }
+        if (open_.empty()) {                                  // document root
+            if (single_) { path_ = kProfiles; profile_ = single_; }
+            Open(false);
+            return true;
+        }
+        if (InArray()) {
+            if (path_ == kProfiles && !single_) {             // next "profiles" entry
+                cfg_.profiles.emplace_back();
+                profile_ = &cfg_.profiles.back();
+                Open(false);
+                return true;
+            }
+        } else if (profile_ && path_.compare(0, kProfileConfigLen - 1, kProfileConfig, kProfileConfigLen - 1) == 0) {
+            if (path_.size() == kProfileConfigLen - 1 ||
+                (path_[kProfileConfigLen - 1] == '.' && IsConfigSection(path_.substr(kProfileConfigLen)))) {
+                Open(false);
+                return true;
+            }
+        } else if (IsConfigSection(path_)) {
+            Open(false);
+            return true;
+        }
+        Skip("an object");
+        return true;
+    }
+    bool end_object() {
+        if (skip_) { skip_--; return true; }
+        Close();
+        if (InArray() && path_ == kProfiles) profile_ = nullptr;   // entry finished
+        return true;
+    }
+    bool start_array(std::size_t) {
+        if (skip_) { skip_++; return true; }
+        if (open_.empty()) {
+            Add(ConfigDiagnostic::Severity::Error, "", "top level is not an object");
+            skip_ = 1;
+            return true;
+        }
+        if (!InArray() && ((path_ == kProfiles && !single_) ||
+                           (profile_ && (path_ == "profiles.apps" || path_ == "profiles.window_classes")))) {
+            Open(true);
+            return true;
+        }
+        Skip("an array");
+        return true;
+    }
+    bool end_array() {
+        if (skip_) { skip_--; return true; }
+        Close();
+        return true;
+    }
+
+    bool key(json::string_t& k) {
+        if (skip_) return true;
+        path_.resize(open_.back().length);
+        if (!path_.empty()) path_ += '.';
+        path_ += k;
+        return true;
+    }
+
+    bool parse_error(std::size_t pos, const std::string&, const nlohmann::detail::exception& e) {
+        Add(ConfigDiagnostic::Severity::Error, "",
+            Format("syntax error at byte %zu: ", pos) + e.what());
+        return false;
+    }
+
+private:
+    struct Container {
+        size_t length;   // path_ length naming this object/array
+        bool   array;
+    };
+
+    void Open(bool array) { open_.push_back({path_.size(), array}); }
+    void Close() {
+        open_.pop_back();
+        path_.resize(open_.empty() ? 0 : open_.back().length);
+    }
+    bool InArray() const { return !open_.empty() && open_.back().array; }
+
+    bool Scalar(const Value& v) {
+        if (skip_) return true;
+        if (open_.empty()) {
+            Add(ConfigDiagnostic::Severity::Error, "", "top level is not an object");
+            return true;
+        }
+        if (InArray()) { ListItem(v); return true; }
+        if (profile_ && path_.compare(0, sizeof(kProfiles) - 1, kProfiles) == 0) {
+            ProfileScalar(v);
+            return true;
+        }
+
+        const FieldDesc* f = FindConfigField(path_);
+        if (!f) { NotAField(v); return true; }
+        Apply(*f, v, f->member(cfg_));
+        return true;
+    }
+
+    // A string inside "apps" / "window_classes".
+    void ListItem(const Value& v) {
+        auto* list = !profile_                          ? nullptr
+                   : path_ == "profiles.apps"           ? &profile_->apps
+                   : path_ == "profiles.window_classes" ? &profile_->window_classes
+                   : nullptr;
+        if (list && v.kind == Value::String && !v.s->empty()) list->push_back(*v.s);
+        else Add(ConfigDiagnostic::Severity::Warning, Where(),
+                 Format("%s is not usable here; skipped", KindName(v.kind)));
+    }
+
+    void ProfileScalar(const Value& v) {
+        if (path_ == "profiles.id" || path_ == "profiles.name") {
+            std::string& dst = path_ == "profiles.id" ? profile_->id : profile_->name;
+            if (v.kind == Value::String) { dst = *v.s; return; }
+            Add(ConfigDiagnostic::Severity::Warning, Where(),
+                Format("%s is not usable here; left empty", KindName(v.kind)));
+            return;
+        }
+        if (path_.compare(0, kProfileConfigLen, kProfileConfig) != 0) { Unknown(); return; }
+
+        const FieldDesc* f = FindConfigField(path_.substr(kProfileConfigLen));
+        if (!f) { Unknown(); return; }
+        if (!IsProfileField(*f)) {
+            Add(ConfigDiagnostic::Severity::Warning, Where(), "app-wide setting; ignored in a profile");
+            return;
+        }
+        AppConfig scratch;
+        if (!Apply(*f, v, f->member(scratch))) return;
+        ProfileSetting setting = MakeProfileSetting(*f, scratch);
+        // Kept in table order so two loads of the same profile compare equal.
+        auto& list = profile_->settings;
+        auto at = std::lower_bound(list.begin(), list.end(), setting.field,
+                                   [](const ProfileSetting& s, uint16_t field) { return s.field < field; });
+        if (at != list.end() && at->field == setting.field) *at = std::move(setting);
+        else list.insert(at, std::move(setting));
+    }
+
+    bool Apply(const FieldDesc& f, const Value& v, void* dst) {
+        std::string note;
+        if (Coerce(f, v, dst, note)) {
+            res_.applied++;
+            if (!note.empty()) Add(ConfigDiagnostic::Severity::Info, Where(), note);
+            return true;
+        }
+        Add(v.kind == Value::Null ? ConfigDiagnostic::Severity::Info
+                                  : ConfigDiagnostic::Severity::Warning,
+            Where(), Format("%s is not usable here; default kept", KindName(v.kind)));
+        return false;
+    }
+
+    void NotAField(const Value& v) {
+        if (IsConfigSection(path_))
+            Add(ConfigDiagnostic::Severity::Warning, Where(),
+                Format("%s where a section is expected; defaults kept", KindName(v.kind)));
+        else
+            Unknown();
+    }
+
+    // An object/array where none is expected: step over all of it.
+    void Skip(const char* what) {
+        skip_ = 1;
+        if (FindConfigField(path_))
+            Add(ConfigDiagnostic::Severity::Warning, Where(),
+                Format("%s is not usable here; default kept", what));
+        else
+            Unknown();
+    }
+
+    void Unknown() {
+        if (IsIgnored(path_)) Add(ConfigDiagnostic::Severity::Info, Where(), "not used by this build");
+        else                  Add(ConfigDiagnostic::Severity::Warning, Where(), "unknown key ignored");
+    }
+
+    // Diagnostic path: a preset file's keys are reported without the
+    // "profiles." they are matched under.
+    std::string Where() const {
+        if (!single_) return path_;
+        return path_.size() > sizeof(kProfiles) ? path_.substr(sizeof(kProfiles)) : std::string();
+    }
+
+    void Add(ConfigDiagnostic::Severity s, const std::string& path, std::string msg) {
+        res_.diagnostics.push_back({s, path, std::move(msg)});
+    }
+
+    AppConfig&             cfg_;
+    ConfigLoadResult&      res_;
+    ProfileConfig*         single_;
+    ProfileConfig*         profile_ = nullptr;   // entry being read
+    std::string            path_;                // dotted path of the current key
+    std::vector<Container> open_;                // open objects/arrays, outermost first
+    int                    skip_ = 0;            // depth inside a subtree being skipped
+};
+
+template <typename Input>
+static ConfigLoadResult Run(Input&& in, AppConfig& cfg, ProfileConfig* single) {
+    ConfigLoadResult res;
+    ConfigSax sax(cfg, res, single);
+    res.complete = nlohmann::json::sax_parse(std::forward<Input>(in), &sax);
+    return res;
+}
+
+ConfigLoadResult LoadConfig(std::istream& in, AppConfig& cfg) { return Run(in, cfg, nullptr); }
+ConfigLoadResult LoadConfig(const std::string& text, AppConfig& cfg) { return Run(text, cfg, nullptr); }
+
+ConfigLoadResult LoadProfile(std::istream& in, ProfileConfig& profile) {
+    AppConfig unused;
+    return Run(in, unused, &profile);
+}
+ConfigLoadResult LoadProfile(const std::string& text, ProfileConfig& profile) {
+    AppConfig unused;
+    return Run(text, unused, &profile);
+}
+
+ConfigLoadResult LoadPresetFile(const std::string& path, ProfileConfig& profile) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) {
+        ConfigLoadResult res;
+        res.diagnostics.push_back({ConfigDiagnostic::Severity::Error, "", "cannot open file"});
+        return res;
+    }
+    ConfigLoadResult res = LoadProfile(f, profile);
+    if (profile.id.empty()) profile.id = std::filesystem::path(path).stem().string();
+    return res;
+}
+
+} // namespace sn
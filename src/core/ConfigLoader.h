@@ -0,0 +1,44 @@
+#pragma once
+#include "Config.h"
+#include <iosfwd>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// Config loader — schema-driven streaming JSON reader
+//
+// Walks the document with nlohmann's SAX interface (no DOM) and
+// matches each scalar against the compile-time field table in
+// ConfigSchema.h. Every field is applied on its own: a value of the
+// wrong type keeps that field's default and produces a diagnostic
+// instead of discarding the whole file.
+//
+// Tolerated shapes (each noted as an Info diagnostic):
+//   • numbers where an int is expected are rounded (v2 writes
+//     "continuous_accel": 1.2);
+//   • numeric strings are parsed;
+//   • bools accept 0/1, "on"/"off", "yes"/"no" and the v2 wheel-block
+//     modes ("off" = false, "global"/"outside_zone_only"/
+//     "inside_zone_only" = true);
+//   • v2-only keys this build has no use for are skipped.
+//
+// "profiles" entries and preset files ({id, name, apps, window_classes,
+// config}) go through the same table; their "config" keeps only the
+// fields it sets, as ProfileSettings.
+//
+// A syntax error stops the parse; fields read before it are kept.
+// ─────────────────────────────────────────────────────────
+
+// `cfg` supplies the defaults; fields found in the input overwrite them.
+ConfigLoadResult LoadConfig(std::istream& in, AppConfig& cfg);
+ConfigLoadResult LoadConfig(const std::string& text, AppConfig& cfg);
+
+// One profile on its own (a preset file).
+ConfigLoadResult LoadProfile(std::istream& in, ProfileConfig& profile);
+ConfigLoadResult LoadProfile(const std::string& text, ProfileConfig& profile);
+
+// A preset file from disk; without an "id" it is named after the file.
+ConfigLoadResult LoadPresetFile(const std::string& path, ProfileConfig& profile);
+
+} // namespace sn
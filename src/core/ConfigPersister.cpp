@@ -0,0 +1,172 @@
+#include "ConfigPersister.h"
+#include "Metrics.h"
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace sn {
+
+// Results are registered up front: the worker and Flush() only look
+// them up
+static CounterFamily& g_saves = MetricsRegistry::Instance().AddCounterFamily(
+    "scrollnice_config_saves_total", "Config saves, by result.", "result");
+static Counter& g_savesWritten   = g_saves.With("written");
+static Counter& g_savesUnchanged = g_saves.With("unchanged");
+static Counter& g_savesFailed    = g_saves.With("failed");
+
+static uint64_t Fnv1a(const std::string& s) {
+    uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : s) { h ^= c; h *= 1099511628211ull; }
+    return h;
+}
+
+static std::string Serialize(const AppConfig& cfg) {
+    nlohmann::json j = cfg;
+    return j.dump(2);
+}
+
+bool WriteFileAtomic(const std::string& path, const std::string& data) {
+    const std::string tmp = path + ".tmp";
+    FILE* f = std::fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = std::fwrite(data.data(), 1, data.size(), f) == data.size() &&
+              std::fflush(f) == 0;
+#if defined(_WIN32)
+    ok = ok && _commit(_fileno(f)) == 0;
+#else
+    ok = ok && fsync(fileno(f)) == 0;
+#endif
+    ok = (std::fclose(f) == 0) && ok;
+
+    std::error_code ec;
+#if defined(_WIN32)
+    // std::filesystem::rename only replaces an existing file on some CRTs
+    if (ok && !MoveFileExA(tmp.c_str(), path.c_str(),
+                           MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        ok = false;
+#else
+    if (ok) std::filesystem::rename(tmp, path, ec);   // atomic replace
+#endif
+    if (!ok || ec) {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+// ───── ConfigPersister ─────
+ConfigPersister::ConfigPersister(std::chrono::milliseconds debounce,
+                                 std::chrono::milliseconds maxDelay)
+    : debounce_(debounce), maxDelay_(maxDelay) {
+    worker_ = std::thread(&ConfigPersister::WorkerLoop, this);
+}
+
+ConfigPersister::~ConfigPersister() {
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable()) worker_.join();
+}
+
+void ConfigPersister::SetTarget(const std::string& path, const AppConfig& onDisk) {
+    std::string text = Serialize(onDisk);
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_     = path;
+    diskHash_ = Fnv1a(text);
+}
+
+void ConfigPersister::Submit(const AppConfig& cfg) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto now = Clock::now();
+        if (!hasPending_) firstSubmit_ = now;
+        lastSubmit_ = now;
+        pending_    = cfg;
+        hasPending_ = true;
+        stats_.submits++;
+    }
+    wake_.notify_one();
+}
+
+bool ConfigPersister::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (hasPending_) {
+        flushNow_ = true;
+        wake_.notify_one();
+    }
+    idle_.wait(lock, [this] { return (!hasPending_ && !writing_) || quit_; });
+    return lastOk_;
+}
+
+bool ConfigPersister::Busy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hasPending_ || writing_;
+}
+
+ConfigPersisterStats ConfigPersister::Stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ConfigPersister::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return quit_ || hasPending_; });
+        if (quit_ && !hasPending_) return;
+
+        // Trailing-edge debounce, capped so a steady stream still lands.
+        while (!flushNow_ && !quit_) {
+            auto due = (std::min)(lastSubmit_ + debounce_, firstSubmit_ + maxDelay_);
+            if (Clock::now() >= due) break;
+            wake_.wait_until(lock, due);
+        }
+
+        AppConfig snapshot = pending_;
+        std::string path   = path_;
+        hasPending_ = false;
+        flushNow_   = false;
+        writing_    = true;
+
+        lock.unlock();
+        bool ok = path.empty() ? false : WriteSnapshot(snapshot, path);
+        lock.lock();
+
+        writing_ = false;
+        lastOk_  = ok;
+        if (!hasPending_) idle_.notify_all();
+    }
+}
+
+bool ConfigPersister::WriteSnapshot(const AppConfig& cfg, const std::string& path) {
+    std::string text;
+    try {
+        text = Serialize(cfg);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.failures++;
+        g_savesFailed.Add();
+        return false;
+    }
+    uint64_t h = Fnv1a(text);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (h == diskHash_) { stats_.unchanged++; g_savesUnchanged.Add(); return true; }
+    }
+    bool ok = WriteFileAtomic(path, text);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ok) { diskHash_ = h; stats_.writes++; g_savesWritten.Add(); }
+    else    { stats_.failures++; g_savesFailed.Add(); }
+    return ok;
+}
+
+} // namespace sn
@@ -0,0 +1,83 @@
+#pragma once
+#include "Config.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace sn {
+
+// Write `data` to `path` without ever leaving a truncated file behind:
+// write + flush to disk a sibling temp file, then rename it over `path`.
+bool WriteFileAtomic(const std::string& path, const std::string& data);
+
+struct ConfigPersisterStats {
+    uint64_t submits   = 0;   // Submit() calls
+    uint64_t writes    = 0;   // files actually written
+    uint64_t unchanged = 0;   // flushes skipped: content identical to disk
+    uint64_t failures  = 0;
+};
+
+// ─────────────────────────────────────────────────────────
+// ConfigPersister — write-behind config saving on a background thread
+//
+// Submit() copies the config and returns immediately; the UI never
+// waits on the disk. The worker waits until no new Submit() has come
+// in for `debounce` (but never longer than `maxDelay` after the first
+// one), serializes the latest snapshot, and skips the write when its
+// hash matches what is already on disk. Writes go through
+// WriteFileAtomic, so a crash mid-save keeps the previous file.
+// ─────────────────────────────────────────────────────────
+class ConfigPersister {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ConfigPersister(std::chrono::milliseconds debounce = std::chrono::milliseconds(300),
+                             std::chrono::milliseconds maxDelay = std::chrono::milliseconds(2000));
+    ~ConfigPersister();   // flushes anything pending
+
+    ConfigPersister(const ConfigPersister&) = delete;
+    ConfigPersister& operator=(const ConfigPersister&) = delete;
+
+    // Target file, and the config currently in it (so an unchanged
+    // config is never rewritten).
+    void SetTarget(const std::string& path, const AppConfig& onDisk);
+
+    void Submit(const AppConfig& cfg);
+
+    // Write the pending snapshot now and wait for it (exit path).
+    // Returns false if the last write failed.
+    bool Flush();
+
+    // A snapshot is waiting or being written (the file is about to change).
+    bool Busy();
+
+    ConfigPersisterStats Stats();
+
+private:
+    void WorkerLoop();
+    bool WriteSnapshot(const AppConfig& cfg, const std::string& path);   // worker only
+
+    std::chrono::milliseconds debounce_;
+    std::chrono::milliseconds maxDelay_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::string             path_;
+    AppConfig               pending_;
+    bool                    hasPending_ = false;
+    bool                    writing_    = false;
+    bool                    flushNow_   = false;
+    bool                    quit_       = false;
+    bool                    lastOk_     = true;
+    Clock::time_point       firstSubmit_;
+    Clock::time_point       lastSubmit_;
+    uint64_t                diskHash_ = 0;   // FNV-1a of the file content we last wrote/loaded
+    ConfigPersisterStats    stats_;
+    std::thread             worker_;
+};
+
+} // namespace sn
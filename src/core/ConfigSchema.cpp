@@ -0,0 +1,129 @@
+#include "ConfigSchema.h"
+#include <cstring>
+
+namespace sn {
+
+#define SN_FIELD(key, type, change, member) \
+    FieldDesc{key, FieldType::type, change, [](AppConfig& c) -> void* { return &c.member; }}
+
+static constexpr FieldDesc kFields[] = {
+    SN_FIELD("version",                 Int,    CHG_NONE,          version),
+    SN_FIELD("enabled",                 Bool,   CHG_ENABLED,       enabled),
+    SN_FIELD("start_with_windows",      Bool,   CHG_STARTUP,       start_with_windows),
+    SN_FIELD("wheel_block",             Bool,   CHG_WHEEL_BLOCK,   wheel_block),
+    SN_FIELD("auto_profile",            Bool,   CHG_PROFILES,      auto_profile),
+    SN_FIELD("language",                String, CHG_LANGUAGE,      language),
+    SN_FIELD("metrics",                 Bool,   CHG_METRICS,       metrics),
+    SN_FIELD("zone.x",                  Int,    CHG_ZONE_POSITION, zone.x),
+    SN_FIELD("zone.y",                  Int,    CHG_ZONE_POSITION, zone.y),
+    SN_FIELD("zone.width",              Int,    CHG_ZONE_SIZE,     zone.width),
+    SN_FIELD("zone.height",             Int,    CHG_ZONE_SIZE,     zone.height),
+    SN_FIELD("zone.opacity",            Double, CHG_ZONE_OPACITY,  zone.opacity),
+    SN_FIELD("zone.color",              String, CHG_ZONE_COLOR,    zone.color),
+    SN_FIELD("zone.cover_image",        String, CHG_ZONE_COVER,    zone.cover_image),
+    SN_FIELD("zone.locked",             Bool,   CHG_ZONE_LOCKED,   zone.locked),
+    SN_FIELD("scroll.mode",             String, CHG_MODE,          scroll.mode),
+    SN_FIELD("scroll.scroll_amount",    Int,    CHG_SCROLL_TUNING, scroll.scroll_amount),
+    SN_FIELD("scroll.continuous_speed", Int,    CHG_SCROLL_TUNING, scroll.continuous_speed),
+    SN_FIELD("scroll.continuous_accel", Int,    CHG_SCROLL_TUNING, scroll.continuous_accel),
+    SN_FIELD("scroll.hover_speed",      Int,    CHG_SCROLL_TUNING, scroll.hover_speed),
+    SN_FIELD("scroll.coast_ms",         Int,    CHG_SCROLL_TUNING, scroll.coast_ms),
+    SN_FIELD("scroll.backend",          String, CHG_SCROLL_BACKEND, scroll.backend),
+    SN_FIELD("sound.enabled",           Bool,   CHG_SOUND,         sound.enabled),
+    SN_FIELD("sound.click_sound",       String, CHG_SOUND,         sound.click_sound),
+    SN_FIELD("hotkeys.toggle_enabled",  String, CHG_HOTKEYS,       hotkeys.toggle_enabled),
+    SN_FIELD("hotkeys.toggle_edit",     String, CHG_HOTKEYS,       hotkeys.toggle_edit),
+    SN_FIELD("hotkeys.toggle_wheel",    String, CHG_HOTKEYS,       hotkeys.toggle_wheel),
+};
+
+#undef SN_FIELD
+
+FieldTable ConfigFields() {
+    return FieldTable{kFields, sizeof(kFields) / sizeof(kFields[0])};
+}
+
+const FieldDesc* FindConfigField(const std::string& path) {
+    for (const auto& f : kFields)
+        if (path == f.path) return &f;
+    return nullptr;
+}
+
+bool IsConfigSection(const std::string& path) {
+    for (const auto& f : kFields)
+        if (std::strncmp(f.path, path.c_str(), path.size()) == 0 && f.path[path.size()] == '.')
+            return true;
+    return false;
+}
+
+static bool FieldEqual(const FieldDesc& f, const void* a, const void* b) {
+    switch (f.type) {
+        case FieldType::Int:    return *static_cast<const int*>(a) == *static_cast<const int*>(b);
+        case FieldType::Bool:   return *static_cast<const bool*>(a) == *static_cast<const bool*>(b);
+        case FieldType::Double: return *static_cast<const double*>(a) == *static_cast<const double*>(b);
+        case FieldType::String:
+            return *static_cast<const std::string*>(a) == *static_cast<const std::string*>(b);
+    }
+    return false;
+}
+
+uint32_t DiffConfig(const AppConfig& from, const AppConfig& to) {
+    uint32_t changes = CHG_NONE;
+    for (const auto& f : kFields)
+        if ((changes & f.change) != f.change && !FieldEqual(f, f.Get(from), f.Get(to)))
+            changes |= f.change;
+    if (from.profiles != to.profiles) changes |= CHG_PROFILES;
+    return changes;
+}
+
+// ───── Profile settings ─────
+bool IsProfileField(const FieldDesc& f) {
+    const uint32_t global = CHG_ENABLED | CHG_WHEEL_BLOCK | CHG_STARTUP | CHG_HOTKEYS | CHG_PROFILES |
+                            CHG_LANGUAGE | CHG_METRICS;
+    return f.change != CHG_NONE && !(f.change & global);
+}
+
+ProfileSetting MakeProfileSetting(const FieldDesc& f, const AppConfig& from) {
+    ProfileSetting s;
+    s.field = (uint16_t)(&f - kFields);
+    const void* v = f.Get(from);
+    switch (f.type) {
+        case FieldType::Int:    s.number = *static_cast<const int*>(v); break;
+        case FieldType::Bool:   s.number = *static_cast<const bool*>(v) ? 1.0 : 0.0; break;
+        case FieldType::Double: s.number = *static_cast<const double*>(v); break;
+        case FieldType::String: s.text   = *static_cast<const std::string*>(v); break;
+    }
+    return s;
+}
+
+void ApplyProfileSetting(const ProfileSetting& s, AppConfig& to) {
+    if (s.field >= sizeof(kFields) / sizeof(kFields[0])) return;
+    const FieldDesc& f = kFields[s.field];
+    void* v = f.member(to);
+    switch (f.type) {
+        case FieldType::Int:    *static_cast<int*>(v)         = (int)s.number; break;
+        case FieldType::Bool:   *static_cast<bool*>(v)        = s.number != 0.0; break;
+        case FieldType::Double: *static_cast<double*>(v)      = s.number; break;
+        case FieldType::String: *static_cast<std::string*>(v) = s.text; break;
+    }
+}
+
+void to_json(nlohmann::json& j, const ProfileConfig& p) {
+    nlohmann::json config = nlohmann::json::object();
+    for (const auto& s : p.settings) {
+        if (s.field >= sizeof(kFields) / sizeof(kFields[0])) continue;
+        const FieldDesc& f = kFields[s.field];
+        std::string ptr = "/" + std::string(f.path);
+        for (char& c : ptr) if (c == '.') c = '/';
+        nlohmann::json& v = config[nlohmann::json::json_pointer(ptr)];
+        switch (f.type) {
+            case FieldType::Int:    v = (int)s.number; break;
+            case FieldType::Bool:   v = s.number != 0.0; break;
+            case FieldType::Double: v = s.number; break;
+            case FieldType::String: v = s.text; break;
+        }
+    }
+    j = {{"id", p.id}, {"name", p.name}, {"apps", p.apps},
+         {"window_classes", p.window_classes}, {"config", config}};
+}
+
+} // namespace sn
@@ -0,0 +1,83 @@
+#pragma once
+#include "Config.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// Config schema — one compile-time table describing every AppConfig
+// field: its dotted JSON key, its type, where it lives in the struct
+// and which subsystem has to be re-applied when it changes.
+//
+// The loader (ConfigLoader.h) reads files through it and DiffConfig()
+// compares two configs through it, so a new setting only needs a row
+// in the table (and a to_json entry) to load, save and hot-reload.
+// ─────────────────────────────────────────────────────────
+
+// Subsystems a config change can touch (bit set returned by DiffConfig).
+enum ConfigChange : uint32_t {
+    CHG_NONE          = 0,
+    CHG_ENABLED       = 1u << 0,    // zone on/off, tray state
+    CHG_ZONE_POSITION = 1u << 1,
+    CHG_ZONE_SIZE     = 1u << 2,
+    CHG_ZONE_OPACITY  = 1u << 3,
+    CHG_ZONE_COLOR    = 1u << 4,
+    CHG_ZONE_COVER    = 1u << 5,
+    CHG_ZONE_LOCKED   = 1u << 6,
+    CHG_MODE          = 1u << 7,    // overlay visuals, tray label, running scrolls
+    CHG_SCROLL_TUNING = 1u << 8,    // speeds/amounts → StateMachine::SetTuning
+    CHG_STARTUP       = 1u << 9,    // Run registry key
+    CHG_WHEEL_BLOCK   = 1u << 10,   // low-level mouse hook
+    CHG_HOTKEYS       = 1u << 11,
+    CHG_SOUND         = 1u << 12,   // click clip reloaded, mixer started/stopped
+    CHG_PROFILES      = 1u << 13,   // profile list / auto switching
+    CHG_LANGUAGE      = 1u << 14,   // UI string catalog
+    CHG_METRICS       = 1u << 15,   // local metrics endpoint
+    CHG_SCROLL_BACKEND = 1u << 16,  // how scroll reaches the target (ScrollEngine)
+    CHG_ALL           = 0xFFFFFFFFu
+};
+
+enum class FieldType : uint8_t { Int, Bool, Double, String };
+
+struct FieldDesc {
+    const char* path;                  // dotted key, e.g. "zone.opacity"
+    FieldType   type;
+    uint32_t    change;                // ConfigChange bits
+    void*     (*member)(AppConfig&);   // address of the field in a config
+
+    const void* Get(const AppConfig& c) const { return member(const_cast<AppConfig&>(c)); }
+};
+
+struct FieldTable {
+    const FieldDesc* begin() const { return first; }
+    const FieldDesc* end() const { return first + count; }
+    const FieldDesc* first;
+    size_t           count;
+};
+
+FieldTable ConfigFields();
+
+const FieldDesc* FindConfigField(const std::string& path);
+
+// True if some field lives below `path` (i.e. `path` names a section
+// such as "zone").
+bool IsConfigSection(const std::string& path);
+
+// Which subsystems differ between `from` and `to` (CHG_NONE if equal).
+uint32_t DiffConfig(const AppConfig& from, const AppConfig& to);
+
+// ───── Profile settings ─────
+// Profiles may override anything except the app-wide switches: enabled
+// and wheel blocking (toggled by hotkey), start with Windows, hotkeys,
+// profile switching itself, the UI language — and the file version.
+bool IsProfileField(const FieldDesc& f);
+
+// The value of field `f` in `from`, as a profile setting.
+ProfileSetting MakeProfileSetting(const FieldDesc& f, const AppConfig& from);
+
+// Write a profile setting into `to` (ignored if its field is unknown).
+void ApplyProfileSetting(const ProfileSetting& s, AppConfig& to);
+
+} // namespace sn
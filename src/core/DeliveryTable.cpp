@@ -0,0 +1,178 @@
+#include "DeliveryTable.h"
+#include "ConfigPersister.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <nlohmann/json.hpp>
+
+namespace sn {
+
+static Counter& g_confirmed = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_delivery_confirmed_total", "Scroll gestures a target confirmed with a scroll notification.");
+static Counter& g_misses = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_delivery_misses_total", "Scroll gestures that moved nothing the target reported.");
+static Counter& g_learned = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_delivery_learned_total", "Delivery methods learned (or given up on) for a target.");
+
+static const char* const kNames[kDeliveryCount] = {"post", "input", "vscroll"};
+
+const char* DeliveryName(Delivery d) {
+    return kNames[(int)d];
+}
+
+bool ParseDelivery(const std::string& name, Delivery& out) {
+    for (int i = 0; i < kDeliveryCount; i++)
+        if (name == kNames[i]) {
+            out = (Delivery)i;
+            return true;
+        }
+    return false;
+}
+
+std::string DeliveryKey(const std::string& exe, const std::string& windowClass) {
+    std::string key = exe;
+    for (char& c : key) c = (char)std::tolower((unsigned char)c);
+    key += '|';
+    key += windowClass;
+    return key;
+}
+
+DeliveryTable::Entry& DeliveryTable::Get(const std::string& key, double now) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        if (entries_.size() >= kMaxEntries) {
+            auto oldest = std::min_element(entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+                return a.second.lastUsed < b.second.lastUsed;
+            });
+            if (oldest->second.confirmed || oldest->second.silent) dirty_ = true;
+            entries_.erase(oldest);
+        }
+        it = entries_.emplace(key, Entry{}).first;
+    }
+    it->second.lastUsed = now;
+    return it->second;
+}
+
+void DeliveryTable::Settle(Entry& e, double now) {
+    if (e.judged || now - e.gestureStart <= kConfirmWindow) return;
+    e.judged = true;
+    g_misses.Add();
+    Miss(e);
+}
+
+void DeliveryTable::Miss(Entry& e) {
+    if (e.silent) return;
+    e.misses++;
+    if (e.confirmed) {
+        // The app changed (an update, another view): learn it again
+        if (e.misses < kForgetMisses) return;
+        e.confirmed = false;
+        e.method    = Delivery::PostWheel;
+        e.misses    = 0;
+        dirty_      = true;
+        return;
+    }
+    if (e.misses < kTrialMisses) return;
+    e.misses = 0;
+    const int next = (int)e.method + 1;
+    if (next < kDeliveryCount) {
+        e.method = (Delivery)next;
+        return;
+    }
+    // Nothing it does shows up as a scroll: keep to wheel messages
+    e.method = Delivery::PostWheel;
+    e.silent = true;
+    dirty_   = true;
+    g_learned.Add();
+}
+
+Delivery DeliveryTable::Choose(const std::string& key, double now) {
+    Entry& e = Get(key, now);
+    Settle(e, now);
+    return e.method;
+}
+
+void DeliveryTable::Sent(const std::string& key, Delivery method, double now) {
+    Entry& e = Get(key, now);
+    Settle(e, now);
+    if (now - e.lastSent > kGestureGap) {
+        e.gestureMethod = method;
+        e.gestureStart  = now;
+        e.judged        = false;
+    }
+    e.lastSent = now;
+}
+
+void DeliveryTable::Scrolled(const std::string& key, double now) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return;
+    Entry& e = it->second;
+    Settle(e, now);
+    if (e.judged) return;   // not ours (the user's own wheel, a late echo)
+    e.judged = true;
+    e.misses = 0;
+    g_confirmed.Add();
+    if (e.confirmed && e.method == e.gestureMethod) return;
+    e.confirmed = true;
+    e.silent    = false;
+    e.method    = e.gestureMethod;
+    dirty_      = true;
+    g_learned.Add();
+}
+
+bool DeliveryTable::Known(const std::string& key, Delivery& out) const {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || !it->second.confirmed) return false;
+    out = it->second.method;
+    return true;
+}
+
+// ───── Persistence ─────
+std::string DeliveryTable::Serialize() const {
+    nlohmann::json targets = nlohmann::json::object();
+    for (const auto& [key, e] : entries_) {
+        if (!e.confirmed && !e.silent) continue;
+        nlohmann::json t = {{"method", DeliveryName(e.method)}};
+        if (e.silent) t["silent"] = true;
+        targets[key] = std::move(t);
+    }
+    return nlohmann::json{{"version", 1}, {"targets", std::move(targets)}}.dump(2);
+}
+
+bool DeliveryTable::Deserialize(const std::string& text) {
+    const auto j = nlohmann::json::parse(text, nullptr, false);
+    if (!j.is_object() || !j.contains("targets") || !j["targets"].is_object()) return false;
+    entries_.clear();
+    for (const auto& [key, t] : j["targets"].items()) {
+        if (entries_.size() >= kMaxEntries) break;
+        Delivery method;
+        if (!t.is_object() || !ParseDelivery(t.value("method", ""), method)) continue;
+        Entry e;
+        e.silent    = t.value("silent", false);
+        e.confirmed = !e.silent;
+        e.method    = e.silent ? Delivery::PostWheel : method;
+        entries_.emplace(key, e);
+    }
+    dirty_ = false;
+    return true;
+}
+
+bool DeliveryTable::Load(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) return false;
+    std::stringstream text;
+    text << f.rdbuf();
+    return Deserialize(text.str());
+}
+
+// Synchronous: the app saves once, on exit.
+bool DeliveryTable::Save(const std::string& path) {
+    if (!dirty_) return true;
+    if (!WriteFileAtomic(path, Serialize())) return false;
+    dirty_ = false;
+    return true;
+}
+
+} // namespace sn
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace sn {
+
+// Ways a wheel step can reach a target window.
+enum class Delivery : uint8_t {
+    PostWheel,   // WM_MOUSEWHEEL posted to the target (no focus needed)
+    SendInput,   // synthesized wheel input (goes where the system sends it)
+    VScroll,     // WM_VSCROLL line steps posted to the target
+};
+constexpr int kDeliveryCount = 3;
+
+const char* DeliveryName(Delivery d);   // "post", "input", "vscroll"
+bool ParseDelivery(const std::string& name, Delivery& out);
+
+// Routing key of a target: "<exe, lower case>|<window class>".
+std::string DeliveryKey(const std::string& exe, const std::string& windowClass);
+
+// ─────────────────────────────────────────────────────────
+// DeliveryTable — which delivery actually scrolls each kind of target
+//
+// Every target starts on PostWheel. After sending, the caller reports
+// the target's scroll-position notifications through Scrolled(); a send
+// that is followed by one within kConfirmWindow confirms its method,
+// which is then used for that key from the first event on (and saved).
+// A gesture (sends less than kGestureGap apart) that moves nothing is
+// a miss: after kTrialMisses misses a method under trial makes way for
+// the next one, and a confirmed method is dropped after kForgetMisses
+// gestures in a row go nowhere. Targets that never report a scroll
+// under any method are marked silent and stay on PostWheel, so they
+// don't cycle through the alternatives forever.
+// ─────────────────────────────────────────────────────────
+class DeliveryTable {
+public:
+    static constexpr double kConfirmWindow = 0.4;    // s
+    static constexpr double kGestureGap    = 0.25;   // s
+    static constexpr int    kTrialMisses   = 2;
+    static constexpr int    kForgetMisses  = 4;
+    static constexpr size_t kMaxEntries    = 256;
+
+    // Method for the next send to `key` at time `now` (seconds, any
+    // steady clock).
+    Delivery Choose(const std::string& key, double now);
+
+    // A step went to `key` through `method`.
+    void Sent(const std::string& key, Delivery method, double now);
+
+    // `key` reported a change of its scroll position.
+    void Scrolled(const std::string& key, double now);
+
+    // Confirmed method for `key`, if any (false: still learning).
+    bool Known(const std::string& key, Delivery& out) const;
+
+    // Saved form: {"version":1,"targets":{"<key>":{"method":"post"} |
+    // {"method":"post","silent":true}}}. Only confirmed and silent
+    // entries are kept.
+    bool Load(const std::string& path);
+    bool Save(const std::string& path);   // skipped (true) when nothing changed
+    std::string Serialize() const;
+    bool Deserialize(const std::string& text);
+
+    size_t Size() const { return entries_.size(); }
+    bool   Dirty() const { return dirty_; }
+
+private:
+    struct Entry {
+        bool     confirmed = false;
+        bool     silent    = false;
+        Delivery method    = Delivery::PostWheel;   // confirmed, or under trial
+        int      misses    = 0;       // gestures in a row that moved nothing
+        Delivery gestureMethod = Delivery::PostWheel;
+        double   gestureStart  = 0.0;
+        double   lastSent      = -1e9;
+        bool     judged        = true;    // the current gesture has counted
+        double   lastUsed      = 0.0;
+    };
+
+    Entry& Get(const std::string& key, double now);
+    void   Settle(Entry& e, double now);   // judge a gesture nothing confirmed
+    void   Miss(Entry& e);
+
+    std::unordered_map<std::string, Entry> entries_;
+    bool dirty_ = false;
+};
+
+} // namespace sn
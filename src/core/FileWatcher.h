@@ -0,0 +1,37 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// FileWatcher — change notifications for a single file
+//
+// Watches the file's directory with the OS notification API
+// (ReadDirectoryChangesW on Windows, inotify on Linux) and calls back
+// when the file is written in place or a new file is renamed over it
+// (how editors and WriteFileAtomic save). No polling.
+//
+// The callback runs on the watcher's own thread and may fire several
+// times for one save; callers should hop to their UI thread and
+// coalesce (see the config reload in main.cpp).
+// ─────────────────────────────────────────────────────────
+class FileWatcher {
+public:
+    using Callback = std::function<void()>;
+
+    virtual ~FileWatcher() = default;
+
+    // Start watching `path` (same narrow encoding as the rest of the
+    // config paths). Returns false if the directory can't be watched.
+    virtual bool Start(const std::string& path, Callback onChange) = 0;
+
+    // Stop and join the watcher thread; no callback runs after this.
+    virtual void Stop() = 0;
+};
+
+// The platform implementation (defined in platform/<os>/…FileWatcher.cpp).
+std::unique_ptr<FileWatcher> CreateFileWatcher();
+
+} // namespace sn
@@ -0,0 +1,95 @@
+#include "FrameCache.h"
+#include "Metrics.h"
+#include <algorithm>
+
+namespace sn {
+
+// Hit rate = hit / (hit + miss) of the lookups
+static CounterFamily& g_lookups = MetricsRegistry::Instance().AddCounterFamily(
+    "scrollnice_frame_cache_lookups_total", "Overlay frame cache lookups, by result.", "result");
+static Counter& g_hits   = g_lookups.With("hit");
+static Counter& g_misses = g_lookups.With("miss");
+static Counter& g_evictions = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_frame_cache_evictions_total", "Overlay frames evicted to stay under the cache's memory cap.");
+static Counter& g_invalidations = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_frame_cache_invalidations_total", "Whole-cache drops after a resize, DPI, colour or cover change.");
+static Gauge& g_bytes = MetricsRegistry::Instance().AddGauge(
+    "scrollnice_frame_cache_bytes", "Pixel memory held by cached overlay frames.");
+
+void FrameCache::SetContext(int width, int height, unsigned dpi, uint32_t color, uint64_t coverGeneration) {
+    if (width == width_ && height == height_ && dpi == dpi_ &&
+        color == color_ && coverGeneration == coverGen_)
+        return;
+    width_ = width; height_ = height; dpi_ = dpi;
+    color_ = color; coverGen_ = coverGeneration;
+    Invalidate();
+}
+
+void FrameCache::Invalidate() {
+    if (!entries_.empty()) {
+        stats_.invalidations++;
+        g_invalidations.Add();
+    }
+    entries_.clear();
+    g_bytes.Add(-(double)stats_.bytes);
+    stats_.bytes  = 0;
+    stats_.frames = 0;
+}
+
+const Surface* FrameCache::Find(const FrameKey& key) {
+    uint64_t k = key.Pack();
+    for (auto& e : entries_) {
+        if (e.key == k) {
+            e.lastUse = ++clock_;
+            stats_.hits++;
+            g_hits.Add();
+            return &e.surface;
+        }
+    }
+    stats_.misses++;
+    g_misses.Add();
+    return nullptr;
+}
+
+Surface* FrameCache::Insert(const FrameKey& key) {
+    size_t bytes = FrameBytes();
+    if (bytes == 0 || bytes > maxBytes_) return nullptr;
+
+    uint64_t k = key.Pack();
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [k](const Entry& e) { return e.key == k; });
+    if (it == entries_.end()) {
+        EvictTo(maxBytes_ - bytes);
+        entries_.emplace_back();
+        it = entries_.end() - 1;
+        it->key = k;
+        it->pixels.resize((size_t)width_ * height_);
+        stats_.bytes += bytes;
+        g_bytes.Add((double)bytes);
+        stats_.frames = entries_.size();
+    }
+    it->lastUse = ++clock_;
+    it->surface = Surface{it->pixels.data(), width_, height_, width_};
+    return &it->surface;
+}
+
+void FrameCache::SetMaxBytes(size_t maxBytes) {
+    maxBytes_ = maxBytes;
+    EvictTo(maxBytes_);
+}
+
+void FrameCache::EvictTo(size_t budget) {
+    while (!entries_.empty() && stats_.bytes > budget) {
+        auto lru = std::min_element(entries_.begin(), entries_.end(),
+            [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+        const size_t bytes = lru->pixels.size() * sizeof(Pixel);
+        stats_.bytes -= bytes;
+        g_bytes.Add(-(double)bytes);
+        entries_.erase(lru);
+        stats_.evictions++;
+        g_evictions.Add();
+    }
+    stats_.frames = entries_.size();
+}
+
+} // namespace sn
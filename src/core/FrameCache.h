@@ -0,0 +1,92 @@
+#pragma once
+#include "Rasterizer.h"
+#include <cstdint>
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// FrameCache — pre-rendered overlay frames, one per visual state
+//
+// The zone only ever shows a handful of states (mode × edit × locked ×
+// enabled). Each is rendered once for the current
+// size/DPI/colour/cover and kept, so switching state is a copy instead
+// of a full re-render.
+//
+// The whole cache is dropped when the render context changes (resize,
+// DPI, colour, cover image). Frames beyond the memory cap are evicted
+// least-recently-used first. Lookups, evictions and the memory held are
+// also published to MetricsRegistry (scrollnice_frame_cache_*).
+// ─────────────────────────────────────────────────────────
+
+struct FrameKey {
+    uint8_t mode    = 0;   // ScrollMode
+    uint8_t edit    = 0;
+    uint8_t locked  = 0;
+    uint8_t enabled = 0;
+
+    uint64_t Pack() const {
+        return (uint64_t)mode | ((uint64_t)edit << 8) | ((uint64_t)locked << 16) |
+               ((uint64_t)enabled << 24);
+    }
+};
+
+struct FrameCacheStats {
+    uint64_t hits          = 0;
+    uint64_t misses        = 0;
+    uint64_t evictions     = 0;
+    uint64_t invalidations = 0;   // whole-cache drops from context changes
+    size_t   bytes         = 0;   // pixel memory currently held
+    size_t   frames        = 0;
+
+    double HitRate() const {
+        uint64_t total = hits + misses;
+        return total ? (double)hits / (double)total : 0.0;
+    }
+};
+
+class FrameCache {
+public:
+    explicit FrameCache(size_t maxBytes = 8u * 1024 * 1024) : maxBytes_(maxBytes) {}
+
+    // Describe what the frames are rendered for. Any difference from the
+    // previous context drops every cached frame.
+    void SetContext(int width, int height, unsigned dpi, uint32_t color, uint64_t coverGeneration);
+    void Invalidate();
+
+    // Cached frame for key, or nullptr (counted as a miss). Returned
+    // pointers stay valid until the next Insert/SetContext/Invalidate.
+    const Surface* Find(const FrameKey& key);
+
+    // Reserve a frame for key and return it for rendering. Evicts older
+    // frames to stay under the cap; nullptr if one frame alone exceeds it.
+    Surface* Insert(const FrameKey& key);
+
+    void SetMaxBytes(size_t maxBytes);
+    const FrameCacheStats& Stats() const { return stats_; }
+
+private:
+    struct Entry {
+        uint64_t key = 0;
+        uint64_t lastUse = 0;
+        std::vector<Pixel> pixels;
+        Surface surface;
+    };
+
+    size_t FrameBytes() const { return (size_t)width_ * height_ * sizeof(Pixel); }
+    void   EvictTo(size_t budget);
+
+    std::vector<Entry> entries_;
+    size_t   maxBytes_;
+    uint64_t clock_ = 0;
+
+    int      width_  = 0;
+    int      height_ = 0;
+    unsigned dpi_    = 0;
+    uint32_t color_  = 0;
+    uint64_t coverGen_ = 0;
+
+    FrameCacheStats stats_;
+};
+
+} // namespace sn
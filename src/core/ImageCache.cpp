@@ -0,0 +1,222 @@
+#include "ImageCache.h"
+#include "Resampler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+namespace sn {
+
+// Last-write time of `path` (UTF-8), or -1 if it can't be read.
+static int64_t FileStamp(const std::string& path) {
+    std::error_code ec;
+    auto t = std::filesystem::last_write_time(std::filesystem::u8path(path), ec);
+    return ec ? -1 : (int64_t)t.time_since_epoch().count();
+}
+
+ImageCache::ImageCache(ImageDecoder decoder, size_t budgetBytes)
+    : decoder_(std::move(decoder)), budget_(budgetBytes) {
+    worker_ = std::thread(&ImageCache::WorkerLoop, this);
+}
+
+ImageCache::~ImageCache() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+        jobs_.clear();
+    }
+    wake_.notify_all();
+    if (worker_.joinable()) worker_.join();
+}
+
+ImagePtr ImageCache::Acquire(const std::string& path, int w, int h) {
+    if (path.empty() || w <= 0 || h <= 0) return nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    pinnedPath_ = path;
+
+    Entry* master = FindLocked(path, 0, 0);
+    if (master) {
+        master->lastUse = ++clock_;
+        if (master->image && master->image->width == w && master->image->height == h) {
+            stats_.hits++;
+            return master->image;
+        }
+    }
+    // An undecodable file falls through: the worker looks at its
+    // last-write time and only decodes it again once it has changed
+    if (Entry* e = master && master->image ? FindLocked(path, w, h) : nullptr) {
+        e->lastUse = ++clock_;
+        stats_.hits++;
+        return e->image;
+    }
+
+    stats_.misses++;
+    auto same = [&](const Job& j) { return j.path == path && j.width == w && j.height == h; };
+    bool queued = (busy_ && same(running_)) || std::any_of(jobs_.begin(), jobs_.end(), same);
+    if (!queued) {
+        jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(),
+                                   [&](const Job& j) { return j.path == path; }),
+                    jobs_.end());
+        jobs_.push_back({path, w, h, EpochLocked(path)});
+        wake_.notify_one();
+    }
+    return nullptr;
+}
+
+ImagePtr ImageCache::Closest(const std::string& path, int w, int h) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* best = nullptr;
+    int bestDist = 0;
+    for (auto& e : entries_) {
+        if (e.path != path || !e.image) continue;
+        int d = std::abs(e.image->width - w) + std::abs(e.image->height - h);
+        if (!best || d < bestDist) { best = &e; bestDist = d; }
+    }
+    if (!best) return nullptr;
+    best->lastUse = ++clock_;
+    return best->image;
+}
+
+void ImageCache::Drop(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    epochs_[path]++;   // only this path's work in flight is discarded
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(),
+                               [&](const Job& j) { return j.path == path; }),
+                jobs_.end());
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->path == path) {
+            if (it->image) stats_.bytes -= it->image->Bytes();
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ImageCache::SetReadyCallback(std::function<void()> cb) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    onReady_ = std::move(cb);
+}
+
+void ImageCache::SetBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = bytes;
+    EvictLocked();
+}
+
+ImageCacheStats ImageCache::Stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+// ───── Internals (mutex_ held) ─────
+ImageCache::Entry* ImageCache::FindLocked(const std::string& path, int w, int h) {
+    for (auto& e : entries_)
+        if (e.width == w && e.height == h && e.path == path) return &e;
+    return nullptr;
+}
+
+uint64_t ImageCache::EpochLocked(const std::string& path) const {
+    auto it = epochs_.find(path);
+    return it == epochs_.end() ? 0 : it->second;
+}
+
+void ImageCache::InsertLocked(Entry e) {
+    e.lastUse = ++clock_;
+    if (e.image) stats_.bytes += e.image->Bytes();
+    if (Entry* old = FindLocked(e.path, e.width, e.height)) {
+        if (old->image) stats_.bytes -= old->image->Bytes();
+        *old = std::move(e);
+    } else {
+        entries_.push_back(std::move(e));
+    }
+    EvictLocked();
+}
+
+void ImageCache::EvictLocked() {
+    while (stats_.bytes > budget_) {
+        // Never evict what's on screen: the pinned path's master and the
+        // most recently used entry overall.
+        auto newest = std::max_element(entries_.begin(), entries_.end(),
+            [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+        auto victim = entries_.end();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (!it->image || it == newest) continue;
+            if (it->IsMaster() && it->path == pinnedPath_) continue;
+            if (victim == entries_.end() || it->lastUse < victim->lastUse) victim = it;
+        }
+        if (victim == entries_.end()) break;
+        stats_.bytes -= victim->image->Bytes();
+        stats_.evictions++;
+        entries_.erase(victim);
+    }
+}
+
+// ───── Worker ─────
+void ImageCache::WorkerLoop() {
+    for (;;) {
+        Job job;
+        ImagePtr master;
+        bool haveMaster = false;
+        int64_t failedStamp = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return quit_ || !jobs_.empty(); });
+            if (quit_) return;
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+            running_ = job;
+            busy_    = true;
+            if (Entry* m = FindLocked(job.path, 0, 0)) {
+                haveMaster  = true;
+                master      = m->image;
+                failedStamp = m->stamp;
+            }
+        }
+
+        // A file that failed before is read again only once it changed;
+        // unchanged, there is nothing new to report
+        const int64_t stamp = haveMaster && master ? 0 : FileStamp(job.path);
+        if (haveMaster && !master && stamp == failedStamp) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+            continue;
+        }
+
+        if (!master) {
+            auto img = std::make_shared<Image>();
+            bool ok = decoder_ && decoder_(job.path, *img) && img->width > 0 && img->height > 0 &&
+                      img->pixels.size() == (size_t)img->width * img->height;
+            std::lock_guard<std::mutex> lock(mutex_);
+            ok ? stats_.decodes++ : stats_.failures++;
+            if (job.epoch != EpochLocked(job.path)) { busy_ = false; continue; }
+            if (ok) master = img;
+            entries_.erase(std::remove_if(entries_.begin(), entries_.end(),   // the failed one
+                                          [&](const Entry& e) { return e.IsMaster() && e.path == job.path; }),
+                           entries_.end());
+            InsertLocked(Entry{job.path, 0, 0, master, stamp});
+        }
+
+        if (master && (master->width != job.width || master->height != job.height)) {
+            auto variant = std::make_shared<Image>();
+            variant->width  = job.width;
+            variant->height = job.height;
+            variant->pixels.resize((size_t)job.width * job.height);
+            resample::Resize(master->View(), variant->View(), resample::Quality::High);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.resamples++;
+            if (job.epoch != EpochLocked(job.path)) { busy_ = false; continue; }
+            InsertLocked(Entry{job.path, job.width, job.height, variant});
+        }
+
+        std::function<void()> cb;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+            cb = onReady_;
+        }
+        if (cb) cb();
+    }
+}
+
+} // namespace sn
@@ -0,0 +1,131 @@
+#pragma once
+#include "Rasterizer.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sn {
+
+// Decoded premultiplied BGRA32 image (same layout as a Surface).
+struct Image {
+    std::vector<Pixel> pixels;
+    int width  = 0;
+    int height = 0;
+
+    Surface View() const {
+        return Surface{const_cast<Pixel*>(pixels.data()), width, height, width};
+    }
+    size_t Bytes() const { return pixels.size() * sizeof(Pixel); }
+};
+
+using ImagePtr = std::shared_ptr<const Image>;
+
+// Platform hook: decode the file at `path` (UTF-8) into premultiplied
+// BGRA. Called on the cache's worker thread only.
+using ImageDecoder = std::function<bool(const std::string& path, Image& out)>;
+
+struct ImageCacheStats {
+    uint64_t decodes   = 0;   // files read from disk
+    uint64_t failures  = 0;   // decode errors
+    uint64_t resamples = 0;   // variants produced
+    uint64_t hits      = 0;   // Acquire() answered from memory
+    uint64_t misses    = 0;   // Acquire() that had to queue work
+    uint64_t evictions = 0;
+    size_t   bytes     = 0;   // masters + variants currently resident
+};
+
+// ─────────────────────────────────────────────────────────
+// ImageCache — decoded cover images and their size-matched variants
+//
+// Each file is decoded once into a premultiplied master copy; exact
+// w × h variants are resampled from it (Catmull-Rom) on a worker
+// thread. The UI thread never decodes, never touches the disk and
+// never runs the expensive filter: Acquire() either returns a resident
+// variant or queues the work and returns nothing, and the ready
+// callback fires (on the worker) when it lands.
+//
+// Masters and variants share one memory budget and are evicted least-
+// recently-used first. The master and variant used most recently are
+// pinned so the image on screen can always be rescaled without a
+// round trip to the disk.
+//
+// A file that fails to decode is remembered with its last-write time:
+// Acquire() has the worker look at the file again, and it is decoded
+// again only once it has changed (fixed or replaced).
+// ─────────────────────────────────────────────────────────
+class ImageCache {
+public:
+    explicit ImageCache(ImageDecoder decoder, size_t budgetBytes = 32u * 1024 * 1024);
+    ~ImageCache();
+
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    // `path` scaled to exactly w × h, or nullptr if it is not resident
+    // yet (the decode/resample is queued and the ready callback fires
+    // once it is done). A new size supersedes any still-queued size for
+    // the same path, so a live resize only ever resamples the latest.
+    ImagePtr Acquire(const std::string& path, int w, int h);
+
+    // Best resident stand-in while Acquire() is pending: the variant
+    // closest in size, else the master. nullptr until the file has
+    // been decoded at least once.
+    ImagePtr Closest(const std::string& path, int w, int h);
+
+    // Forget everything cached for `path` (e.g. the file changed).
+    void Drop(const std::string& path);
+
+    // Called on the worker thread after queued work completes.
+    void SetReadyCallback(std::function<void()> cb);
+
+    void SetBudget(size_t bytes);
+    ImageCacheStats Stats();
+
+private:
+    struct Entry {
+        std::string path;
+        int         width  = 0;   // 0 × 0 = master
+        int         height = 0;
+        ImagePtr    image;        // null while the file failed to decode
+        int64_t     stamp   = 0;  // master: file's last-write time when read
+        uint64_t    lastUse = 0;
+        bool        IsMaster() const { return width == 0 && height == 0; }
+    };
+    struct Job {
+        std::string path;
+        int      width = 0, height = 0;
+        uint64_t epoch = 0;         // results are discarded if Drop(path) ran since
+    };
+
+    Entry*   FindLocked(const std::string& path, int w, int h);
+    uint64_t EpochLocked(const std::string& path) const;
+    void     InsertLocked(Entry e);
+    void     EvictLocked();
+    void     WorkerLoop();
+
+    ImageDecoder            decoder_;
+    std::function<void()>   onReady_;
+    size_t                  budget_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::deque<Job>         jobs_;
+    Job                     running_;      // job the worker is processing
+    bool                    busy_ = false;
+    std::vector<Entry>      entries_;
+    uint64_t                clock_ = 0;
+    std::unordered_map<std::string, uint64_t> epochs_;   // Drop() count per path
+    std::string             pinnedPath_;   // path of the latest Acquire()
+    ImageCacheStats         stats_;
+    bool                    quit_ = false;
+    std::thread             worker_;
+};
+
+} // namespace sn
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// MappedFile — a read-only memory map of a whole file
+//
+// The OS pages the contents in on first touch; nothing is read or
+// copied up front. Implemented per platform (platform/<os>/…MappedFile.cpp).
+// ─────────────────────────────────────────────────────────
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // `path` is UTF-8 (widened for the OS on Windows).
+    bool Open(const std::string& path);
+    void Close();
+
+    const uint8_t* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+private:
+    const uint8_t* data_    = nullptr;
+    size_t         size_    = 0;
+    void*          mapping_ = nullptr;   // OS handle of the mapping (Windows)
+};
+
+} // namespace sn
@@ -0,0 +1,197 @@
+#include "Metrics.h"
+#include "MetricsServer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace sn {
+
+namespace {
+
+void AddDouble(std::atomic<double>& a, double d) {
+    double cur = a.load(std::memory_order_relaxed);
+    while (!a.compare_exchange_weak(cur, cur + d, std::memory_order_relaxed)) {}
+}
+
+// Shortest of %.15g / %.17g that reads back exactly; +Inf spelled out
+void AppendNumber(std::string& out, double v) {
+    if (std::isinf(v)) {
+        out += v > 0 ? "+Inf" : "-Inf";
+        return;
+    }
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.15g", v);
+    if (std::strtod(buf, nullptr) != v) std::snprintf(buf, sizeof(buf), "%.17g", v);
+    out += buf;
+}
+
+void AppendNumber(std::string& out, uint64_t v) {
+    out += std::to_string(v);
+}
+
+// HELP text escapes \ and newline; label values also escape "
+void AppendEscaped(std::string& out, const std::string& s, bool quotes) {
+    for (char c : s) {
+        if (c == '\\')              out += "\\\\";
+        else if (c == '\n')         out += "\\n";
+        else if (c == '"' && quotes) out += "\\\"";
+        else                        out += c;
+    }
+}
+
+} // namespace
+
+// ───── Metric types ─────
+void Gauge::Add(double d) {
+    AddDouble(value_, d);
+}
+
+Histogram::Histogram(std::vector<double> bounds)
+    : bounds_(std::move(bounds)),
+      buckets_(new std::atomic<uint64_t>[bounds_.size() + 1]) {
+    std::sort(bounds_.begin(), bounds_.end());
+    for (size_t i = 0; i <= bounds_.size(); i++) buckets_[i].store(0, std::memory_order_relaxed);
+}
+
+void Histogram::Observe(double v) {
+    const size_t i = std::lower_bound(bounds_.begin(), bounds_.end(), v) - bounds_.begin();
+    buckets_[i].fetch_add(1, std::memory_order_relaxed);
+    AddDouble(sum_, v);
+    count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+CounterFamily::CounterFamily(std::string label, size_t capacity)
+    : label_(std::move(label)), slots_(new Slot[capacity]), capacity_(capacity) {}
+
+Counter& CounterFamily::With(std::string_view value) {
+    const size_t n = size_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < n; i++)
+        if (slots_[i].value == value) return slots_[i].counter;
+    if (n == capacity_) return other_;
+    slots_[n].value = std::string(value);
+    size_.store(n + 1, std::memory_order_release);
+    return slots_[n].counter;
+}
+
+// ───── Registry ─────
+MetricsRegistry& MetricsRegistry::Instance() {
+    static MetricsRegistry inst;
+    return inst;
+}
+
+void* MetricsRegistry::Find(const std::string& name, Kind kind) const {
+    for (const auto& e : entries_)
+        if (e.name == name && e.kind == kind) return e.metric;
+    return nullptr;
+}
+
+Counter& MetricsRegistry::AddCounter(const std::string& name, const std::string& help) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* m = Find(name, Kind::Counter)) return *static_cast<Counter*>(m);
+    Counter& c = counters_.emplace_back();
+    entries_.push_back({name, help, Kind::Counter, &c});
+    return c;
+}
+
+Gauge& MetricsRegistry::AddGauge(const std::string& name, const std::string& help) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* m = Find(name, Kind::Gauge)) return *static_cast<Gauge*>(m);
+    Gauge& g = gauges_.emplace_back();
+    entries_.push_back({name, help, Kind::Gauge, &g});
+    return g;
+}
+
+Histogram& MetricsRegistry::AddHistogram(const std::string& name, const std::string& help,
+                                         std::vector<double> bounds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* m = Find(name, Kind::Histogram)) return *static_cast<Histogram*>(m);
+    Histogram& h = histograms_.emplace_back(std::move(bounds));
+    entries_.push_back({name, help, Kind::Histogram, &h});
+    return h;
+}
+
+CounterFamily& MetricsRegistry::AddCounterFamily(const std::string& name, const std::string& help,
+                                                 const std::string& label, size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* m = Find(name, Kind::Family)) return *static_cast<CounterFamily*>(m);
+    CounterFamily& f = families_.emplace_back(label, capacity);
+    entries_.push_back({name, help, Kind::Family, &f});
+    return f;
+}
+
+std::string MetricsRegistry::Render() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string out;
+    out.reserve(entries_.size() * 160);
+    for (const auto& e : entries_) {
+        static const char* const kTypes[] = {"counter", "gauge", "histogram", "counter"};
+        out += "# HELP " + e.name + ' ';
+        AppendEscaped(out, e.help, false);
+        out += "\n# TYPE " + e.name + ' ' + kTypes[(int)e.kind] + '\n';
+
+        switch (e.kind) {
+        case Kind::Counter:
+            out += e.name + ' ';
+            AppendNumber(out, static_cast<const Counter*>(e.metric)->Value());
+            out += '\n';
+            break;
+        case Kind::Gauge:
+            out += e.name + ' ';
+            AppendNumber(out, static_cast<const Gauge*>(e.metric)->Value());
+            out += '\n';
+            break;
+        case Kind::Histogram: {
+            const auto* h = static_cast<const Histogram*>(e.metric);
+            // Count first: a concurrent Observe() then can't make the
+            // +Inf bucket exceed _count
+            const uint64_t count = h->Count();
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < h->Bounds().size(); i++) {
+                cumulative += h->BucketCount(i);
+                out += e.name + "_bucket{le=\"";
+                AppendNumber(out, h->Bounds()[i]);
+                out += "\"} ";
+                AppendNumber(out, std::min(cumulative, count));
+                out += '\n';
+            }
+            out += e.name + "_bucket{le=\"+Inf\"} ";
+            AppendNumber(out, count);
+            out += '\n' + e.name + "_sum ";
+            AppendNumber(out, h->Sum());
+            out += '\n' + e.name + "_count ";
+            AppendNumber(out, count);
+            out += '\n';
+            break;
+        }
+        case Kind::Family: {
+            const auto* f = static_cast<const CounterFamily*>(e.metric);
+            const size_t n = f->Size();
+            for (size_t i = 0; i <= n; i++) {
+                const bool other = i == n;
+                if (other && f->Other().Value() == 0) break;
+                out += e.name + '{' + f->Label() + "=\"";
+                AppendEscaped(out, other ? std::string("other") : f->ValueAt(i), true);
+                out += "\"} ";
+                AppendNumber(out, other ? f->Other().Value() : f->CounterAt(i).Value());
+                out += '\n';
+            }
+            break;
+        }
+        }
+    }
+    return out;
+}
+
+// ───── Serving ─────
+std::string MetricsResponse(const std::string& request, const std::string& body) {
+    if (request.compare(0, 4, "GET ") != 0 && request.compare(0, 5, "HEAD ") != 0) return body;
+    std::string out = "HTTP/1.0 200 OK\r\n"
+                      "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                      "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                      "Connection: close\r\n\r\n";
+    if (request.compare(0, 5, "HEAD ") != 0) out += body;
+    return out;
+}
+
+} // namespace sn
@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sn {
+
+// ───── Metric types ─────
+// Updates are relaxed atomics: no lock and no allocation on the paths
+// being measured. A scrape can catch a histogram mid-Observe() (sum
+// updated, count not yet); Prometheus tolerates that.
+
+class Counter {
+public:
+    void Add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t Value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+class Gauge {
+public:
+    void Set(double v) { value_.store(v, std::memory_order_relaxed); }
+    void Add(double d);
+    double Value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value_{0.0};
+};
+
+// Fixed, ascending upper bounds; one more bucket catches the rest (+Inf).
+class Histogram {
+public:
+    explicit Histogram(std::vector<double> bounds);
+
+    void Observe(double v);
+
+    const std::vector<double>& Bounds() const { return bounds_; }
+    uint64_t BucketCount(size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+    uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+    double   Sum() const { return sum_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<double>                        bounds_;
+    std::unique_ptr<std::atomic<uint64_t>[]>   buckets_;   // bounds_.size() + 1, not cumulative
+    std::atomic<uint64_t>                      count_{0};
+    std::atomic<double>                        sum_{0.0};
+};
+
+// Observes the time to the end of the scope, in seconds.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& h) : histogram_(h), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        histogram_.Observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram&                            histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// One counter per label value (e.g. wheel events per target exe). New
+// values are added by a single thread; once `capacity` are in use the
+// rest share the "other" counter, so a stream of distinct values can't
+// grow it. Look a value up when it changes and keep the Counter&.
+class CounterFamily {
+public:
+    CounterFamily(std::string label, size_t capacity);
+
+    Counter& With(std::string_view value);
+
+    const std::string& Label() const { return label_; }
+    size_t             Size() const { return size_.load(std::memory_order_acquire); }
+    const std::string& ValueAt(size_t i) const { return slots_[i].value; }
+    const Counter&     CounterAt(size_t i) const { return slots_[i].counter; }
+    const Counter&     Other() const { return other_; }
+
+private:
+    struct Slot {
+        std::string value;   // written once, before size_ publishes it
+        Counter     counter;
+    };
+
+    std::string             label_;
+    std::unique_ptr<Slot[]> slots_;
+    size_t                  capacity_;
+    std::atomic<size_t>     size_{0};
+    Counter                 other_;
+};
+
+// ─────────────────────────────────────────────────────────
+// MetricsRegistry — the process's live counters
+//
+// Metrics are registered by name, usually into a static reference next
+// to the code they count, and live until exit (addresses are stable).
+// Registering a name twice returns the first metric. Render() writes
+// them all in the Prometheus text exposition format (version 0.0.4);
+// MetricsServer serves that on a local pipe or socket.
+//
+// Registration and Render() take a mutex; the updates don't.
+// ─────────────────────────────────────────────────────────
+class MetricsRegistry {
+public:
+    static MetricsRegistry& Instance();
+
+    Counter&       AddCounter(const std::string& name, const std::string& help);
+    Gauge&         AddGauge(const std::string& name, const std::string& help);
+    Histogram&     AddHistogram(const std::string& name, const std::string& help,
+                                std::vector<double> bounds);
+    CounterFamily& AddCounterFamily(const std::string& name, const std::string& help,
+                                    const std::string& label, size_t capacity = 32);
+
+    std::string Render() const;
+
+private:
+    enum class Kind { Counter, Gauge, Histogram, Family };
+
+    struct Entry {
+        std::string name;
+        std::string help;
+        Kind        kind;
+        void*       metric;
+    };
+
+    void* Find(const std::string& name, Kind kind) const;
+
+    mutable std::mutex        mutex_;
+    std::vector<Entry>        entries_;
+    std::deque<Counter>       counters_;
+    std::deque<Gauge>         gauges_;
+    std::deque<Histogram>     histograms_;
+    std::deque<CounterFamily> families_;
+};
+
+} // namespace sn
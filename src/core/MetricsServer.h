@@ -0,0 +1,48 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// MetricsServer — local scrape endpoint for MetricsRegistry
+//
+// Serves the registry on an endpoint only this machine can reach: a
+// named pipe that rejects remote clients on Windows
+// (\\.\pipe\ScrollNice-metrics), a Unix-domain socket with mode 0600 on
+// Linux ($XDG_RUNTIME_DIR/scrollnice-metrics.sock). Nothing listens on
+// the network.
+//
+// One response per connection, then the server closes it. A client
+// that opens with an HTTP request ("GET /metrics HTTP/1.1 …") gets an
+// HTTP/1.0 response, so curl --unix-socket and the usual scrapers'
+// socket proxies work; anything else (or silence for 100 ms) gets the
+// bare exposition text.
+//
+// Render runs on the server's thread, once per scrape.
+// ─────────────────────────────────────────────────────────
+class MetricsServer {
+public:
+    using Render = std::function<std::string()>;
+
+    virtual ~MetricsServer() = default;
+
+    // Start listening at the platform endpoint. False if it can't be
+    // created (e.g. another instance owns it).
+    virtual bool Start(Render render) = 0;
+
+    // Stop and join the server thread; the endpoint is gone after this.
+    virtual void Stop() = 0;
+
+    virtual std::string Endpoint() const = 0;
+};
+
+// The platform implementation (defined in platform/<os>/…MetricsServer.cpp).
+std::unique_ptr<MetricsServer> CreateMetricsServer();
+
+// The reply to what the client sent first (possibly nothing): `body`
+// as-is, or wrapped in an HTTP response if `request` is HTTP.
+std::string MetricsResponse(const std::string& request, const std::string& body);
+
+} // namespace sn
@@ -0,0 +1,75 @@
+#pragma once
+#include "ScrollBackend.h"
+#include <algorithm>
+#include <map>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// MockScrollSurfaceProvider — simulated documents for PatternScroller
+//
+// Each target added with AddDocument() behaves like a ScrollPattern
+// element over `contentPx` of content seen through `viewportPx`, and
+// counts the calls made to it; unknown targets have no surface. A
+// document can be scrolled "by the user" (Document().top) or removed
+// (the element goes away) between calls.
+// ─────────────────────────────────────────────────────────
+class MockScrollSurfaceProvider : public ScrollSurfaceProvider {
+public:
+    struct Document {
+        double contentPx  = 0.0;
+        double viewportPx = 0.0;
+        double top        = 0.0;   // px scrolled from the top
+        bool   alive      = true;
+        int    queries    = 0;
+        int    writes     = 0;
+    };
+
+    Document& AddDocument(ScrollTarget target, double contentPx, double viewportPx) {
+        Document& d = docs_[target];
+        d = Document{};
+        d.contentPx  = contentPx;
+        d.viewportPx = viewportPx;
+        return d;
+    }
+    Document& Doc(ScrollTarget target) { return docs_.at(target); }
+    void Remove(ScrollTarget target) { docs_.at(target).alive = false; }
+
+    int Resolves() const { return resolves_; }
+
+    std::unique_ptr<ScrollSurface> Resolve(ScrollTarget target) override {
+        resolves_++;
+        auto it = docs_.find(target);
+        if (it == docs_.end() || !it->second.alive) return nullptr;
+        return std::make_unique<Surface>(it->second);
+    }
+
+private:
+    class Surface : public ScrollSurface {
+    public:
+        explicit Surface(Document& doc) : doc_(doc) {}
+        bool Query(ScrollMetrics& m) override {
+            if (!doc_.alive) return false;
+            doc_.queries++;
+            const double range = doc_.contentPx - doc_.viewportPx;
+            m.viewportPx = doc_.viewportPx;
+            m.viewSize   = std::min(100.0, doc_.viewportPx * 100.0 / doc_.contentPx);
+            m.percent    = range > 0.0 ? doc_.top / range * 100.0 : -1.0;
+            return true;
+        }
+        bool SetPercent(double percent) override {
+            if (!doc_.alive) return false;
+            doc_.writes++;
+            doc_.top = percent / 100.0 * (doc_.contentPx - doc_.viewportPx);
+            return true;
+        }
+
+    private:
+        Document& doc_;
+    };
+
+    std::map<ScrollTarget, Document> docs_;
+    int                              resolves_ = 0;
+};
+
+} // namespace sn
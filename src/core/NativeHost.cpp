@@ -0,0 +1,131 @@
+#include "NativeHost.h"
+#include <nlohmann/json.hpp>
+#include <thread>
+
+namespace sn {
+
+// ───── Framing ─────
+bool ReadNativeMessage(std::FILE* in, std::string& message) {
+    unsigned char len[4];
+    if (std::fread(len, 1, 4, in) != 4) return false;
+    const uint32_t n = len[0] | (uint32_t)len[1] << 8 | (uint32_t)len[2] << 16 | (uint32_t)len[3] << 24;
+    if (n > kMaxNativeMessage) return false;
+    message.resize(n);
+    return std::fread(&message[0], 1, n, in) == n;
+}
+
+bool WriteNativeMessage(std::FILE* out, const std::string& message) {
+    if (message.size() > kMaxNativeMessage) return false;
+    const uint32_t n = (uint32_t)message.size();
+    const unsigned char len[4] = {(unsigned char)n, (unsigned char)(n >> 8), (unsigned char)(n >> 16),
+                                  (unsigned char)(n >> 24)};
+    return std::fwrite(len, 1, 4, out) == 4 && std::fwrite(message.data(), 1, n, out) == n &&
+           std::fflush(out) == 0;
+}
+
+std::string FeedEventMessage(const FeedEvent& event) {
+    nlohmann::json j;
+    if (event.kind == FeedEventKind::State) {
+        const CommandReply& s = event.state;
+        j = {{"type", "profile"},
+             {"id", s.profile},
+             {"mode", s.mode},
+             {"scroll_amount", s.scroll_amount},
+             {"continuous_speed", s.continuous_speed},
+             {"continuous_accel", s.continuous_accel},
+             {"hover_speed", s.hover_speed}};
+    } else {
+        j = {{"type", "scroll"}, {"dy", event.dy}, {"dt", event.dt}};
+    }
+    return j.dump();
+}
+
+// ───── NativeHost ─────
+NativeHost::NativeHost(std::FILE* in, std::FILE* out, uint32_t browserPid, Connector connect)
+    : in_(in), out_(out), browserPid_(browserPid), connect_(std::move(connect)) {}
+
+void NativeHost::Run() {
+    std::thread feed(&NativeHost::FeedLoop, this);
+
+    std::string message;
+    while (ReadNativeMessage(in_, message)) {
+        const auto j = nlohmann::json::parse(message, nullptr, false);
+        if (!j.is_object() || j.value("type", "") != "page") continue;
+        const bool ready = j.value("ready", false);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready == ready_) continue;
+        ready_ = ready;
+        if (!ready && client_) client_->Close();
+        changed_.notify_all();
+    }
+
+    // The browser closed the port (or sent garbage): shut down
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        if (client_) client_->Close();
+        changed_.notify_all();
+    }
+    feed.join();
+}
+
+// Holds a subscription while a page is ready and forwards the feed.
+// Only this thread writes to out_.
+void NativeHost::FeedLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        if (!ready_) {
+            changed_.wait(lock);
+            continue;
+        }
+        lock.unlock();
+        Command subscribe;
+        subscribe.op  = CommandOp::Subscribe;
+        subscribe.pid = browserPid_;
+        CommandReply reply;
+        std::unique_ptr<CommandClient> client = connect_();
+        const bool subscribed = client && client->Call(subscribe, reply) &&
+                                reply.status == CommandStatus::Ok;
+        lock.lock();
+
+        if (!subscribed) {
+            lock.unlock();
+            ReportConnected(false);
+            lock.lock();
+            changed_.wait_for(lock, kRetry, [this] { return stop_ || !ready_; });
+            continue;
+        }
+        if (stop_ || !ready_) continue;   // the page went away meanwhile
+        client_ = client.get();
+        lock.unlock();
+
+        ReportConnected(true);
+        FeedEvent state;
+        state.kind  = FeedEventKind::State;
+        state.state = reply;
+        bool ok = Send(FeedEventMessage(state));
+        std::string body;
+        FeedEvent event;
+        while (ok && client->Receive(body))
+            if (DecodeFeedEvent(body, event)) ok = Send(FeedEventMessage(event));
+
+        lock.lock();
+        client_ = nullptr;
+        lock.unlock();
+        client.reset();
+        ReportConnected(false);
+        lock.lock();
+        if (!ok) stop_ = true;   // stdout is gone: the browser left
+    }
+}
+
+bool NativeHost::Send(const std::string& message) { return WriteNativeMessage(out_, message); }
+
+void NativeHost::ReportConnected(bool connected) {
+    if (reported_ == (int)connected) return;
+    reported_ = connected;
+    Send(nlohmann::json{{"type", "status"}, {"connected", connected}}.dump());
+}
+
+} // namespace sn
@@ -0,0 +1,83 @@
+#pragma once
+#include "CommandChannel.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace sn {
+
+// ───── Native messaging framing ─────
+// The browser's stdio protocol: a uint32 length in native byte order
+// (little-endian on every platform we build for), then that much UTF-8
+// JSON. The browser won't take more than 1 MB from a host; the same
+// cap applies the other way.
+const uint32_t kMaxNativeMessage = 1024 * 1024;
+
+// False at end of input or on a malformed/oversized length.
+bool ReadNativeMessage(std::FILE* in, std::string& message);
+bool WriteNativeMessage(std::FILE* out, const std::string& message);
+
+// The JSON message for a feed event (see NativeHost below).
+std::string FeedEventMessage(const FeedEvent& event);
+
+// ─────────────────────────────────────────────────────────
+// NativeHost — relays the app's scroll feed to the FeelClick extension
+//
+// The browser starts tools/scrollnice_bridge for the extension and
+// talks to it over stdin/stdout.
+//
+//   extension → host
+//     {"type":"page","ready":bool}     the focused tab can take scrolls
+//   host → extension
+//     {"type":"status","connected":bool}
+//     {"type":"profile","id":…,"mode":…,"scroll_amount":…,
+//      "continuous_speed":…,"continuous_accel":…,"hover_speed":…}
+//     {"type":"scroll","dy":px,"dt":s}  + up; one per engine frame,
+//                                       dt 0 for a one-shot step
+//
+// While a page is ready the host holds a Subscribe on the app's command
+// channel for its browser's pid, so the app routes scrolling aimed at
+// that browser here instead of posting wheel messages; it retries every
+// kRetry while the app isn't running. Without a ready page it drops the
+// subscription and the app falls back to wheel events.
+// ─────────────────────────────────────────────────────────
+class NativeHost {
+public:
+    // A connected client, or null (the app isn't running)
+    using Connector = std::function<std::unique_ptr<CommandClient>()>;
+
+    static constexpr std::chrono::milliseconds kRetry{2000};
+
+    NativeHost(std::FILE* in, std::FILE* out, uint32_t browserPid, Connector connect);
+
+    NativeHost(const NativeHost&) = delete;
+    NativeHost& operator=(const NativeHost&) = delete;
+
+    // Serves until the browser closes stdin.
+    void Run();
+
+private:
+    void FeedLoop();
+    bool Send(const std::string& message);
+    void ReportConnected(bool connected);
+
+    std::FILE*  in_;
+    std::FILE*  out_;
+    uint32_t    browserPid_;
+    Connector   connect_;
+
+    std::mutex              mutex_;
+    std::condition_variable changed_;
+    bool                    ready_  = false;
+    bool                    stop_   = false;
+    CommandClient*          client_ = nullptr;   // while streaming (owned by FeedLoop)
+
+    int reported_ = -1;   // last "status" sent (feed thread only)
+};
+
+} // namespace sn
@@ -0,0 +1,109 @@
+#include "PanGesture.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sn {
+
+static Counter& g_contacts = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_pan_contacts_total", "Touch contacts injected for pan scrolling.");
+static Counter& g_gestures = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_pan_gestures_total", "Touch pans started (each lift and re-grip is a new one).");
+
+void PanPlanner::SetArea(const PanArea& area) {
+    if (hasArea_ && down_ && area.target != area_.target) Cancel();
+    area_    = area;
+    hasArea_ = area.target != 0 && area.bottom - area.top > 4 * kMargin;
+    failed_  = false;
+}
+
+bool PanPlanner::Move(double dy) {
+    if (!hasArea_ || failed_) return false;
+    pending_ += dy;
+    if (!framing_) {
+        framing_ = true;
+        sink_.StartFrames();
+    }
+    return true;
+}
+
+bool PanPlanner::Inject(PanPhase phase, int y) {
+    if (!sink_.Inject(PanContact{phase, x_, y})) {
+        // Nothing more reaches the target this way; the caller falls
+        // back to wheel events from the next Move()
+        failed_  = true;
+        down_    = false;
+        pending_ = 0.0;
+        return false;
+    }
+    g_contacts.Add();
+    y_ = y;
+    return true;
+}
+
+void PanPlanner::Lift() {
+    Inject(PanPhase::Up, y_);
+    down_ = false;
+}
+
+void PanPlanner::Cancel() {
+    if (down_) Lift();
+    pending_  = 0.0;
+    settling_ = 0;
+    if (framing_) {
+        framing_ = false;
+        sink_.StopFrames();
+    }
+}
+
+// Near the anchor if there is at least half the area to travel in,
+// otherwise at the far edge
+int PanPlanner::StartY(double dy) const {
+    const int lo = area_.top + kMargin, hi = area_.bottom - kMargin;
+    const int y = std::clamp(area_.y, lo, hi);
+    const int half = (hi - lo) / 2;
+    if (dy > 0) return hi - y >= half ? y : lo;   // finger moves down
+    return y - lo >= half ? y : hi;
+}
+
+void PanPlanner::Frame() {
+    if (!down_) {
+        if (std::abs(pending_) < 1.0 || failed_) {
+            if (failed_) pending_ = 0.0;
+            framing_ = false;
+            sink_.StopFrames();
+            return;
+        }
+        x_ = area_.x;
+        if (!Inject(PanPhase::Down, StartY(pending_))) return;
+        down_  = true;
+        still_ = 0;
+        g_gestures.Add();
+        return;
+    }
+
+    if (settling_ > 0) {
+        if (!Inject(PanPhase::Move, y_)) return;
+        if (--settling_ == 0) Lift();
+        return;
+    }
+
+    const double whole = std::trunc(pending_);
+    if (whole == 0.0) {
+        // Keep the contact alive while it holds still
+        if (!Inject(PanPhase::Move, y_)) return;
+        if (++still_ >= kIdleFrames) Lift();
+        return;
+    }
+
+    const int lo = area_.top + kMargin, hi = area_.bottom - kMargin;
+    const int y = std::clamp(y_ + (int)whole, lo, hi);
+    pending_ -= y - y_;
+    if (!Inject(PanPhase::Move, y)) return;
+    still_ = 0;
+    // At the edge with more to go: re-grip
+    if (std::abs(pending_) >= 1.0 && (y == lo || y == hi) && (pending_ > 0) == (y == hi))
+        settling_ = kSettleFrames;
+}
+
+} // namespace sn
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+
+namespace sn {
+
+// One injected touch contact, in screen pixels.
+enum class PanPhase : uint8_t { Down, Move, Up };
+
+struct PanContact {
+    PanPhase phase;
+    int      x;
+    int      y;
+};
+
+// Where a pan may put its finger: a point next to the zone (the last
+// cursor position outside it) and the vertical extent of the target
+// window. `target` identifies the window; a new one ends the gesture.
+struct PanArea {
+    uintptr_t target = 0;
+    int       x      = 0;
+    int       y      = 0;
+    int       top    = 0;
+    int       bottom = 0;
+};
+
+// Receives the planned contacts, at most one per frame.
+class PanSink {
+public:
+    virtual ~PanSink() = default;
+    virtual bool Inject(const PanContact& contact) = 0;   // false: injection unavailable
+    virtual void StartFrames() = 0;                        // PanPlanner::Frame() every ~16 ms from now on
+    virtual void StopFrames() = 0;
+};
+
+// ─────────────────────────────────────────────────────────
+// PanPlanner — scroll deltas as a one-finger touch pan
+//
+// Move() queues pixels (+ up: the finger moves down, dragging the
+// content with it); Frame() turns what is queued into one contact per
+// frame, so a tick's worth of deltas is one injection. The finger goes
+// down at the anchor (or, if that leaves too little room, at the edge of
+// the area away from the direction of travel) and drags in whole
+// pixels, keeping the fraction for later. When it reaches the edge of
+// the area it holds still for kSettleFrames and lifts — a still finger
+// lifts without a fling — and the next frame puts it down again for the
+// rest. kIdleFrames frames without movement end the gesture the same
+// way.
+// ─────────────────────────────────────────────────────────
+class PanPlanner {
+public:
+    static constexpr int kMargin       = 16;   // px kept clear of the area's edges
+    static constexpr int kSettleFrames = 2;
+    static constexpr int kIdleFrames   = 6;
+
+    explicit PanPlanner(PanSink& sink) : sink_(sink) {}
+
+    // The target and anchor for the next gesture. A different target
+    // lifts the finger first; the same one only moves the next anchor.
+    void SetArea(const PanArea& area);
+
+    // Queue dy pixels. False if there is no usable area or injection
+    // failed: deliver the scroll another way.
+    bool Move(double dy);
+
+    // One frame; the sink's StopFrames() follows once there is nothing
+    // left to do.
+    void Frame();
+
+    // Lift the finger now and drop anything queued.
+    void Cancel();
+
+    bool InContact() const { return down_; }
+
+private:
+    bool Inject(PanPhase phase, int y);
+    void Lift();
+    int  StartY(double dy) const;
+
+    PanSink& sink_;
+    PanArea  area_;
+    bool     hasArea_  = false;
+    bool     failed_   = false;   // until the next SetArea()
+    bool     framing_  = false;
+    bool     down_     = false;
+    int      x_ = 0, y_ = 0;      // contact position
+    double   pending_  = 0.0;
+    int      settling_ = 0;       // still frames left before the lift
+    int      still_    = 0;
+};
+
+} // namespace sn
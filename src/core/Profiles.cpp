@@ -0,0 +1,77 @@
+#include "Profiles.h"
+#include "ConfigSchema.h"
+#include <cctype>
+
+namespace sn {
+
+static std::string Lower(std::string s) {
+    for (char& c : s) c = (char)std::tolower((unsigned char)c);
+    return s;
+}
+
+void ProfileIndex::Build(const AppConfig& base, const std::vector<ProfileConfig>& presets) {
+    base_ = base;
+    base_.profiles.clear();
+    profiles_.clear();
+    byExe_.clear();
+    byClass_.clear();
+
+    // Presets first, user profiles after: same id → the user's wins.
+    struct Source { const ProfileConfig* profile; bool user; };
+    std::vector<Source> all;
+    for (const auto& p : presets) all.push_back({&p, false});
+    for (const auto& p : base.profiles) {
+        bool replaced = false;
+        for (auto& q : all)
+            if (!p.id.empty() && q.profile->id == p.id) { q = {&p, true}; replaced = true; }
+        if (!replaced) all.push_back({&p, true});
+    }
+
+    profiles_.reserve(all.size());
+    for (const auto& src : all) {
+        Entry e{src.profile->id, base_};
+        for (const auto& s : src.profile->settings) ApplyProfileSetting(s, e.config);
+        profiles_.push_back(std::move(e));
+    }
+
+    // Bind presets before user profiles so the later insert wins.
+    for (bool user : {false, true})
+        for (size_t i = 0; i < all.size(); i++)
+            if (all[i].user == user) Bind(*all[i].profile, (int)i);
+}
+
+void ProfileIndex::Bind(const ProfileConfig& p, int index) {
+    for (const auto& exe : p.apps) byExe_[Lower(exe)] = index;
+    for (const auto& cls : p.window_classes) byClass_[cls] = index;
+}
+
+int ProfileIndex::Find(const std::string& exe, const std::string& windowClass) const {
+    if (!exe.empty()) {
+        auto it = byExe_.find(Lower(exe));
+        if (it != byExe_.end()) return it->second;
+    }
+    if (!windowClass.empty()) {
+        auto it = byClass_.find(windowClass);
+        if (it != byClass_.end()) return it->second;
+    }
+    return kBase;
+}
+
+const AppConfig& ProfileIndex::Config(int index) const {
+    if (index < 0 || index >= (int)profiles_.size()) return base_;
+    return profiles_[index].config;
+}
+
+const std::string& ProfileIndex::Id(int index) const {
+    static const std::string kNone;
+    if (index < 0 || index >= (int)profiles_.size()) return kNone;
+    return profiles_[index].id;
+}
+
+int ProfileIndex::FindId(const std::string& id) const {
+    for (size_t i = 0; i < profiles_.size(); i++)
+        if (profiles_[i].id == id) return (int)i;
+    return kBase;
+}
+
+} // namespace sn
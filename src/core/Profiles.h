@@ -0,0 +1,54 @@
+#pragma once
+#include "Config.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// ProfileIndex — which config applies to the foreground application
+//
+// Build() resolves every profile once into a complete AppConfig
+// snapshot (base config + the profile's overrides), and indexes the
+// executable names and window classes it binds to in hash maps. A
+// foreground switch is then one lookup and, if the profile changed,
+// one diff-apply of a ready snapshot — nothing is merged or parsed on
+// the switch itself.
+//
+// Profiles come from two places: built-in presets and the user's
+// config.json. A user profile with a preset's id replaces it, and user
+// bindings win over preset bindings for the same app.
+// ─────────────────────────────────────────────────────────
+class ProfileIndex {
+public:
+    static constexpr int kBase = -1;   // no profile: the base config
+
+    void Build(const AppConfig& base, const std::vector<ProfileConfig>& presets);
+
+    // Profile for an executable file name (any case) or, failing that,
+    // a top-level window class; kBase if nothing matches.
+    int Find(const std::string& exe, const std::string& windowClass) const;
+
+    // Resolved config for a Find() result (kBase → the base config).
+    const AppConfig& Config(int index) const;
+    const std::string& Id(int index) const;
+    // Profile with that id; kBase if there is none.
+    int FindId(const std::string& id) const;
+    int Count() const { return (int)profiles_.size(); }
+
+private:
+    struct Entry {
+        std::string id;
+        AppConfig   config;
+    };
+
+    void Bind(const ProfileConfig& p, int index);
+
+    AppConfig          base_;
+    std::vector<Entry> profiles_;
+    std::unordered_map<std::string, int> byExe_;     // lower-case file name
+    std::unordered_map<std::string, int> byClass_;
+};
+
+} // namespace sn
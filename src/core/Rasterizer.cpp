@@ -0,0 +1,523 @@
+#include "Rasterizer.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace sn {
+namespace raster {
+
+// ───── Span kernels ─────
+// fill       : d[i] = c
+// blend      : d[i] = c over d[i]
+// blendCov   : d[i] = (c * cov[i]) over d[i]
+// blendPx    : d[i] = s[i] over d[i]
+// scaleCov   : d[i] = d[i] * cov[i]
+struct Kernels {
+    void (*fill)(Pixel* d, int n, Pixel c);
+    void (*blend)(Pixel* d, int n, Pixel c);
+    void (*blendCov)(Pixel* d, const uint8_t* cov, int n, Pixel c);
+    void (*blendPx)(Pixel* d, const Pixel* s, int n);
+    void (*scaleCov)(Pixel* d, const uint8_t* cov, int n);
+};
+
+// ───── Scalar ─────
+// Multiply all four channels by k/255 (rounded), two channels per op.
+static inline Pixel ScalePx(Pixel p, uint32_t k) {
+    uint32_t rb = (p & 0x00FF00FFu) * k + 0x00800080u;
+    rb = ((rb + ((rb >> 8) & 0x00FF00FFu)) >> 8) & 0x00FF00FFu;
+    uint32_t ag = ((p >> 8) & 0x00FF00FFu) * k + 0x00800080u;
+    ag = (ag + ((ag >> 8) & 0x00FF00FFu)) & 0xFF00FF00u;
+    return rb | ag;
+}
+
+static inline Pixel Over(Pixel d, Pixel s) {
+    return s + ScalePx(d, 255 - (s >> 24));
+}
+
+static void FillScalar(Pixel* d, int n, Pixel c) {
+    for (int i = 0; i < n; ++i) d[i] = c;
+}
+static void BlendScalar(Pixel* d, int n, Pixel c) {
+    for (int i = 0; i < n; ++i) d[i] = Over(d[i], c);
+}
+static void BlendCovScalar(Pixel* d, const uint8_t* cov, int n, Pixel c) {
+    for (int i = 0; i < n; ++i) {
+        if (cov[i]) d[i] = Over(d[i], ScalePx(c, cov[i]));
+    }
+}
+static void BlendPxScalar(Pixel* d, const Pixel* s, int n) {
+    for (int i = 0; i < n; ++i) d[i] = Over(d[i], s[i]);
+}
+static void ScaleCovScalar(Pixel* d, const uint8_t* cov, int n) {
+    for (int i = 0; i < n; ++i) d[i] = ScalePx(d[i], cov[i]);
+}
+
+static const Kernels kScalar = {
+    FillScalar, BlendScalar, BlendCovScalar, BlendPxScalar, ScaleCovScalar
+};
+
+#if defined(SN_SIMD_X86)
+// ───── SSE2 (4 px per iteration, 16-bit lanes) ─────
+SN_TARGET_SSE2 static inline __m128i Div255x8(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+// Broadcast the alpha lane of each 16-bit-unpacked pixel to all four lanes.
+SN_TARGET_SSE2 static inline __m128i AlphaX8(__m128i px16) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(px16, 0xFF), 0xFF);
+}
+// dst16 = src16 + dst16 * (255 - src.a) / 255
+SN_TARGET_SSE2 static inline __m128i OverX8(__m128i d16, __m128i s16) {
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), AlphaX8(s16));
+    return _mm_add_epi16(s16, Div255x8(_mm_mullo_epi16(d16, inv)));
+}
+
+SN_TARGET_SSE2 static void FillSSE2(Pixel* d, int n, Pixel c) {
+    __m128i v = _mm_set1_epi32((int)c);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_si128((__m128i*)(d + i), v);
+    for (; i < n; ++i) d[i] = c;
+}
+
+SN_TARGET_SSE2 static void BlendSSE2(Pixel* d, int n, Pixel c) {
+    const __m128i z   = _mm_setzero_si128();
+    const __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)c), z);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v  = _mm_loadu_si128((const __m128i*)(d + i));
+        __m128i lo = OverX8(_mm_unpacklo_epi8(v, z), s16);
+        __m128i hi = OverX8(_mm_unpackhi_epi8(v, z), s16);
+        _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi16(lo, hi));
+    }
+    for (; i < n; ++i) d[i] = Over(d[i], c);
+}
+
+// Expand 4 coverage bytes to two registers of [k k k k | k k k k] lanes.
+SN_TARGET_SSE2 static inline void CoverageX4(const uint8_t* cov, __m128i& klo, __m128i& khi) {
+    int32_t raw;
+    std::memcpy(&raw, cov, 4);
+    __m128i k  = _mm_unpacklo_epi8(_mm_cvtsi32_si128(raw), _mm_setzero_si128());
+    __m128i kk = _mm_unpacklo_epi16(k, k);
+    klo = _mm_unpacklo_epi32(kk, kk);
+    khi = _mm_unpackhi_epi32(kk, kk);
+}
+
+SN_TARGET_SSE2 static void BlendCovSSE2(Pixel* d, const uint8_t* cov, int n, Pixel c) {
+    const __m128i z   = _mm_setzero_si128();
+    const __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)c), z);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i klo, khi;
+        CoverageX4(cov + i, klo, khi);
+        __m128i v  = _mm_loadu_si128((const __m128i*)(d + i));
+        __m128i lo = OverX8(_mm_unpacklo_epi8(v, z), Div255x8(_mm_mullo_epi16(s16, klo)));
+        __m128i hi = OverX8(_mm_unpackhi_epi8(v, z), Div255x8(_mm_mullo_epi16(s16, khi)));
+        _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi16(lo, hi));
+    }
+    BlendCovScalar(d + i, cov + i, n - i, c);
+}
+
+SN_TARGET_SSE2 static void BlendPxSSE2(Pixel* d, const Pixel* s, int n) {
+    const __m128i z = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i sv = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i dv = _mm_loadu_si128((const __m128i*)(d + i));
+        __m128i lo = OverX8(_mm_unpacklo_epi8(dv, z), _mm_unpacklo_epi8(sv, z));
+        __m128i hi = OverX8(_mm_unpackhi_epi8(dv, z), _mm_unpackhi_epi8(sv, z));
+        _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi16(lo, hi));
+    }
+    BlendPxScalar(d + i, s + i, n - i);
+}
+
+SN_TARGET_SSE2 static void ScaleCovSSE2(Pixel* d, const uint8_t* cov, int n) {
+    const __m128i z = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i klo, khi;
+        CoverageX4(cov + i, klo, khi);
+        __m128i v  = _mm_loadu_si128((const __m128i*)(d + i));
+        __m128i lo = Div255x8(_mm_mullo_epi16(_mm_unpacklo_epi8(v, z), klo));
+        __m128i hi = Div255x8(_mm_mullo_epi16(_mm_unpackhi_epi8(v, z), khi));
+        _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi16(lo, hi));
+    }
+    ScaleCovScalar(d + i, cov + i, n - i);
+}
+
+static const Kernels kSSE2 = {
+    FillSSE2, BlendSSE2, BlendCovSSE2, BlendPxSSE2, ScaleCovSSE2
+};
+
+// ───── AVX2 (8 px per iteration) ─────
+// Unpack/pack work per 128-bit lane, so pixel order is preserved as long
+// as the coverage is expanded lane-wise too (CoverageX8). The explicit
+// zeroupper before the scalar tails avoids the AVX→SSE transition stall
+// compilers skip when the tail becomes a sibling call.
+SN_TARGET_AVX2 static inline __m256i Div255x16(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+SN_TARGET_AVX2 static inline __m256i AlphaX16(__m256i px16) {
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px16, 0xFF), 0xFF);
+}
+SN_TARGET_AVX2 static inline __m256i OverX16(__m256i d16, __m256i s16) {
+    __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), AlphaX16(s16));
+    return _mm256_add_epi16(s16, Div255x16(_mm256_mullo_epi16(d16, inv)));
+}
+
+SN_TARGET_AVX2 static void FillAVX2(Pixel* d, int n, Pixel c) {
+    __m256i v = _mm256_set1_epi32((int)c);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_si256((__m256i*)(d + i), v);
+    for (; i < n; ++i) d[i] = c;
+}
+
+SN_TARGET_AVX2 static void BlendAVX2(Pixel* d, int n, Pixel c) {
+    const __m256i z   = _mm256_setzero_si256();
+    const __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)c), z);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v  = _mm256_loadu_si256((const __m256i*)(d + i));
+        __m256i lo = OverX16(_mm256_unpacklo_epi8(v, z), s16);
+        __m256i hi = OverX16(_mm256_unpackhi_epi8(v, z), s16);
+        _mm256_storeu_si256((__m256i*)(d + i), _mm256_packus_epi16(lo, hi));
+    }
+    for (; i < n; ++i) d[i] = Over(d[i], c);
+}
+
+SN_TARGET_AVX2 static inline void CoverageX8(const uint8_t* cov, __m256i& klo, __m256i& khi) {
+    __m256i k32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)cov));
+    __m256i kk  = _mm256_or_si256(k32, _mm256_slli_epi32(k32, 16));
+    klo = _mm256_unpacklo_epi32(kk, kk);
+    khi = _mm256_unpackhi_epi32(kk, kk);
+}
+
+SN_TARGET_AVX2 static void BlendCovAVX2(Pixel* d, const uint8_t* cov, int n, Pixel c) {
+    const __m256i z   = _mm256_setzero_si256();
+    const __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)c), z);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i klo, khi;
+        CoverageX8(cov + i, klo, khi);
+        __m256i v  = _mm256_loadu_si256((const __m256i*)(d + i));
+        __m256i lo = OverX16(_mm256_unpacklo_epi8(v, z), Div255x16(_mm256_mullo_epi16(s16, klo)));
+        __m256i hi = OverX16(_mm256_unpackhi_epi8(v, z), Div255x16(_mm256_mullo_epi16(s16, khi)));
+        _mm256_storeu_si256((__m256i*)(d + i), _mm256_packus_epi16(lo, hi));
+    }
+    _mm256_zeroupper();
+    BlendCovScalar(d + i, cov + i, n - i, c);
+}
+
+SN_TARGET_AVX2 static void BlendPxAVX2(Pixel* d, const Pixel* s, int n) {
+    const __m256i z = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i sv = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i dv = _mm256_loadu_si256((const __m256i*)(d + i));
+        __m256i lo = OverX16(_mm256_unpacklo_epi8(dv, z), _mm256_unpacklo_epi8(sv, z));
+        __m256i hi = OverX16(_mm256_unpackhi_epi8(dv, z), _mm256_unpackhi_epi8(sv, z));
+        _mm256_storeu_si256((__m256i*)(d + i), _mm256_packus_epi16(lo, hi));
+    }
+    _mm256_zeroupper();
+    BlendPxScalar(d + i, s + i, n - i);
+}
+
+SN_TARGET_AVX2 static void ScaleCovAVX2(Pixel* d, const uint8_t* cov, int n) {
+    const __m256i z = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i klo, khi;
+        CoverageX8(cov + i, klo, khi);
+        __m256i v  = _mm256_loadu_si256((const __m256i*)(d + i));
+        __m256i lo = Div255x16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(v, z), klo));
+        __m256i hi = Div255x16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(v, z), khi));
+        _mm256_storeu_si256((__m256i*)(d + i), _mm256_packus_epi16(lo, hi));
+    }
+    _mm256_zeroupper();
+    ScaleCovScalar(d + i, cov + i, n - i);
+}
+
+static const Kernels kAVX2 = {
+    FillAVX2, BlendAVX2, BlendCovAVX2, BlendPxAVX2, ScaleCovAVX2
+};
+#endif // SN_SIMD_X86
+
+// ───── Dispatch ─────
+static Isa DetectIsa() {
+#if defined(SN_SIMD_X86)
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 1);
+    bool sse2    = (r[3] & (1 << 26)) != 0;
+    bool osxsave = (r[2] & (1 << 27)) != 0;
+    bool avx     = (r[2] & (1 << 28)) != 0;
+    bool avx2    = false;
+    if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(r, 7, 0);
+        avx2 = (r[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    bool sse2 = __builtin_cpu_supports("sse2");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (avx2) return Isa::AVX2;
+    if (sse2) return Isa::SSE2;
+#endif
+    return Isa::Scalar;
+}
+
+static const Kernels& KernelsFor(Isa isa) {
+#if defined(SN_SIMD_X86)
+    if (isa == Isa::AVX2) return kAVX2;
+    if (isa == Isa::SSE2) return kSSE2;
+#else
+    (void)isa;
+#endif
+    return kScalar;
+}
+
+static Isa            g_active = BestIsa();
+static const Kernels* g_k      = &KernelsFor(g_active);
+
+Isa BestIsa() {
+    static const Isa best = DetectIsa();
+    return best;
+}
+
+Isa ActiveIsa() { return g_active; }
+
+void SetIsa(Isa isa) {
+    if ((int)isa > (int)BestIsa()) isa = BestIsa();
+    g_active = isa;
+    g_k = &KernelsFor(isa);
+}
+
+const char* IsaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2:   return "avx2";
+        case Isa::SSE2:   return "sse2";
+        case Isa::Scalar: return "scalar";
+    }
+    return "scalar";
+}
+
+// ───── Helpers ─────
+static const int kChunk = 512;   // coverage scratch per call (stack, no alloc)
+
+static inline uint8_t ToCoverage(float v) {
+    if (v <= 0.0f) return 0;
+    if (v >= 1.0f) return 255;
+    return (uint8_t)(v * 255.0f + 0.5f);
+}
+
+static inline bool ClipRect(const Surface& s, IRect& r) {
+    r.left   = (std::max)(r.left, 0);
+    r.top    = (std::max)(r.top, 0);
+    r.right  = (std::min)(r.right, s.width);
+    r.bottom = (std::min)(r.bottom, s.height);
+    return r.left < r.right && r.top < r.bottom;
+}
+
+// Signed distance from pixel centre to a rounded rect (negative inside).
+struct RoundRectShape {
+    float cx, cy, hx, hy, r;
+
+    RoundRectShape(FRect rc, float radius) {
+        cx = (rc.left + rc.right) * 0.5f;
+        cy = (rc.top + rc.bottom) * 0.5f;
+        hx = (rc.right - rc.left) * 0.5f;
+        hy = (rc.bottom - rc.top) * 0.5f;
+        r  = std::clamp(radius, 0.0f, (std::min)(hx, hy));
+    }
+
+    float Qy(int y) const { return std::fabs(y + 0.5f - cy) - (hy - r); }
+
+    float Distance(int x, float qy) const {
+        float qx = std::fabs(x + 0.5f - cx) - (hx - r);
+        float ox = (std::max)(qx, 0.0f), oy = (std::max)(qy, 0.0f);
+        return std::sqrt(ox * ox + oy * oy) + (std::min)((std::max)(qx, qy), 0.0f) - r;
+    }
+};
+
+// Walk the rows of a rounded rect and hand each span to `op` with its
+// coverage. `covOf(d)` maps signed distance to coverage and must be
+// constant for d <= -radius: then the columns between the two corner
+// arcs share one coverage value per row and go through the uniform
+// (SIMD-friendly) path; only the arc columns are evaluated per pixel.
+template <class CovFn, class UniformOp, class SpanOp>
+static void ForEachRoundRectSpan(const Surface& s, FRect rc, float radius, bool flatInterior,
+                                 CovFn covOf, UniformOp uniform, SpanOp span) {
+    RoundRectShape sh(rc, radius);
+    IRect b = {(int)std::floor(rc.left), (int)std::floor(rc.top),
+               (int)std::ceil(rc.right), (int)std::ceil(rc.bottom)};
+    if (!ClipRect(s, b)) return;
+
+    int mx0 = b.left, mx1 = b.left;   // empty middle → whole row per pixel
+    if (flatInterior) {
+        mx0 = std::clamp((int)std::ceil(rc.left + sh.r - 0.5f), b.left, b.right);
+        mx1 = std::clamp((int)std::floor(rc.right - sh.r - 0.5f) + 1, mx0, b.right);
+    }
+
+    uint8_t cov[kChunk];
+    auto perPixel = [&](Pixel* row, int x0, int x1, float qy) {
+        for (int x = x0; x < x1; x += kChunk) {
+            int n = (std::min)(kChunk, x1 - x);
+            for (int i = 0; i < n; ++i)
+                cov[i] = ToCoverage(covOf(sh.Distance(x + i, qy)));
+            span(row + x, cov, n);
+        }
+    };
+
+    for (int y = b.top; y < b.bottom; ++y) {
+        Pixel* row = s.Row(y);
+        float qy = sh.Qy(y);
+        perPixel(row, b.left, mx0, qy);
+        if (mx1 > mx0) {
+            uniform(row + mx0, mx1 - mx0, ToCoverage(covOf((std::max)(qy, 0.0f) - sh.r)));
+        }
+        perPixel(row, (std::max)(mx1, mx0), b.right, qy);
+    }
+}
+
+// ───── Primitives ─────
+void Clear(const Surface& s, Pixel c) {
+    for (int y = 0; y < s.height; ++y) g_k->fill(s.Row(y), s.width, c);
+}
+
+void FillRect(const Surface& s, IRect r, Pixel c) {
+    if (!ClipRect(s, r) || (c >> 24) == 0) return;
+    auto fn = ((c >> 24) == 255) ? g_k->fill : g_k->blend;
+    for (int y = r.top; y < r.bottom; ++y)
+        fn(s.Row(y) + r.left, r.right - r.left, c);
+}
+
+static inline Pixel LerpPx(Pixel a, Pixel b, uint32_t t) {   // t: 0..255
+    Pixel out = 0;
+    for (int sh = 0; sh < 32; sh += 8) {
+        uint32_t ca = (a >> sh) & 0xFF, cb = (b >> sh) & 0xFF;
+        out |= ((ca * (255 - t) + cb * t + 127) / 255) << sh;
+    }
+    return out;
+}
+
+void FillVerticalGradient(const Surface& s, IRect r, Pixel top, Pixel bottom) {
+    int h = r.bottom - r.top;
+    if (h <= 0) return;
+    int y0 = r.top;
+    if (!ClipRect(s, r)) return;
+    for (int y = r.top; y < r.bottom; ++y) {
+        uint32_t t = (uint32_t)(((y - y0) * 255 + (h - 1) / 2) / (h > 1 ? h - 1 : 1));
+        Pixel c = LerpPx(top, bottom, (std::min)(t, 255u));
+        if ((c >> 24) == 0) continue;
+        g_k->blend(s.Row(y) + r.left, r.right - r.left, c);
+    }
+}
+
+void FillRoundRect(const Surface& s, FRect r, float radius, Pixel c) {
+    ForEachRoundRectSpan(s, r, radius, radius >= 0.5f,
+        [](float d) { return 0.5f - d; },
+        [&](Pixel* p, int n, uint8_t k) { if (k) g_k->blend(p, n, k == 255 ? c : ScalePx(c, k)); },
+        [&](Pixel* p, const uint8_t* cov, int n) { g_k->blendCov(p, cov, n, c); });
+}
+
+void StrokeRoundRect(const Surface& s, FRect r, float radius, float width, Pixel c) {
+    ForEachRoundRectSpan(s, r, radius, radius >= width + 0.5f,
+        [width](float d) {
+            return std::clamp(0.5f - d, 0.0f, 1.0f) - std::clamp(0.5f - d - width, 0.0f, 1.0f);
+        },
+        [&](Pixel* p, int n, uint8_t k) { if (k) g_k->blend(p, n, k == 255 ? c : ScalePx(c, k)); },
+        [&](Pixel* p, const uint8_t* cov, int n) { g_k->blendCov(p, cov, n, c); });
+}
+
+void InnerGlow(const Surface& s, FRect r, float radius, float width, Pixel c) {
+    if (width <= 0.0f) return;
+    ForEachRoundRectSpan(s, r, radius, radius >= width,
+        [width](float d) {
+            float inside = -d;
+            if (inside >= width) return 0.0f;
+            float g = 1.0f - (std::max)(inside, 0.0f) / width;
+            return g * g;
+        },
+        [&](Pixel* p, int n, uint8_t k) { if (k) g_k->blend(p, n, k == 255 ? c : ScalePx(c, k)); },
+        [&](Pixel* p, const uint8_t* cov, int n) { g_k->blendCov(p, cov, n, c); });
+}
+
+void ClipRoundRect(const Surface& s, float radius) {
+    FRect r = {0.0f, 0.0f, (float)s.width, (float)s.height};
+    ForEachRoundRectSpan(s, r, radius, radius >= 0.5f,
+        [](float d) { return 0.5f - d; },
+        [&](Pixel* p, int n, uint8_t k) {
+            if (k == 255) return;
+            for (int i = 0; i < n; ++i) p[i] = ScalePx(p[i], k);
+        },
+        [&](Pixel* p, const uint8_t* cov, int n) { g_k->scaleCov(p, cov, n); });
+}
+
+void FillTriangle(const Surface& s, float x0, float y0, float x1, float y1,
+                  float x2, float y2, Pixel c) {
+    // Counter-clockwise winding so all edge distances are positive inside.
+    float area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+    if (area == 0.0f) return;
+    if (area < 0.0f) { std::swap(x1, x2); std::swap(y1, y2); }
+
+    struct Edge { float a, b, c; };
+    auto mkEdge = [](float ax, float ay, float bx, float by) {
+        float nx = -(by - ay), ny = bx - ax;
+        float len = std::sqrt(nx * nx + ny * ny);
+        nx /= len; ny /= len;
+        return Edge{nx, ny, -(nx * ax + ny * ay)};
+    };
+    Edge e[3] = {mkEdge(x0, y0, x1, y1), mkEdge(x1, y1, x2, y2), mkEdge(x2, y2, x0, y0)};
+
+    IRect b = {(int)std::floor((std::min)({x0, x1, x2})), (int)std::floor((std::min)({y0, y1, y2})),
+               (int)std::ceil((std::max)({x0, x1, x2})),  (int)std::ceil((std::max)({y0, y1, y2}))};
+    if (!ClipRect(s, b)) return;
+
+    uint8_t cov[kChunk];
+    for (int y = b.top; y < b.bottom; ++y) {
+        float py = y + 0.5f;
+        for (int x = b.left; x < b.right; x += kChunk) {
+            int n = (std::min)(kChunk, b.right - x);
+            for (int i = 0; i < n; ++i) {
+                float px = x + i + 0.5f;
+                float d = (std::min)({e[0].a * px + e[0].b * py + e[0].c,
+                                      e[1].a * px + e[1].b * py + e[1].c,
+                                      e[2].a * px + e[2].b * py + e[2].c});
+                cov[i] = ToCoverage(d + 0.5f);
+            }
+            g_k->blendCov(s.Row(y) + x, cov, n, c);
+        }
+    }
+}
+
+void DashedHLine(const Surface& s, int x0, int x1, int y, int dash, int gap, Pixel c) {
+    if (y < 0 || y >= s.height || dash <= 0) return;
+    Pixel* row = s.Row(y);
+    for (int x = x0; x < x1; x += dash + gap) {
+        int a = (std::max)(x, 0);
+        int e = (std::min)({x + dash, x1, s.width});
+        if (e > a) g_k->blend(row + a, e - a, c);
+    }
+}
+
+void BlendMask(const Surface& s, int x, int y, const CoverageMask& m, Pixel c) {
+    IRect r = {x, y, x + m.width, y + m.height};
+    if (!m.data || !ClipRect(s, r)) return;
+    for (int yy = r.top; yy < r.bottom; ++yy) {
+        const uint8_t* src = m.data + (size_t)(yy - y) * m.stride + (r.left - x);
+        g_k->blendCov(s.Row(yy) + r.left, src, r.right - r.left, c);
+    }
+}
+
+void Blit(const Surface& dst, int x, int y, const Surface& src) {
+    IRect r = {x, y, x + src.width, y + src.height};
+    if (!src.pixels || !ClipRect(dst, r)) return;
+    for (int yy = r.top; yy < r.bottom; ++yy) {
+        g_k->blendPx(dst.Row(yy) + r.left, src.Row(yy - y) + (r.left - x), r.right - r.left);
+    }
+}
+
+} // namespace raster
+} // namespace sn
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// Rasterizer — platform-neutral 2D kernels for the zone visuals
+//
+// Renders into a premultiplied BGRA32 buffer laid out exactly like a
+// top-down 32-bit DIB section (one uint32_t per pixel, 0xAARRGGBB), so
+// the Win32 side can present the buffer with UpdateLayeredWindow and
+// nothing else.
+//
+// All blending is premultiplied src-over. Span kernels come in three
+// flavours — AVX2 (8 px), SSE2 (4 px) and scalar — picked once at
+// startup from what the CPU supports. SetIsa() lets a benchmark force
+// a slower set to compare.
+// ─────────────────────────────────────────────────────────
+
+using Pixel = uint32_t;
+
+// Premultiplied pixel from straight RGB + alpha.
+constexpr Pixel MakePixel(uint32_t r, uint32_t g, uint32_t b, uint32_t a = 255) {
+    return (a << 24) |
+           (((r * a + 127) / 255) << 16) |
+           (((g * a + 127) / 255) << 8) |
+           ((b * a + 127) / 255);
+}
+
+struct Surface {
+    Pixel* pixels = nullptr;
+    int    width  = 0;
+    int    height = 0;
+    int    stride = 0;   // in pixels
+
+    Pixel* Row(int y) const { return pixels + (size_t)y * stride; }
+};
+
+// 8-bit coverage (0 = none, 255 = full), e.g. a rasterised text label.
+struct CoverageMask {
+    const uint8_t* data = nullptr;
+    int width  = 0;
+    int height = 0;
+    int stride = 0;      // in bytes
+};
+
+struct IRect { int left, top, right, bottom; };
+struct FRect { float left, top, right, bottom; };
+
+namespace raster {
+
+enum class Isa { Scalar, SSE2, AVX2 };
+
+Isa         BestIsa();          // best kernel set this build + CPU can run
+Isa         ActiveIsa();        // kernel set currently in use
+void        SetIsa(Isa isa);    // clamped to BestIsa()
+const char* IsaName(Isa isa);
+
+void Clear(const Surface& s, Pixel c = 0);
+void FillRect(const Surface& s, IRect r, Pixel c);
+void FillVerticalGradient(const Surface& s, IRect r, Pixel top, Pixel bottom);
+
+// Anti-aliased rounded rectangles (radius in px, edges on pixel boundaries)
+void FillRoundRect(const Surface& s, FRect r, float radius, Pixel c);
+void StrokeRoundRect(const Surface& s, FRect r, float radius, float width, Pixel c);
+// Colour fading inward from the outline over `width` px (quadratic falloff)
+void InnerGlow(const Surface& s, FRect r, float radius, float width, Pixel c);
+
+void FillTriangle(const Surface& s, float x0, float y0, float x1, float y1,
+                  float x2, float y2, Pixel c);
+void DashedHLine(const Surface& s, int x0, int x1, int y, int dash, int gap, Pixel c);
+
+void BlendMask(const Surface& s, int x, int y, const CoverageMask& m, Pixel c);
+void Blit(const Surface& dst, int x, int y, const Surface& src);
+
+// Multiply the whole surface by the anti-aliased coverage of its own
+// rounded outline — cuts the corners after everything else is drawn.
+void ClipRoundRect(const Surface& s, float radius);
+
+} // namespace raster
+} // namespace sn
@@ -0,0 +1,52 @@
+#pragma once
+#include "PanGesture.h"
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// RecordingPanSink — a PanSink that keeps what PanPlanner does
+//
+// Every contact is recorded in order; Framing() says whether the
+// planner wants frames, and Run() gives it frames until it stops
+// asking. SetFailing() makes injection fail, the way it does on a
+// system without the pointer injection API.
+// ─────────────────────────────────────────────────────────
+class RecordingPanSink : public PanSink {
+public:
+    bool Inject(const PanContact& contact) override {
+        if (failing_) return false;
+        contacts_.push_back(contact);
+        return true;
+    }
+    void StartFrames() override {
+        framing_ = true;
+        starts_++;
+    }
+    void StopFrames() override { framing_ = false; }
+
+    void SetFailing(bool failing) { failing_ = failing; }
+    bool Framing() const { return framing_; }
+    int  FrameStarts() const { return starts_; }
+
+    const std::vector<PanContact>& Contacts() const { return contacts_; }
+    void Clear() { contacts_.clear(); }
+
+    // Frames until the planner is done (at most `maxFrames`).
+    int Run(PanPlanner& planner, int maxFrames = 10000) {
+        int frames = 0;
+        while (framing_ && frames < maxFrames) {
+            planner.Frame();
+            frames++;
+        }
+        return frames;
+    }
+
+private:
+    std::vector<PanContact> contacts_;
+    bool                    framing_ = false;
+    bool                    failing_ = false;
+    int                     starts_  = 0;
+};
+
+} // namespace sn
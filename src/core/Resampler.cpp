@@ -0,0 +1,242 @@
+#include "Resampler.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace sn {
+namespace resample {
+
+static const int kShift = 14;                // weights sum to 1 << kShift
+static const int kRound = 1 << (kShift - 1);
+
+// ───── Filter tables ─────
+// For each output index: `taps` clamped source indices and weights.
+// `taps` is always even so the SSE2 path can consume weights in pairs
+// (`pairs` holds w[2k] | w[2k+1] << 16 for _mm_madd_epi16).
+struct Contrib {
+    int taps = 0;
+    std::vector<int32_t>  index;
+    std::vector<int16_t>  weight;
+    std::vector<uint32_t> pairs;
+};
+
+static float CatmullRom(float x) {
+    x = std::fabs(x);
+    if (x < 1.0f) return (1.5f * x - 2.5f) * x * x + 1.0f;
+    if (x < 2.0f) return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+    return 0.0f;
+}
+
+static float Triangle(float x) {
+    x = std::fabs(x);
+    return x < 1.0f ? 1.0f - x : 0.0f;
+}
+
+static Contrib BuildContrib(int srcLen, int dstLen, Quality q) {
+    const float scale   = (float)srcLen / (float)dstLen;
+    const float fscale  = (std::max)(scale, 1.0f);     // widen on downscale
+    const float radius  = q == Quality::High ? 2.0f : 1.0f;
+    const float support = radius * fscale;
+    auto kernel = q == Quality::High ? CatmullRom : Triangle;
+
+    Contrib c;
+    c.taps = (int)std::ceil(support * 2.0f) + 1;
+    if (c.taps & 1) c.taps++;
+    c.index.resize((size_t)dstLen * c.taps);
+    c.weight.resize((size_t)dstLen * c.taps);
+    c.pairs.resize((size_t)dstLen * c.taps / 2);
+
+    std::vector<float> w(c.taps);
+    for (int i = 0; i < dstLen; ++i) {
+        const float center = (i + 0.5f) * scale;
+        const int   first  = (int)std::floor(center - support);
+        float sum = 0.0f;
+        for (int t = 0; t < c.taps; ++t) {
+            w[t] = kernel((first + t + 0.5f - center) / fscale);
+            sum += w[t];
+        }
+
+        int32_t* idx = &c.index[(size_t)i * c.taps];
+        int16_t* iw  = &c.weight[(size_t)i * c.taps];
+        int total = 0, peak = 0;
+        for (int t = 0; t < c.taps; ++t) {
+            idx[t] = std::clamp(first + t, 0, srcLen - 1);
+            iw[t]  = (int16_t)std::lround(w[t] / sum * (1 << kShift));
+            total += iw[t];
+            if (iw[t] > iw[peak]) peak = t;
+        }
+        iw[peak] = (int16_t)(iw[peak] + ((1 << kShift) - total));   // exact unity gain
+
+        uint32_t* pr = &c.pairs[(size_t)i * c.taps / 2];
+        for (int t = 0; t < c.taps; t += 2)
+            pr[t / 2] = (uint16_t)iw[t] | ((uint32_t)(uint16_t)iw[t + 1] << 16);
+    }
+    return c;
+}
+
+// ───── Scalar ─────
+// Fixed-point channel sums back to a valid premultiplied pixel:
+// alpha clamped to [0, 255], colour clamped to [0, alpha].
+static inline Pixel PackClamp(int32_t b, int32_t g, int32_t r, int32_t a) {
+    a = std::clamp((a + kRound) >> kShift, 0, 255);
+    r = std::clamp((r + kRound) >> kShift, 0, a);
+    g = std::clamp((g + kRound) >> kShift, 0, a);
+    b = std::clamp((b + kRound) >> kShift, 0, a);
+    return ((uint32_t)a << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | (uint32_t)b;
+}
+
+static void HRowScalar(const Pixel* s, Pixel* d, int n, const Contrib& c) {
+    for (int x = 0; x < n; ++x) {
+        const int32_t* idx = &c.index[(size_t)x * c.taps];
+        const int16_t* w   = &c.weight[(size_t)x * c.taps];
+        int32_t b = 0, g = 0, r = 0, a = 0;
+        for (int t = 0; t < c.taps; ++t) {
+            Pixel p = s[idx[t]];
+            b += (int32_t)(p & 0xFF) * w[t];
+            g += (int32_t)((p >> 8) & 0xFF) * w[t];
+            r += (int32_t)((p >> 16) & 0xFF) * w[t];
+            a += (int32_t)(p >> 24) * w[t];
+        }
+        d[x] = PackClamp(b, g, r, a);
+    }
+}
+
+static void VRowScalar(const Pixel* const* rows, const int16_t* w, int taps,
+                       Pixel* d, int x0, int n) {
+    for (int x = x0; x < n; ++x) {
+        int32_t b = 0, g = 0, r = 0, a = 0;
+        for (int t = 0; t < taps; ++t) {
+            Pixel p = rows[t][x];
+            b += (int32_t)(p & 0xFF) * w[t];
+            g += (int32_t)((p >> 8) & 0xFF) * w[t];
+            r += (int32_t)((p >> 16) & 0xFF) * w[t];
+            a += (int32_t)(p >> 24) * w[t];
+        }
+        d[x] = PackClamp(b, g, r, a);
+    }
+}
+
+#if defined(SN_SIMD_X86)
+// ───── SSE2 ─────
+// Pixels are widened to 16-bit lanes and interleaved tap-pairwise so a
+// single _mm_madd_epi16 yields (p0 * w0 + p1 * w1) per channel in 32 bits.
+
+// Two 32-bit [b g r a] accumulators → two clamped premultiplied pixels (16-bit lanes).
+SN_TARGET_SSE2 static inline __m128i PackClampX2(__m128i acc0, __m128i acc1) {
+    const __m128i rnd = _mm_set1_epi32(kRound);
+    acc0 = _mm_srai_epi32(_mm_add_epi32(acc0, rnd), kShift);
+    acc1 = _mm_srai_epi32(_mm_add_epi32(acc1, rnd), kShift);
+    __m128i v = _mm_packs_epi32(acc0, acc1);
+    v = _mm_min_epi16(_mm_max_epi16(v, _mm_setzero_si128()), _mm_set1_epi16(255));
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+    return _mm_min_epi16(v, a);
+}
+
+SN_TARGET_SSE2 static void HRowSSE2(const Pixel* s, Pixel* d, int n, const Contrib& c) {
+    const __m128i z = _mm_setzero_si128();
+    const int pairs = c.taps / 2;
+    for (int x = 0; x < n; ++x) {
+        const int32_t*  idx = &c.index[(size_t)x * c.taps];
+        const uint32_t* wp  = &c.pairs[(size_t)x * pairs];
+        __m128i acc = z;
+        for (int k = 0; k < pairs; ++k) {
+            __m128i p0 = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)s[idx[2 * k]]), z);
+            __m128i p1 = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)s[idx[2 * k + 1]]), z);
+            __m128i wv = _mm_set1_epi32((int)wp[k]);
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(p0, p1), wv));
+        }
+        d[x] = (Pixel)_mm_cvtsi128_si32(_mm_packus_epi16(PackClampX2(acc, acc), z));
+    }
+}
+
+SN_TARGET_SSE2 static void VRowSSE2(const Pixel* const* rows, const uint32_t* wp,
+                                    const int16_t* w, int taps, Pixel* d, int n) {
+    const __m128i z = _mm_setzero_si128();
+    int x = 0;
+    for (; x + 4 <= n; x += 4) {
+        __m128i acc0 = z, acc1 = z, acc2 = z, acc3 = z;
+        for (int t = 0; t < taps; t += 2) {
+            __m128i wv = _mm_set1_epi32((int)wp[t / 2]);
+            __m128i a  = _mm_loadu_si128((const __m128i*)(rows[t] + x));
+            __m128i b  = _mm_loadu_si128((const __m128i*)(rows[t + 1] + x));
+            __m128i alo = _mm_unpacklo_epi8(a, z), ahi = _mm_unpackhi_epi8(a, z);
+            __m128i blo = _mm_unpacklo_epi8(b, z), bhi = _mm_unpackhi_epi8(b, z);
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(alo, blo), wv));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(alo, blo), wv));
+            acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(ahi, bhi), wv));
+            acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(ahi, bhi), wv));
+        }
+        __m128i lo = PackClampX2(acc0, acc1);
+        __m128i hi = PackClampX2(acc2, acc3);
+        _mm_storeu_si128((__m128i*)(d + x), _mm_packus_epi16(lo, hi));
+    }
+    VRowScalar(rows, w, taps, d, x, n);
+}
+#endif // SN_SIMD_X86
+
+static bool UseSSE2() {
+#if defined(SN_SIMD_X86)
+    return raster::ActiveIsa() != raster::Isa::Scalar;
+#else
+    return false;
+#endif
+}
+
+void Resize(const Surface& src, const Surface& dst, Quality q) {
+    if (!src.pixels || !dst.pixels || src.width <= 0 || src.height <= 0 ||
+        dst.width <= 0 || dst.height <= 0)
+        return;
+
+    if (src.width == dst.width && src.height == dst.height) {
+        for (int y = 0; y < dst.height; ++y)
+            std::memcpy(dst.Row(y), src.Row(y), (size_t)dst.width * sizeof(Pixel));
+        return;
+    }
+
+    const bool sse2 = UseSSE2();
+
+    // ── Horizontal pass: src → tmp (dst.width × src.height) ──
+    // Skipped when only the height changes; the vertical pass then reads src.
+    std::vector<Pixel> tmp;
+    const Pixel* mid = src.pixels;
+    int midStride    = src.stride;
+    if (src.width != dst.width) {
+        Contrib cx = BuildContrib(src.width, dst.width, q);
+        tmp.resize((size_t)dst.width * src.height);
+        for (int y = 0; y < src.height; ++y) {
+            Pixel* out = tmp.data() + (size_t)y * dst.width;
+#if defined(SN_SIMD_X86)
+            if (sse2) { HRowSSE2(src.Row(y), out, dst.width, cx); continue; }
+#endif
+            HRowScalar(src.Row(y), out, dst.width, cx);
+        }
+        mid       = tmp.data();
+        midStride = dst.width;
+    }
+
+    // ── Vertical pass: tmp → dst ──
+    if (src.height == dst.height) {
+        for (int y = 0; y < dst.height; ++y)
+            std::memcpy(dst.Row(y), mid + (size_t)y * midStride, (size_t)dst.width * sizeof(Pixel));
+        return;
+    }
+    Contrib cy = BuildContrib(src.height, dst.height, q);
+    std::vector<const Pixel*> rows(cy.taps);
+    for (int y = 0; y < dst.height; ++y) {
+        const int32_t* idx = &cy.index[(size_t)y * cy.taps];
+        const int16_t* w   = &cy.weight[(size_t)y * cy.taps];
+        for (int t = 0; t < cy.taps; ++t) rows[t] = mid + (size_t)idx[t] * midStride;
+#if defined(SN_SIMD_X86)
+        if (sse2) {
+            VRowSSE2(rows.data(), &cy.pairs[(size_t)y * cy.taps / 2], w, cy.taps, dst.Row(y), dst.width);
+            continue;
+        }
+#endif
+        VRowScalar(rows.data(), w, cy.taps, dst.Row(y), 0, dst.width);
+    }
+}
+
+} // namespace resample
+} // namespace sn
@@ -0,0 +1,29 @@
+#pragma once
+#include "Rasterizer.h"
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// Resampler — scales premultiplied BGRA32 surfaces
+//
+// Separable two-pass filter with 14-bit fixed-point weights computed
+// once per (source, destination) length. On downscale the kernel is
+// widened by the scale factor so every source pixel contributes (no
+// aliasing). Results are clamped to valid premultiplied values.
+//
+// High   : Catmull-Rom, sharp — for the final cover variants.
+// Fast   : bilinear/box — cheap enough for the UI thread while a High
+//          variant is still being produced in the background.
+//
+// Uses the SSE2 path whenever raster::ActiveIsa() allows it.
+// ─────────────────────────────────────────────────────────
+
+namespace resample {
+
+enum class Quality { Fast, High };
+
+// Scale `src` to exactly fill `dst` (sizes come from the surfaces).
+void Resize(const Surface& src, const Surface& dst, Quality q = Quality::High);
+
+} // namespace resample
+} // namespace sn
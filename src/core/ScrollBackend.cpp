@@ -0,0 +1,90 @@
+#include "ScrollBackend.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sn {
+
+static Counter& g_resolves = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_pattern_resolves_total", "Scroll targets looked up for a ScrollPattern.");
+static Counter& g_writes = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_pattern_writes_total", "SetScrollPercent calls made to scroll a target.");
+
+PatternScroller::Entry& PatternScroller::Lookup(ScrollTarget target, double now) {
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [&](const Entry& e) { return e.target == target; });
+    if (it != entries_.end()) {
+        if (it->surface || now - it->resolvedAt < kRetryNoSurface) return *it;
+    } else {
+        if (entries_.size() >= kCacheSize) {
+            it = std::min_element(entries_.begin(), entries_.end(),
+                                  [](const Entry& a, const Entry& b) { return a.lastUsed < b.lastUsed; });
+        } else {
+            entries_.emplace_back();
+            it = entries_.end() - 1;
+        }
+        *it = Entry{};
+        it->target = target;
+    }
+    g_resolves.Add();
+    it->surface    = provider_.Resolve(target);
+    it->resolvedAt = now;
+    it->lastUsed   = -1e9;   // read the position before the first write
+    return *it;
+}
+
+// Start of a gesture: take the surface's position and size as they are
+// now (the user may have scrolled it some other way, the content may
+// have grown)
+bool PatternScroller::Refresh(Entry& e) {
+    ScrollMetrics m;
+    if (!e.surface->Query(m)) {
+        e.surface.reset();
+        return false;
+    }
+    const double content = m.viewSize > 0.0 ? m.viewportPx * 100.0 / m.viewSize : 0.0;
+    e.range = m.viewSize < 100.0 && m.percent >= 0.0 ? content - m.viewportPx : 0.0;
+    if (e.range < 1.0) return false;
+    e.position = std::clamp(m.percent, 0.0, 100.0) / 100.0 * e.range;
+    e.sentPx   = std::lround(e.position);
+    return true;
+}
+
+bool PatternScroller::Scroll(ScrollTarget target, double dy, double now) {
+    if (!target) return false;
+    Entry& e = Lookup(target, now);
+    if (!e.surface) return false;
+    if (now - e.lastUsed > kGestureGap && !Refresh(e) && !e.surface) {
+        e.resolvedAt = now - kRetryNoSurface;   // gone: resolve again next time
+        return false;
+    }
+    e.lastUsed = now;
+    if (e.range < 1.0) return false;   // fits in view (until the next gesture looks again)
+
+    e.position = std::clamp(e.position - dy, 0.0, e.range);
+    const long px = std::lround(e.position);
+    if (px == e.sentPx) return true;
+    g_writes.Add();
+    if (!e.surface->SetPercent(e.position / e.range * 100.0)) {
+        e.surface.reset();
+        e.resolvedAt = now - kRetryNoSurface;
+        return false;
+    }
+    e.sentPx = px;
+    return true;
+}
+
+bool PatternScroller::Ends(ScrollTarget target, double now, bool& atTop, bool& atBottom) {
+    if (!target) return false;
+    Entry& e = Lookup(target, now);
+    if (!e.surface) return false;
+    if (!Refresh(e)) {
+        if (!e.surface) e.resolvedAt = now - kRetryNoSurface;   // gone: resolve again next time
+        return false;
+    }
+    atTop    = e.position < 0.5;
+    atBottom = e.position > e.range - 0.5;
+    return true;
+}
+
+} // namespace sn
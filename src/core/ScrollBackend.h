@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sn {
+
+// A scroll target as the platform knows it (an HWND on Windows).
+using ScrollTarget = uintptr_t;
+
+// Vertical scroll state of a surface, in UI Automation's terms.
+struct ScrollMetrics {
+    double percent    = 0.0;     // position, 0 (top) … 100 (bottom)
+    double viewSize   = 100.0;   // share of the content in view, %; 100 = can't scroll
+    double viewportPx = 0.0;     // height of the view
+};
+
+// An element that can be positioned directly (UIA ScrollPattern).
+class ScrollSurface {
+public:
+    virtual ~ScrollSurface() = default;
+    // False once the element is gone.
+    virtual bool Query(ScrollMetrics& metrics) = 0;
+    virtual bool SetPercent(double percent) = 0;
+};
+
+// Finds the scrollable surface of a target; null if it has none.
+// Resolving is the expensive part (a cross-process tree search).
+class ScrollSurfaceProvider {
+public:
+    virtual ~ScrollSurfaceProvider() = default;
+    virtual std::unique_ptr<ScrollSurface> Resolve(ScrollTarget target) = 0;
+};
+
+// ─────────────────────────────────────────────────────────
+// PatternScroller — pixel scrolling through a ScrollSurface
+//
+// Each target is resolved once and kept in a small LRU cache, along
+// with the answer "no surface" (asked again after kRetryNoSurface).
+// Scroll() moves a position it keeps itself, in pixels, and sets the
+// surface's percent from it: the surface is read back only at the start
+// of a gesture (after kGestureGap without scrolling) and written only
+// when the position lands on another whole pixel. At either end it
+// does nothing, and it still reports the scroll as handled.
+// ─────────────────────────────────────────────────────────
+class PatternScroller {
+public:
+    static constexpr size_t kCacheSize       = 8;
+    static constexpr double kGestureGap      = 0.25;   // s
+    static constexpr double kRetryNoSurface  = 5.0;    // s
+
+    explicit PatternScroller(ScrollSurfaceProvider& provider) : provider_(provider) {}
+
+    // dy pixels (+ up) at time `now` (seconds, any steady clock). False
+    // if the target can't be scrolled this way: use wheel events.
+    bool Scroll(ScrollTarget target, double dy, double now);
+
+    // Read the target's position from its surface: whether it is at
+    // its top / bottom. False if it has no surface or can't scroll.
+    bool Ends(ScrollTarget target, double now, bool& atTop, bool& atBottom);
+
+    // Drop every cached surface (before the provider shuts down).
+    void Clear() { entries_.clear(); }
+
+private:
+    struct Entry {
+        ScrollTarget                   target = 0;
+        std::unique_ptr<ScrollSurface> surface;        // null: target has none
+        double                         resolvedAt = 0.0;
+        double                         lastUsed   = -1e9;
+        double                         position   = 0.0;   // px from the top
+        double                         range      = 0.0;   // scrollable px
+        long                           sentPx     = 0;     // last position written
+    };
+
+    Entry& Lookup(ScrollTarget target, double now);
+    bool   Refresh(Entry& e);
+
+    ScrollSurfaceProvider& provider_;
+    std::vector<Entry>     entries_;
+};
+
+} // namespace sn
@@ -0,0 +1,44 @@
+#include "ScrollBoundary.h"
+#include "Metrics.h"
+
+namespace sn {
+
+static Counter& g_held = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_boundary_held_total", "Scroll steps not sent because the target was already at that end.");
+static Counter& g_reports = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_boundary_reports_total", "Scroll positions read after the target reported a scroll.");
+
+void ScrollBoundary::Report(ScrollTarget target, bool atTop, bool atBottom) {
+    if (target != target_) return;   // a late report about the previous target
+    g_reports.Add();
+    atTop_    = atTop;
+    atBottom_ = atBottom;
+}
+
+bool ScrollBoundary::Allow(ScrollTarget target, int direction, double now) {
+    if (target != target_) {
+        Reset();
+        target_ = target;
+    }
+    bool& end   = direction > 0 ? atTop_ : atBottom_;
+    bool& other = direction > 0 ? atBottom_ : atTop_;
+    if (!end) {
+        other = false;   // moving away from it
+        return true;
+    }
+    if (now - lastProbe_ >= kProbeInterval) {
+        lastProbe_ = now;
+        return true;
+    }
+    g_held.Add();
+    return false;
+}
+
+void ScrollBoundary::Reset() {
+    target_    = 0;
+    atTop_     = false;
+    atBottom_  = false;
+    lastProbe_ = -1e9;
+}
+
+} // namespace sn
@@ -0,0 +1,40 @@
+#pragma once
+#include "ScrollBackend.h"
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// ScrollBoundary — stop scrolling into an end the target has reached
+//
+// The platform reports the target's position whenever the target says
+// it scrolled (Report()); nothing is polled. Allow() is asked before
+// every step: a step toward an end the target is at is held back. A
+// step the other way, or another target, lifts the hold. While held,
+// one step goes through every kProbeInterval anyway, so a document
+// that grows (an infinite feed) or a target that stops reporting
+// doesn't stay stuck.
+// ─────────────────────────────────────────────────────────
+class ScrollBoundary {
+public:
+    static constexpr double kProbeInterval = 1.0;   // s
+
+    // `target` is at its top / bottom (or not).
+    void Report(ScrollTarget target, bool atTop, bool atBottom);
+
+    // May a step in `direction` (+1 up, -1 down) go to `target` at
+    // time `now` (seconds, any steady clock)?
+    bool Allow(ScrollTarget target, int direction, double now);
+
+    void Reset();
+
+    bool AtTop() const { return atTop_; }
+    bool AtBottom() const { return atBottom_; }
+
+private:
+    ScrollTarget target_    = 0;
+    bool         atTop_     = false;
+    bool         atBottom_  = false;
+    double       lastProbe_ = -1e9;
+};
+
+} // namespace sn
@@ -1,14 +1,30 @@
 #include "ScrollEngine.h"
+#include "Metrics.h"
+#include "DeliveryTable.h"
+#include "PanGesture.h"
+#include "ScrollBackend.h"
+#include "ScrollBoundary.h"
+#include "../platform/win/WinForegroundWatcher.h"
+#include "../platform/win/WinScrollWatcher.h"
 #include <cmath>
 #include <algorithm>
 
 namespace sn {
 
+static CounterFamily& g_wheelEvents = MetricsRegistry::Instance().AddCounterFamily(
+    "scrollnice_wheel_events_total",
+    "Wheel events sent, by target executable (\"focused\": SendInput to the focused window).",
+    "target");
+static Counter& g_focusedEvents = g_wheelEvents.With("focused");
+static Counter& g_unknownEvents = g_wheelEvents.With("unknown");
+
 // ─────────────────────────────────────────────────────────
 // SendWheelEvent: Core routing logic
 //
 // Strategy for reaching the correct scrollable window:
-//   1. If targetHwnd_ is set → PostMessage directly (bypasses focus)
+//   1. If targetHwnd_ is set → the delivery the table picks for its
+//      app and class: PostMessage (default, bypasses focus), SendInput,
+//      or WM_VSCROLL line steps
 //   2. Fallback → SendInput (goes to focused window — less reliable)
 //
 // PostMessage with WM_MOUSEWHEEL:
@@ -19,6 +35,14 @@ namespace sn {
 // We put the current cursor position in lParam so the target window
 // can do its own hit-testing if needed (some apps use it).
 // ─────────────────────────────────────────────────────────
+static void SendWheelInput(int wheel_delta) {
+    INPUT input    = {};
+    input.type     = INPUT_MOUSE;
+    input.mi.dwFlags   = MOUSEEVENTF_WHEEL;
+    input.mi.mouseData = (DWORD)wheel_delta;
+    SendInput(1, &input, sizeof(INPUT));
+}
+
 void ScrollEngine::SendWheelEvent(int delta_px) {
     if (delta_px == 0) return;
 
@@ -28,47 +52,183 @@ void ScrollEngine::SendWheelEvent(int delta_px) {
     if (wheel_delta == 0)
         wheel_delta = (delta_px > 0) ? WHEEL_DELTA : -WHEEL_DELTA;
 
-    POINT cursor;
-    GetCursorPos(&cursor);
+    if (!targetHwnd_ || !IsWindow(targetHwnd_)) {
+        // Fallback: SendInput (delivers to focused window)
+        SendWheelInput(wheel_delta);
+        g_focusedEvents.Add();
+        return;
+    }
 
-    if (targetHwnd_ && IsWindow(targetHwnd_)) {
+    const double now = GetTickCount64() / 1000.0;
+    const Delivery method = deliveryTable_ ? deliveryTable_->Choose(targetKey_, now) : Delivery::PostWheel;
+    switch (method) {
+    case Delivery::PostWheel: {
         // Route directly to the target window regardless of focus.
         // MAKEWPARAM: low=virtual keys (0=none), high=wheel delta
+        POINT cursor;
+        GetCursorPos(&cursor);
         WPARAM wp = MAKEWPARAM(0, (SHORT)wheel_delta);
         LPARAM lp = MAKELPARAM(cursor.x, cursor.y);
         PostMessage(targetHwnd_, WM_MOUSEWHEEL, wp, lp);
-    } else {
-        // Fallback: SendInput (delivers to focused window)
-        INPUT input    = {};
-        input.type     = INPUT_MOUSE;
-        input.mi.dwFlags   = MOUSEEVENTF_WHEEL;
-        input.mi.mouseData = (DWORD)wheel_delta;
-        SendInput(1, &input, sizeof(INPUT));
+        break;
+    }
+    case Delivery::SendInput:
+        SendWheelInput(wheel_delta);
+        break;
+    case Delivery::VScroll: {
+        // Scroll bar line steps: 3 lines per WHEEL_DELTA, like the wheel
+        const int lines = std::max(1, (int)std::lround(std::abs(wheel_delta) * 3.0 / WHEEL_DELTA));
+        const WPARAM step = MAKEWPARAM(wheel_delta > 0 ? SB_LINEUP : SB_LINEDOWN, 0);
+        for (int i = 0; i < lines; i++) PostMessage(targetHwnd_, WM_VSCROLL, step, 0);
+        PostMessage(targetHwnd_, WM_VSCROLL, MAKEWPARAM(SB_ENDSCROLL, 0), 0);
+        break;
+    }
     }
+    if (deliveryTable_) deliveryTable_->Sent(targetKey_, method, now);
+    lastSent_ = now;
+    (targetEvents_ ? *targetEvents_ : g_unknownEvents).Add();
+}
+
+void ScrollEngine::SetTargetHwnd(HWND hwnd) {
+    targetHwnd_ = hwnd;
+    DWORD pid = 0;
+    if (!hwnd || hwnd == keyHwnd_) return;
+    if (!GetWindowThreadProcessId(hwnd, &pid)) {
+        // Gone already: nothing to learn about it or count it under
+        keyHwnd_      = nullptr;
+        targetKey_.clear();
+        targetPid_    = 0;
+        targetEvents_ = nullptr;
+        return;
+    }
+    if (pid != targetPid_ || !targetEvents_) {
+        targetPid_ = pid;
+        targetExe_ = ProcessExeName(pid);
+        targetEvents_ = &g_wheelEvents.With(targetExe_.empty() ? "unknown" : targetExe_);
+        UpdateWatch();
+    }
+    keyHwnd_   = hwnd;
+    targetKey_ = DeliveryKey(targetExe_, WindowClassName(hwnd));
+}
+
+// Scroll notifications are needed by the delivery table and the
+// boundary; only the target's process is watched
+void ScrollEngine::UpdateWatch() {
+    WinScrollWatcher::Instance().Watch(deliveryTable_ || boundary_ ? targetPid_ : 0);
+}
+
+void ScrollEngine::SetDeliveryTable(DeliveryTable* table) {
+    deliveryTable_ = table;
+    UpdateWatch();
+}
+
+void ScrollEngine::SetBoundary(ScrollBoundary* boundary, PatternScroller* reader) {
+    boundary_       = boundary;
+    positionReader_ = reader;
+    UpdateWatch();
+}
+
+// Ends of a standard scroll bar: the window's own (OBJID_VSCROLL) or a
+// vertical scroll bar control (OBJID_CLIENT). Only GetScrollInfo, which
+// reads state user32 keeps for every window — no call into the target.
+static bool ReadScrollBarEnds(HWND hwnd, LONG idObject, bool& atTop, bool& atBottom) {
+    int bar;
+    if (idObject == OBJID_VSCROLL) bar = SB_VERT;
+    else if (idObject == OBJID_CLIENT && (GetWindowLongW(hwnd, GWL_STYLE) & SBS_VERT)) bar = SB_CTL;
+    else return false;
+    SCROLLINFO si = {};
+    si.cbSize = sizeof(si);
+    si.fMask  = SIF_RANGE | SIF_PAGE | SIF_POS;
+    if (!GetScrollInfo(hwnd, bar, &si) || si.nMax <= si.nMin) return false;
+    atTop    = si.nPos <= si.nMin;
+    atBottom = si.nPos + (int)std::max<UINT>(si.nPage, 1) - 1 >= si.nMax;
+    return true;
+}
+
+void ScrollEngine::OnTargetScrolled(HWND hwnd, LONG idObject) {
+    if (!targetHwnd_) return;
+    const double now = GetTickCount64() / 1000.0;
+
+    // The target's own scroll bar, or a scroll bar control next to it;
+    // other windows of the same app don't count
+    const bool ours = hwnd == targetHwnd_ || IsChild(hwnd, targetHwnd_) || IsChild(targetHwnd_, hwnd) ||
+                      (idObject == OBJID_CLIENT && GetParent(hwnd) == GetParent(targetHwnd_));
+
+    // Only a scroll that follows one of our steps says the delivery
+    // worked (not the user's own wheel a while later)
+    if (ours && deliveryTable_ && !targetKey_.empty() && now - lastSent_ <= DeliveryTable::kConfirmWindow)
+        deliveryTable_->Scrolled(targetKey_, now);
+    if (!boundary_) return;
+
+    bool atTop = false, atBottom = false, known = false;
+    if (ours) known = ReadScrollBarEnds(hwnd, idObject, atTop, atBottom);
+    // (The UIA backend stops at the ends by itself)
+    if (!known && positionReader_ && !patternScroller_)
+        known = positionReader_->Ends(reinterpret_cast<ScrollTarget>(targetHwnd_), now, atTop, atBottom);
+    if (known) boundary_->Report(reinterpret_cast<ScrollTarget>(targetHwnd_), atTop, atBottom);
+}
+
+bool ScrollEngine::Allowed(int direction) {
+    return !boundary_ || !targetHwnd_ ||
+           boundary_->Allow(reinterpret_cast<ScrollTarget>(targetHwnd_), direction, GetTickCount64() / 1000.0);
+}
+
+bool ScrollEngine::DeliverExact(double dy, double dt) {
+    if (!targetHwnd_) return false;
+    if (pixelRoute_ && pixelRoute_(targetHwnd_, dy, dt)) return true;
+    if (patternScroller_ &&
+        patternScroller_->Scroll(reinterpret_cast<ScrollTarget>(targetHwnd_), dy, GetTickCount64() / 1000.0))
+        return true;
+    return panPlanner_ && panPlanner_->Move(dy);
 }
 
 void ScrollEngine::ClickScroll(int direction, int amount_px) {
     // direction: +1 = scroll UP, -1 = scroll DOWN
+    if (!Allowed(direction) || DeliverExact(direction * amount_px, 0.0)) return;
     SendWheelEvent(direction * amount_px);
 }
 
 void ScrollEngine::ContinuousScrollTick(int direction, int base_speed, int accel, double hold_seconds) {
     hold_time_ = hold_seconds;
 
-    // Speed increases the longer the user holds — capped at 200px/tick
+    // Speed increases the longer the user holds — capped at 200 px/s
     double speed = base_speed + accel * hold_seconds;
     speed = std::min(speed, 200.0);
+    VelocityTick(direction, speed);
+}
+
+void ScrollEngine::VelocityTick(int direction, double speed, double dt) {
+    exact_ = false;
+
+    // Already at that end: nothing to post until it moves or we turn
+    if (!Allowed(direction)) {
+        accum_ = 0.0;
+        return;
+    }
+
+    // The browser bridge and ScrollPattern take the exact per-tick
+    // delta, no quantising
+    if (DeliverExact(direction * speed * dt, dt)) {
+        accum_ = 0.0;
+        exact_ = true;
+        return;
+    }
 
     // Accumulate fractional events (avoids missing slow speeds)
-    accum_ += direction * speed * 0.016; // 0.016s ≈ 60fps tick
+    accum_ += direction * speed * dt;
 
     // Emit wheel events when accumulator crosses threshold
-    const double threshold = 30.0;
-    while (std::abs(accum_) >= threshold) {
+    while (std::abs(accum_) >= kStepPx) {
         int sign = (accum_ > 0) ? 1 : -1;
-        SendWheelEvent(sign * (int)threshold);
-        accum_ -= sign * threshold;
+        SendWheelEvent(sign * (int)kStepPx);
+        accum_ -= sign * kStepPx;
     }
 }
 
+double ScrollEngine::NextStepIn(int direction, double speed) const {
+    if (exact_) return 0.0;
+    if (speed <= 0.0) return HUGE_VAL;
+    return (kStepPx - direction * accum_) / speed;
+}
+
 } // namespace sn
@@ -1,17 +1,32 @@
 #pragma once
 #include <windows.h>
+#include <functional>
+#include <string>
 
 namespace sn {
 
+class Counter;
+class PatternScroller;
+class DeliveryTable;
+class PanPlanner;
+class ScrollBoundary;
+
 // ─────────────────────────────────────────────────────────
 // ScrollEngine — converts click/hover actions into wheel events
 //
 // Key design choices:
 //  • ClickScroll()  → immediate, one-shot wheel event
-//  • ContinuousScrollTick() → called every ~16ms (60fps timer) while held
+//  • VelocityTick() → one tick at a speed in px/s, covering the time
+//    since the last one (ContinuousScrollTick() derives the speed from
+//    how long the button has been held). Ticks aren't on a
+//    fixed timer: NextStepIn() says when the next wheel step is due and
+//    the app sleeps until then, never less than a display frame (see
+//    TickSchedule)
 //  • SendWheelEvent() → routes to correct target window:
 //      - If targetHwnd_ is set (found via WindowFromPoint), PostMessage
-//        directly to that window regardless of focus
+//        directly to that window regardless of focus — or, once the
+//        DeliveryTable has learned that this kind of window only reacts
+//        to something else, SendInput or WM_VSCROLL
 //      - Otherwise fallback to SendInput (goes to focused window)
 //
 // Using PostMessage + WM_MOUSEWHEEL instead of SendInput avoids
@@ -21,30 +36,92 @@ namespace sn {
 
 class ScrollEngine {
 public:
+    static constexpr double kStepPx = 30.0;   // wheel event size for velocity scrolling
+
     // Single click scroll — emit one batch of wheel events
     void ClickScroll(int direction, int amount_px);
 
-    // Continuous scroll — call per tick while button held or hovering
+    // Continuous scroll at base_speed + accel * hold_seconds px/s (one
+    // frame's worth), for callers without their own speed curve
     void ContinuousScrollTick(int direction, int base_speed, int accel, double hold_seconds);
 
+    // One tick at an explicit speed in px/s, covering `dt` seconds
+    // (StateMachine works out the speed for holds, hovers and coasts)
+    void VelocityTick(int direction, double speed, double dt = 0.016);
+
+    // Seconds until a VelocityTick at this speed has a step to send; 0
+    // when the last tick went out as an exact delta (send every frame).
+    double NextStepIn(int direction, double speed) const;
+
     // Reset accumulator (call when stopping scroll)
-    void Reset() { hold_time_ = 0.0; accum_ = 0.0; }
+    void Reset() { hold_time_ = 0.0; accum_ = 0.0; exact_ = false; }
 
     double HoldTime() const { return hold_time_; }
 
     // Target window to receive scroll events.
     // Set this to the scrollable window found under the cursor.
     // If nullptr, falls back to SendInput (focused window).
-    void SetTargetHwnd(HWND hwnd) { targetHwnd_ = hwnd; }
+    void SetTargetHwnd(HWND hwnd);
     HWND GetTargetHwnd() const    { return targetHwnd_; }
 
+    // Delivery ahead of wheel events (the browser bridge): gets the
+    // target, the exact pixel delta (+ up) and the time it covers (0 for
+    // a one-shot click). Returns true if it took the scroll.
+    using PixelRoute = std::function<bool(HWND target, double dy, double dt)>;
+    void SetPixelRoute(PixelRoute route) { pixelRoute_ = std::move(route); }
+
+    // Scroll targets that expose a ScrollPattern by setting their
+    // position (scroll.backend "uia"); null = wheel events only.
+    void SetPatternScroller(PatternScroller* scroller) { patternScroller_ = scroller; }
+
+    // Deliver the deltas as a synthetic touch pan (scroll.backend
+    // "touch"); null = off. The caller gives it its area and frames.
+    void SetPanPlanner(PanPlanner* planner) { panPlanner_ = planner; }
+
+    // Learn per target app and window class which delivery scrolls it
+    // (null: always PostMessage). The table is fed by OnTargetScrolled().
+    void SetDeliveryTable(DeliveryTable* table);
+
+    // Hold back steps toward an end the target has reached (null: off).
+    // Positions come from scroll bar info, or from `reader` (the UIA
+    // ScrollPattern) for targets without a standard scroll bar.
+    void SetBoundary(ScrollBoundary* boundary, PatternScroller* reader);
+
+    // The target's process reported a scroll-position change of `hwnd`
+    // (WinScrollWatcher).
+    void OnTargetScrolled(HWND hwnd, LONG idObject);
+
 private:
+    // Pixel route, then pattern scroller or touch pan; false → send
+    // wheel events
+    bool DeliverExact(double dy, double dt);
+
+    // Not at the end the step heads for (ScrollBoundary)
+    bool Allowed(int direction);
+    void UpdateWatch();
+
     // Send wheel event. Routes to targetHwnd_ if valid, otherwise SendInput.
     void SendWheelEvent(int delta_px);
 
     double hold_time_ = 0.0;
     double accum_     = 0.0;
+    bool   exact_     = false;        // last tick went through DeliverExact
     HWND   targetHwnd_ = nullptr;  // scrollable window under cursor
+    PixelRoute pixelRoute_;
+    PatternScroller* patternScroller_ = nullptr;
+    DeliveryTable*   deliveryTable_   = nullptr;
+    PanPlanner*      panPlanner_      = nullptr;
+    ScrollBoundary*  boundary_        = nullptr;
+    PatternScroller* positionReader_  = nullptr;
+    std::string      targetKey_;      // DeliveryKey of targetHwnd_ ("" = none)
+    HWND             keyHwnd_ = nullptr;
+    std::string      targetExe_;
+    double           lastSent_ = -1e9;   // last wheel step, GetTickCount64 s
+
+    // scrollnice_wheel_events_total for the target's exe (looked up
+    // when the target moves to another process)
+    DWORD    targetPid_    = 0;
+    Counter* targetEvents_ = nullptr;
 };
 
 } // namespace sn
@@ -0,0 +1,24 @@
+#pragma once
+
+// ───── SIMD build helpers shared by the core kernels ─────
+// SN_SIMD_X86 is defined when x86 intrinsics are available. GCC/Clang
+// need per-function target attributes to emit SSE2/AVX2 code without
+// compiling the whole file for that ISA; MSVC accepts the intrinsics
+// anywhere. Which kernel set runs is decided at runtime by
+// raster::ActiveIsa().
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SN_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(SN_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SN_TARGET_SSE2 __attribute__((target("sse2")))
+#define SN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SN_TARGET_SSE2
+#define SN_TARGET_AVX2
+#endif
@@ -0,0 +1,339 @@
+#include "SoundEngine.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+namespace sn {
+
+namespace {
+
+const double kMaxClipSeconds = 10.0;
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint16_t Read16(const uint8_t* p) { return (uint16_t)(p[0] | p[1] << 8); }
+uint32_t Read32(const uint8_t* p) { return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24; }
+
+} // namespace
+
+// ───── WAV ─────
+bool DecodeWav(const uint8_t* data, size_t size, SoundClip& out, std::string& error) {
+    if (size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+        error = "not a WAV file";
+        return false;
+    }
+
+    const uint8_t* fmt = nullptr;
+    size_t fmtSize = 0;
+    const uint8_t* pcm = nullptr;
+    size_t pcmSize = 0;
+    for (size_t at = 12; at + 8 <= size;) {
+        const uint32_t chunk = Read32(data + at + 4);
+        const uint8_t* body  = data + at + 8;
+        const size_t avail   = size - at - 8;
+        if (std::memcmp(data + at, "fmt ", 4) == 0) { fmt = body; fmtSize = std::min<size_t>(chunk, avail); }
+        if (std::memcmp(data + at, "data", 4) == 0) { pcm = body; pcmSize = std::min<size_t>(chunk, avail); }
+        if (chunk > avail) break;
+        at += 8 + (size_t)chunk + (chunk & 1);
+    }
+    if (!fmt || fmtSize < 16 || !pcm) {
+        error = "missing fmt or data chunk";
+        return false;
+    }
+
+    uint16_t format     = Read16(fmt);
+    const int channels  = Read16(fmt + 2);
+    const int rate      = (int)Read32(fmt + 4);
+    const int align     = Read16(fmt + 12);
+    const int bits      = Read16(fmt + 14);
+    if (format == 0xFFFE && fmtSize >= 26) format = Read16(fmt + 24);   // WAVE_FORMAT_EXTENSIBLE sub-format
+    const bool isFloat  = format == 3 && bits == 32;
+    const bool isInt    = format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+    if (!isFloat && !isInt) {
+        error = "unsupported sample format (PCM 8/16/24/32-bit or 32-bit float only)";
+        return false;
+    }
+    if (channels < 1 || channels > 8 || rate < 8000 || rate > 384000 || align != channels * bits / 8) {
+        error = "bad fmt chunk";
+        return false;
+    }
+
+    const size_t frames = pcmSize / (size_t)align;
+    if (frames > (size_t)(rate * kMaxClipSeconds)) {
+        error = "longer than 10 s";
+        return false;
+    }
+
+    const int bytes = bits / 8;
+    out.sampleRate = rate;
+    out.samples.assign(frames, 0.0f);
+    for (size_t i = 0; i < frames; i++) {
+        const uint8_t* frame = pcm + i * (size_t)align;
+        float sum = 0.0f;
+        for (int c = 0; c < channels; c++) {
+            const uint8_t* p = frame + c * bytes;
+            float v;
+            if (isFloat) {
+                std::memcpy(&v, p, 4);
+                if (!std::isfinite(v)) v = 0.0f;
+            } else if (bits == 8) {
+                v = (p[0] - 128) / 128.0f;
+            } else if (bits == 16) {
+                v = (int16_t)Read16(p) / 32768.0f;
+            } else if (bits == 24) {
+                v = (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) / 2147483648.0f;
+            } else {
+                v = (int32_t)Read32(p) / 2147483648.0f;
+            }
+            sum += v;
+        }
+        out.samples[i] = std::clamp(sum / channels, -1.0f, 1.0f);
+    }
+    return true;
+}
+
+bool LoadWavFile(const std::string& path, SoundClip& out, std::string& error) {
+    MappedFile file;
+    if (!file.Open(path)) {
+        error = "cannot open";
+        return false;
+    }
+    return DecodeWav(file.Data(), file.Size(), out, error);
+}
+
+// Two damped partials, 8 ms: short enough to sit under a scroll step
+SoundClip SynthesizeClick(int sampleRate) {
+    const double kPi = 3.14159265358979323846;
+    SoundClip clip;
+    clip.sampleRate = sampleRate;
+    clip.samples.resize((size_t)(sampleRate * 0.008));
+    for (size_t i = 0; i < clip.samples.size(); i++) {
+        const double t = (double)i / sampleRate;
+        const double v = 0.55 * std::sin(2 * kPi * 2200 * t) * std::exp(-t / 0.0012) +
+                         0.25 * std::sin(2 * kPi * 5100 * t) * std::exp(-t / 0.0005);
+        clip.samples[i] = (float)v;
+    }
+    return clip;
+}
+
+// ───── Control (UI thread) ─────
+void SoundEngine::Start(std::unique_ptr<AudioSink> sink) {
+    Stop();
+    if (!sink) return;
+    sink_ = std::move(sink);
+    stop_ = false;
+    state_ = kOpening;
+    thread_ = std::thread(&SoundEngine::Run, this);
+}
+
+void SoundEngine::Stop() {
+    if (thread_.joinable()) {
+        stop_ = true;
+        sink_->Interrupt();
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wake_.notify_all();
+        }
+        thread_.join();
+    }
+    sink_.reset();
+    state_ = kStopped;
+    DrainCommands();
+    FreeRetired();
+}
+
+SoundEngine::~SoundEngine() {
+    Stop();
+    delete clip_;
+}
+
+// No mixer: take the clips that were on their way to it, drop the
+// triggers (a click from before a restart is no use after it).
+void SoundEngine::DrainCommands() {
+    Command cmd;
+    while (commands_.Pop(cmd)) {
+        if (cmd.type != Command::SetClip) continue;
+        delete clip_;
+        clip_ = cmd.clip;
+    }
+}
+
+bool SoundEngine::IsAvailable() const {
+    const int s = state_.load(std::memory_order_relaxed);
+    return s == kOpening || s == kRunning;
+}
+
+void SoundEngine::SetClip(SoundClip clip) {
+    FreeRetired();
+    auto* fresh = new SoundClip(std::move(clip));
+    if (IsRunning() && state_ == kFailed) Stop();   // the mixer has exited
+    if (!IsRunning()) {
+        delete clip_;
+        clip_ = fresh;
+        return;
+    }
+    // The mixer drains the queue every period (or wakes up for it)
+    while (!commands_.Push(Command{Command::SetClip, 0.0f, 0, fresh})) {
+        Wake();
+        std::this_thread::yield();
+    }
+    Wake();
+}
+
+bool SoundEngine::Play(float gain) {
+    if (!IsAvailable()) return false;
+    if (!commands_.Push(Command{Command::PlayClip, gain, NowNs(), nullptr})) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    Wake();
+    return true;
+}
+
+SoundStats SoundEngine::Stats() const {
+    SoundStats s;
+    s.played     = played_.load();
+    s.dropped    = dropped_.load();
+    s.periods    = periods_.load();
+    s.lastUs     = lastUs_.load();
+    s.minUs      = minUs_.load();
+    s.maxUs      = maxUs_.load();
+    s.meanUs     = s.played ? sumUs_.load() / s.played : 0.0;
+    s.sampleRate = sampleRate_.load();
+    return s;
+}
+
+void SoundEngine::Wake() {
+    if (sleeping_.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+}
+
+void SoundEngine::FreeRetired() {
+    SoundClip* clip;
+    while (retired_.Pop(clip)) delete clip;
+}
+
+// ───── Mixer thread ─────
+void SoundEngine::Run() {
+    AudioFormat format;
+    while (!stop_) {
+        if (!sink_->Open(format)) {
+            state_ = kFailed;
+            break;
+        }
+        state_ = kRunning;
+        sampleRate_ = format.sampleRate;
+
+        int64_t lastActive = NowNs();
+        for (;;) {
+            size_t frames = 0;
+            float* out = sink_->Acquire(frames);
+            if (!out) break;
+
+            const int64_t now   = NowNs();
+            const double queued = sink_->QueuedSeconds();
+            Command cmd;
+            while (commands_.Pop(cmd)) {
+                if (cmd.type == Command::SetClip) {
+                    Retire(clip_);
+                    clip_ = cmd.clip;
+                    continue;
+                }
+                Voice* free = nullptr;
+                for (auto& v : voices_)
+                    if (!v.clip) { free = &v; break; }
+                if (!clip_ || clip_->samples.empty() || !free) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                *free = Voice{clip_, 0.0, cmd.gain};
+                Record((now - cmd.triggerNs) / 1000.0 + queued * 1e6);
+            }
+
+            const bool active = Mix(out, frames, format.channels, format.sampleRate);
+            sink_->Commit(frames);
+            periods_.fetch_add(1, std::memory_order_relaxed);
+
+            if (active) {
+                lastActive = now;
+            } else if (now - lastActive > (int64_t)(kIdlePauseSeconds * 1e9)) {
+                sink_->Pause();
+                if (!WaitForTrigger()) break;
+                sink_->Resume();
+                lastActive = NowNs();
+            }
+        }
+        sink_->Close();
+        sampleRate_ = 0;
+        for (auto& v : voices_) v.clip = nullptr;
+
+        // The device went away (unplugged, default device switched):
+        // open whatever is the default now, after a moment
+        if (!stop_) {
+            state_ = kOpening;
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wake_.wait_for(lock, std::chrono::milliseconds(500), [&] { return stop_.load(); });
+        }
+    }
+}
+
+// Linear interpolation at clipRate / deviceRate; returns whether any
+// voice played this period.
+bool SoundEngine::Mix(float* out, size_t frames, int channels, int sampleRate) {
+    std::fill(out, out + frames * channels, 0.0f);
+    bool active = false;
+    for (auto& v : voices_) {
+        if (!v.clip) continue;
+        active = true;
+        const float* s    = v.clip->samples.data();
+        const size_t n    = v.clip->samples.size();
+        const double step = (double)v.clip->sampleRate / sampleRate;
+        size_t i = 0;
+        for (; i < frames; i++) {
+            const size_t k = (size_t)v.pos;
+            if (k >= n) break;
+            const float frac = (float)(v.pos - k);
+            const float next = k + 1 < n ? s[k + 1] : 0.0f;
+            const float x    = (s[k] + (next - s[k]) * frac) * v.gain;
+            for (int c = 0; c < channels; c++) out[i * channels + c] += x;
+            v.pos += step;
+        }
+        if (i < frames) v.clip = nullptr;
+    }
+    if (active)
+        for (size_t i = 0; i < frames * channels; i++) out[i] = std::clamp(out[i], -1.0f, 1.0f);
+    return active;
+}
+
+void SoundEngine::Retire(SoundClip* clip) {
+    if (!clip) return;
+    for (auto& v : voices_)
+        if (v.clip == clip) v.clip = nullptr;
+    retired_.Push(clip);   // can't be full: see retired_
+}
+
+void SoundEngine::Record(double latencyUs) {
+    const uint64_t n = played_.load(std::memory_order_relaxed);
+    lastUs_.store(latencyUs, std::memory_order_relaxed);
+    if (n == 0 || latencyUs < minUs_.load(std::memory_order_relaxed)) minUs_.store(latencyUs, std::memory_order_relaxed);
+    if (n == 0 || latencyUs > maxUs_.load(std::memory_order_relaxed)) maxUs_.store(latencyUs, std::memory_order_relaxed);
+    sumUs_.store(sumUs_.load(std::memory_order_relaxed) + latencyUs, std::memory_order_relaxed);
+    played_.store(n + 1, std::memory_order_release);
+}
+
+bool SoundEngine::WaitForTrigger() {
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    sleeping_.store(true, std::memory_order_seq_cst);
+    wake_.wait(lock, [&] { return stop_.load() || !commands_.Empty(); });
+    sleeping_.store(false, std::memory_order_relaxed);
+    return !stop_;
+}
+
+} // namespace sn
@@ -0,0 +1,165 @@
+#pragma once
+#include "AudioSink.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sn {
+
+// ───── Clips ─────
+// Mono float PCM at the clip's own rate; the mixer steps through it at
+// clipRate / deviceRate, so clips are never resampled up front.
+struct SoundClip {
+    int                sampleRate = 48000;
+    std::vector<float> samples;
+};
+
+// PCM 8/16/24/32-bit or 32-bit float WAV, any channel count (mixed
+// down to mono).
+bool DecodeWav(const uint8_t* data, size_t size, SoundClip& out, std::string& error);
+bool LoadWavFile(const std::string& path, SoundClip& out, std::string& error);
+
+// The built-in click: a few ms of decaying tone.
+SoundClip SynthesizeClick(int sampleRate = 48000);
+
+// ───── Stats ─────
+// Trigger-to-sample latency: from Play() to the clip's first frame
+// reaching the device, i.e. the wait for the next period plus what the
+// device already had queued (AudioSink::QueuedSeconds).
+struct SoundStats {
+    uint64_t played     = 0;
+    uint64_t dropped    = 0;   // queue full or no voice free
+    uint64_t periods    = 0;   // buffers mixed
+    double   lastUs     = 0.0;
+    double   minUs      = 0.0;
+    double   maxUs      = 0.0;
+    double   meanUs     = 0.0;
+    int      sampleRate = 0;   // of the open device (0 = not open)
+};
+
+// ─────────────────────────────────────────────────────────
+// SoundEngine — low-latency click playback
+//
+// The clip is decoded (or synthesised) into memory when the config is
+// applied; Play() only pushes a trigger onto a lock-free single-
+// producer queue that the mixer thread drains at the start of every
+// period, so the click path never touches the disk, the system sound
+// scheme or a lock.
+//
+// Threading: Start/Stop/SetClip/Play/Stats are for one thread (the UI
+// thread); the mixer thread owns the sink, the voices and the current
+// clip. A replaced clip is handed back through a second queue and
+// freed on the UI thread: the mixer never allocates or frees.
+//
+// After kIdlePauseSeconds without a trigger the mixer pauses the
+// stream and sleeps; the next Play() wakes it (that one click pays
+// for restarting the stream).
+// ─────────────────────────────────────────────────────────
+class SoundEngine {
+public:
+    SoundEngine() = default;
+    ~SoundEngine();
+    SoundEngine(const SoundEngine&) = delete;
+    SoundEngine& operator=(const SoundEngine&) = delete;
+
+    // Run the mixer on `sink`. Returns at once; the sink opens on the
+    // mixer thread (IsAvailable() turns false if it can't).
+    void Start(std::unique_ptr<AudioSink> sink);
+    void Stop();
+
+    bool IsRunning() const { return thread_.joinable(); }
+    // Started and the device hasn't failed: Play() will be heard.
+    bool IsAvailable() const;
+
+    // Replace the click (takes effect for the next Play).
+    void SetClip(SoundClip clip);
+
+    // Lock-free. False if the engine isn't available or the queue is full.
+    bool Play(float gain = 1.0f);
+
+    SoundStats Stats() const;
+
+    static constexpr double kIdlePauseSeconds = 30.0;
+
+private:
+    enum State : int { kStopped, kOpening, kRunning, kFailed };
+
+    struct Command {
+        enum Type : uint8_t { PlayClip, SetClip } type;
+        float      gain;
+        int64_t    triggerNs;   // steady_clock, at Play()
+        SoundClip* clip;        // SetClip: the new clip (owned by the mixer from then on)
+    };
+
+    // Single-producer, single-consumer ring of T (power-of-two size)
+    template <typename T, size_t N>
+    struct Ring {
+        T                   items[N];
+        std::atomic<size_t> head{0};   // next write (producer)
+        std::atomic<size_t> tail{0};   // next read (consumer)
+
+        bool Push(const T& v) {
+            const size_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) == N) return false;
+            items[h % N] = v;
+            head.store(h + 1, std::memory_order_seq_cst);
+            return true;
+        }
+        bool Pop(T& v) {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_seq_cst)) return false;
+            v = items[t % N];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+        bool Empty() const {
+            return tail.load(std::memory_order_relaxed) == head.load(std::memory_order_seq_cst);
+        }
+    };
+
+    struct Voice {
+        const SoundClip* clip = nullptr;
+        double           pos  = 0.0;   // in clip frames
+        float            gain = 1.0f;
+    };
+
+    void Run();
+    bool Mix(float* out, size_t frames, int channels, int sampleRate);
+    void Retire(SoundClip* clip);
+    void FreeRetired();
+    void DrainCommands();
+    void Record(double latencyUs);
+    void Wake();
+    bool WaitForTrigger();
+
+    std::unique_ptr<AudioSink> sink_;
+    std::thread                thread_;
+    std::atomic<int>           state_{kStopped};
+    std::atomic<bool>          stop_{false};
+
+    // Every retired clip came in through a SetClip command and SetClip
+    // frees the retired ones first, so retired_ can't fill up.
+    Ring<Command, 64>     commands_;   // UI → mixer
+    Ring<SoundClip*, 128> retired_;    // mixer → UI, for freeing
+
+    // Idle pause: the mixer sleeps on wake_ while sleeping_ is set
+    std::mutex              wakeMutex_;
+    std::condition_variable wake_;
+    std::atomic<bool>       sleeping_{false};
+
+    // Mixer thread only (the UI thread's while no mixer runs)
+    SoundClip* clip_ = nullptr;
+    Voice      voices_[8];
+
+    // Written by the mixer, read by Stats()
+    std::atomic<uint64_t> played_{0}, dropped_{0}, periods_{0};
+    std::atomic<double>   lastUs_{0.0}, minUs_{0.0}, maxUs_{0.0}, sumUs_{0.0};
+    std::atomic<int>      sampleRate_{0};
+};
+
+} // namespace sn
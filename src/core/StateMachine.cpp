@@ -1,2 +1,330 @@
-// StateMachine is header-only.
 #include "StateMachine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sn {
+
+namespace {
+
+constexpr size_t kStateCount = (size_t)AppState::Count;
+constexpr size_t kEventCount = (size_t)ScrollEvent::Count;
+constexpr AppState kNone     = AppState::Count;   // no parent / no initial child / internal
+
+const double kMaxHoldSpeed   = 200.0;   // same cap ScrollEngine always had
+const double kHoverSpeedBump = 0.5;     // hover ticks were always base + 1 * 0.5 s
+const double kCoastStopSpeed = 4.0;     // below this a coast is over
+
+} // namespace
+
+// ─────── Transition table ───────
+// Guards and actions are static members here so they can reach the
+// machine's gesture data; the table itself is checked and indexed by
+// the compiler below.
+struct StateMachine::Table {
+    using Guard  = bool (*)(const StateMachine&, const ScrollInput&);
+    using Action = void (*)(StateMachine&, const ScrollInput&);
+
+    struct StateInfo {
+        const char* name;
+        AppState    parent;
+        AppState    initial;   // composite states: child entered by default
+        Action      entry;
+        Action      exit;
+    };
+
+    struct Row {
+        AppState    source;
+        ScrollEvent event;
+        Guard       guard;    // nullptr = always
+        AppState    target;   // kNone = internal (no exit/entry)
+        Action      action;   // nullptr = none
+    };
+
+    struct Span { uint8_t first, count; };
+    struct Index { Span rows[kStateCount][kEventCount]; };
+
+    // ───── Sink ─────
+    static void StartTicks(StateMachine& m)  { if (m.sink_) m.sink_->StartTicks(); }
+    static void StopTicks(StateMachine& m)   { if (m.sink_) m.sink_->StopTicks(); }
+    static void ResetScroll(StateMachine& m) { if (m.sink_) m.sink_->ResetScroll(); }
+    static void Emit(StateMachine& m, double speed, bool steady) {
+        if (m.sink_) m.sink_->ScrollTick(m.direction_, speed, steady);
+    }
+
+    static double CoastSpeedAt(const StateMachine& m, double time) {
+        if (m.tuning_.coast_ms <= 0) return 0.0;
+        return m.coastSpeed_ * std::exp(-(time - m.coastTime_) * 1000.0 / m.tuning_.coast_ms);
+    }
+
+    // ───── Entry / exit ─────
+    static void EnterScrolling(StateMachine& m, const ScrollInput&) { StartTicks(m); }
+    static void ExitScrolling(StateMachine& m, const ScrollInput&) {
+        StopTicks(m);
+        ResetScroll(m);
+    }
+    static void EnterCoasting(StateMachine& m, const ScrollInput& in) {
+        m.coastSpeed_ = m.lastSpeed_;
+        m.coastTime_  = in.time;
+        StartTicks(m);
+    }
+    static void ExitActive(StateMachine& m, const ScrollInput&) { m.held_ = 0; }
+
+    // ───── Guards ─────
+    static bool ClickMode(const StateMachine& m, const ScrollInput&) { return m.mode_ != ScrollMode::HoverAuto; }
+    static bool HoverMode(const StateMachine& m, const ScrollInput&) { return m.mode_ == ScrollMode::HoverAuto; }
+    static bool OtherButtonDown(const StateMachine& m, const ScrollInput& in) {
+        return in.button != m.holdButton_;
+    }
+    static bool HoldButtonUp(const StateMachine& m, const ScrollInput& in) {
+        return in.button == m.holdButton_;
+    }
+    static bool HoldButtonUpCoast(const StateMachine& m, const ScrollInput& in) {
+        return HoldButtonUp(m, in) && m.tuning_.coast_ms > 0 && m.lastSpeed_ > kCoastStopSpeed;
+    }
+    static bool ButtonStillHeld(const StateMachine& m, const ScrollInput&) { return m.held_ != 0; }
+    static bool HoverDirectionChanged(const StateMachine& m, const ScrollInput& in) {
+        return (in.topHalf ? 1 : -1) != m.direction_;
+    }
+    static bool CoastDone(const StateMachine& m, const ScrollInput& in) {
+        return CoastSpeedAt(m, in.time) < kCoastStopSpeed;
+    }
+
+    // ───── Actions ─────
+    static void SetMode(StateMachine& m, const ScrollInput& in) { m.mode_ = in.mode; }
+
+    // Click: one step right away, then Holding scrolls continuously
+    static void PressHold(StateMachine& m, const ScrollInput& in) {
+        m.holdButton_ = in.button;
+        m.direction_  = m.dirOf_[in.button & 1];
+        m.holdStart_  = in.time;
+        m.lastSpeed_  = 0.0;
+        if (m.sink_) m.sink_->ClickScroll(m.direction_, m.tuning_.scroll_amount);
+    }
+
+    // Both buttons were down and one let go: hold on with the other,
+    // its acceleration starting over
+    static void ResumeHold(StateMachine& m, const ScrollInput& in) {
+        m.holdButton_ = (m.held_ & 1) ? 0 : 1;
+        m.direction_  = m.dirOf_[m.holdButton_];
+        m.holdStart_  = in.time;
+        m.lastSpeed_  = 0.0;
+    }
+
+    static void SetHoverDirection(StateMachine& m, const ScrollInput& in) {
+        m.direction_ = in.topHalf ? 1 : -1;
+    }
+
+    static void HoldTick(StateMachine& m, const ScrollInput& in) {
+        const double held = std::max(0.0, in.time - m.holdStart_);
+        m.lastSpeed_ = std::min(m.tuning_.continuous_speed + m.tuning_.continuous_accel * held, kMaxHoldSpeed);
+        Emit(m, m.lastSpeed_, m.tuning_.continuous_accel <= 0.0 || m.lastSpeed_ >= kMaxHoldSpeed);
+    }
+
+    static void HoverTick(StateMachine& m, const ScrollInput&) {
+        Emit(m, m.tuning_.hover_speed + kHoverSpeedBump, true);
+    }
+
+    static void SetScript(StateMachine& m, const ScrollInput& in) {
+        m.direction_   = in.direction >= 0 ? 1 : -1;
+        m.scriptSpeed_ = in.speed > 0.0 ? std::min(in.speed, kMaxHoldSpeed)
+                                        : m.tuning_.hover_speed + kHoverSpeedBump;
+        StartTicks(m);   // already ticking when the script changes speed
+    }
+
+    static void ScriptTick(StateMachine& m, const ScrollInput&) { Emit(m, m.scriptSpeed_, true); }
+
+    static void CoastTick(StateMachine& m, const ScrollInput& in) {
+        m.coastSpeed_ = CoastSpeedAt(m, in.time);
+        m.coastTime_  = in.time;
+        Emit(m, m.coastSpeed_, false);
+    }
+
+    static constexpr StateInfo kStates[kStateCount] = {
+        /* Disabled  */ {"Disabled",  kNone,             kNone,          nullptr,        nullptr},
+        /* Enabled   */ {"Enabled",   kNone,             AppState::Active, nullptr,      nullptr},
+        /* Edit      */ {"Edit",      AppState::Enabled, kNone,          nullptr,        nullptr},
+        /* Active    */ {"Active",    AppState::Enabled, AppState::Idle, nullptr,        ExitActive},
+        /* Idle      */ {"Idle",      AppState::Active,  kNone,          nullptr,        nullptr},
+        /* Holding   */ {"Holding",   AppState::Active,  kNone,          EnterScrolling, ExitScrolling},
+        /* Suspended */ {"Suspended", AppState::Active,  kNone,          nullptr,        nullptr},
+        /* Coasting  */ {"Coasting",  AppState::Active,  kNone,          EnterCoasting,  ExitScrolling},
+        /* Hovering  */ {"Hovering",  AppState::Active,  kNone,          EnterScrolling, ExitScrolling},
+        /* Scripted  */ {"Scripted",  AppState::Active,  kNone,          EnterScrolling, ExitScrolling},
+    };
+
+    // Rows for one (state, event) must be adjacent; they are tried in
+    // order and the first passing guard wins. Events a leaf doesn't
+    // handle bubble up to its parents.
+    using S = AppState;
+    using E = ScrollEvent;
+    static constexpr Row kRows[] = {
+        {S::Disabled,  E::Enable,      nullptr,               S::Enabled,   nullptr},
+        {S::Disabled,  E::ModeChanged, nullptr,               kNone,        SetMode},
+
+        {S::Enabled,   E::Disable,     nullptr,               S::Disabled,  nullptr},
+        {S::Enabled,   E::ModeChanged, nullptr,               kNone,        SetMode},
+
+        {S::Edit,      E::ToggleEdit,  nullptr,               S::Active,    nullptr},
+
+        {S::Active,    E::ToggleEdit,  nullptr,               S::Edit,      nullptr},
+        {S::Active,    E::ModeChanged, nullptr,               S::Idle,      SetMode},
+        {S::Active,    E::Cancel,      nullptr,               S::Idle,      nullptr},
+
+        {S::Idle,      E::Press,       ClickMode,             S::Holding,   PressHold},
+        {S::Idle,      E::Hover,       HoverMode,             S::Hovering,  SetHoverDirection},
+        {S::Idle,      E::ScriptStart, nullptr,               S::Scripted,  SetScript},
+
+        {S::Holding,   E::Press,       OtherButtonDown,       S::Suspended, nullptr},
+        {S::Holding,   E::Release,     HoldButtonUpCoast,     S::Coasting,  nullptr},
+        {S::Holding,   E::Release,     HoldButtonUp,          S::Idle,      nullptr},
+        {S::Holding,   E::Tick,        nullptr,               kNone,        HoldTick},
+
+        {S::Suspended, E::Release,     ButtonStillHeld,       S::Holding,   ResumeHold},
+        {S::Suspended, E::Release,     nullptr,               S::Idle,      nullptr},
+
+        {S::Coasting,  E::Press,       ClickMode,             S::Holding,   PressHold},
+        {S::Coasting,  E::Tick,        CoastDone,             S::Idle,      nullptr},
+        {S::Coasting,  E::Tick,        nullptr,               kNone,        CoastTick},
+
+        {S::Hovering,  E::Hover,       HoverDirectionChanged, S::Hovering,  SetHoverDirection},
+        {S::Hovering,  E::Leave,       nullptr,               S::Idle,      nullptr},
+        {S::Hovering,  E::Tick,        nullptr,               kNone,        HoverTick},
+
+        {S::Scripted,  E::Press,       ClickMode,             S::Holding,   PressHold},
+        {S::Scripted,  E::Hover,       HoverMode,             S::Hovering,  SetHoverDirection},
+        {S::Scripted,  E::ScriptStart, nullptr,               kNone,        SetScript},
+        {S::Scripted,  E::ScriptStop,  nullptr,               S::Idle,      nullptr},
+        {S::Scripted,  E::Tick,        nullptr,               kNone,        ScriptTick},
+    };
+    static constexpr size_t kRowCount = sizeof(kRows) / sizeof(kRows[0]);
+
+    static constexpr bool RowsGrouped() {
+        for (size_t i = 1; i < kRowCount; i++) {
+            if (kRows[i].source == kRows[i - 1].source && kRows[i].event == kRows[i - 1].event) continue;
+            for (size_t j = 0; j < i; j++)
+                if (kRows[j].source == kRows[i].source && kRows[j].event == kRows[i].event) return false;
+        }
+        return true;
+    }
+
+    static constexpr bool StatesConsistent() {
+        for (size_t s = 0; s < kStateCount; s++) {
+            const StateInfo& st = kStates[s];
+            if (st.initial != kNone && kStates[(size_t)st.initial].parent != (AppState)s) return false;
+            if (st.parent != kNone && kStates[(size_t)st.parent].initial == kNone) return false;
+        }
+        return true;
+    }
+
+    static constexpr Index BuildIndex() {
+        Index index{};
+        for (size_t r = kRowCount; r-- > 0;) {
+            Span& span = index.rows[(size_t)kRows[r].source][(size_t)kRows[r].event];
+            span.first = (uint8_t)r;
+            span.count++;
+        }
+        return index;
+    }
+};
+
+// ───── Dispatch ─────
+bool StateMachine::Dispatch(ScrollEvent ev, const ScrollInput& in) {
+    static_assert(Table::kRowCount <= StateMachineStats::kMaxTransitions, "raise StateMachineStats::kMaxTransitions");
+    static_assert(Table::RowsGrouped(), "rows for one (state, event) must be adjacent");
+    static_assert(Table::StatesConsistent(), "state hierarchy is inconsistent");
+    static constexpr Table::Index kIndex = Table::BuildIndex();
+
+    stats_.dispatched++;
+
+    // Which buttons are down is tracked whatever state handles the event
+    const int button = in.button & 1;
+    if (ev == ScrollEvent::Press) {
+        held_ |= (uint8_t)(1u << button);
+        dirOf_[button] = mode_ == ScrollMode::SplitHold ? (in.topHalf ? 1 : -1)
+                                                        : (button == 0 ? 1 : -1);
+    } else if (ev == ScrollEvent::Release) {
+        held_ &= (uint8_t)~(1u << button);
+    }
+
+    for (AppState s = state_; s != kNone; s = Table::kStates[(size_t)s].parent) {
+        const Table::Span span = kIndex.rows[(size_t)s][(size_t)ev];
+        for (size_t r = span.first; r < (size_t)span.first + span.count; r++) {
+            const Table::Row& row = Table::kRows[r];
+            if (row.guard && !row.guard(*this, in)) continue;
+            stats_.transitions[r]++;
+
+            if (row.target == kNone) {
+                if (row.action) row.action(*this, in);
+                return true;
+            }
+
+            // The transition leaves everything below the lowest state that
+            // strictly contains the source and contains the target (so a
+            // self-transition exits and re-enters).
+            AppState domain = Table::kStates[(size_t)s].parent;
+            auto contains = [](AppState outer, AppState inner) {
+                for (; inner != kNone; inner = Table::kStates[(size_t)inner].parent)
+                    if (inner == outer) return true;
+                return false;
+            };
+            while (domain != kNone && !contains(domain, row.target))
+                domain = Table::kStates[(size_t)domain].parent;
+
+            for (AppState x = state_; x != domain; x = Table::kStates[(size_t)x].parent) Exit(x, in);
+            if (row.action) row.action(*this, in);
+
+            AppState path[kStateCount];
+            size_t depth = 0;
+            for (AppState x = row.target; x != domain; x = Table::kStates[(size_t)x].parent) path[depth++] = x;
+            while (depth) Enter(path[--depth], in);
+
+            AppState leaf = row.target;
+            while (Table::kStates[(size_t)leaf].initial != kNone) {
+                leaf = Table::kStates[(size_t)leaf].initial;
+                Enter(leaf, in);
+            }
+            state_ = leaf;
+            return true;
+        }
+    }
+    stats_.unhandled++;
+    return false;
+}
+
+void StateMachine::Enter(AppState s, const ScrollInput& in) {
+    if (auto entry = Table::kStates[(size_t)s].entry) entry(*this, in);
+}
+
+void StateMachine::Exit(AppState s, const ScrollInput& in) {
+    if (auto exit = Table::kStates[(size_t)s].exit) exit(*this, in);
+}
+
+bool StateMachine::IsIn(AppState s) const {
+    for (AppState x = state_; x != kNone; x = Table::kStates[(size_t)x].parent)
+        if (x == s) return true;
+    return false;
+}
+
+// ───── Introspection ─────
+size_t StateMachine::TransitionCount() { return Table::kRowCount; }
+
+TransitionInfo StateMachine::Transition(size_t row) {
+    const Table::Row& r = Table::kRows[row];
+    const bool internal = r.target == kNone;
+    return TransitionInfo{r.source, r.event, internal ? r.source : r.target, internal};
+}
+
+const char* StateMachine::StateName(AppState s) {
+    return s < AppState::Count ? Table::kStates[(size_t)s].name : "?";
+}
+
+const char* StateMachine::EventName(ScrollEvent e) {
+    static const char* const kNames[kEventCount] = {
+        "Enable", "Disable", "ToggleEdit", "Press", "Release",
+        "Hover", "Leave", "Tick", "ModeChanged", "Cancel",
+        "ScriptStart", "ScriptStop",
+    };
+    return e < ScrollEvent::Count ? kNames[(size_t)e] : "?";
+}
+
+} // namespace sn
@@ -1,49 +1,152 @@
 #pragma once
-#include <functional>
+#include "Config.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace sn {
 
-enum class AppState {
+// ─────────────────────────────────────────────────────────
+// StateMachine — what the zone is doing, as a hierarchical state machine
+//
+//   Disabled
+//   Enabled
+//   ├─ Edit                    zone being moved/resized
+//   └─ Active
+//      ├─ Idle
+//      ├─ Holding              button held: continuous scroll, accelerating
+//      ├─ Suspended            both buttons held: paused until one lets go
+//      ├─ Coasting             hold released: speed decays (scroll.coast_ms)
+//      ├─ Hovering             hover mode: cursor over one half
+//      └─ Scripted             continuous scroll started over the command
+//                              channel; the user's own press/hover wins
+//
+// Transitions live in one constexpr table (StateMachine.cpp) of
+// {state, event, guard, target, action} rows. The table is checked
+// and indexed by (state, event) at compile time; Dispatch() walks from
+// the current leaf up through its parents, takes the first row whose
+// guard passes, and runs exit → action → entry along the way. Guards
+// and actions are plain function pointers: no allocation, no
+// std::function. Every row has a counter (Stats()).
+//
+// Time is passed in with each event (seconds), and everything the
+// machine does to the outside world goes through a ScrollSink, so the
+// machine itself is platform-neutral and can be driven by a benchmark.
+// ─────────────────────────────────────────────────────────
+
+enum class AppState : uint8_t {
     Disabled,
+    Enabled,     // composite: Edit | Active
+    Edit,
+    Active,      // composite: Idle | Holding | Suspended | Coasting | Hovering | Scripted
     Idle,
-    Edit
+    Holding,
+    Suspended,
+    Coasting,
+    Hovering,
+    Scripted,
+    Count
+};
+
+enum class ScrollEvent : uint8_t {
+    Enable,
+    Disable,
+    ToggleEdit,
+    Press,         // button down in the zone (button, topHalf)
+    Release,       // button up (button)
+    Hover,         // cursor moved over the zone (topHalf)
+    Leave,         // cursor left the zone
+    Tick,          // scroll timer (when a step is due, once a frame at the most)
+    ModeChanged,   // (mode)
+    Cancel,        // drop whatever scroll is running (config applied, ...)
+    ScriptStart,   // command channel: scroll continuously (direction, speed)
+    ScriptStop,
+    Count
+};
+
+struct ScrollInput {
+    int        button    = 0;       // 0 = left, 1 = right
+    bool       topHalf   = false;
+    ScrollMode mode      = ScrollMode::ClickHold;
+    double     time      = 0.0;     // seconds, any monotonic origin
+    int        direction = 1;       // ScriptStart: +1 up, -1 down
+    double     speed     = 0.0;     // ScriptStart: 0 = the hover speed
+};
+
+// Effects of the machine on the app (timers, wheel events).
+class ScrollSink {
+public:
+    virtual ~ScrollSink() = default;
+    virtual void StartTicks() = 0;                             // Tick events from now on; while
+                                                               // ticking: the speed changed, tick soon
+    virtual void StopTicks() = 0;
+    virtual void ClickScroll(int direction, int amount) = 0;   // click feedback + one step
+    // One tick at `speed` px/s; `steady`: the speed stays until the
+    // next event, so the next Tick can wait until a step is due
+    virtual void ScrollTick(int direction, double speed, bool steady) = 0;
+    virtual void ResetScroll() = 0;                            // drop partial steps
+};
+
+struct StateMachineStats {
+    static constexpr size_t kMaxTransitions = 48;
+    uint64_t dispatched = 0;
+    uint64_t unhandled  = 0;                      // no row matched
+    uint64_t transitions[kMaxTransitions] = {};   // per table row
+};
+
+struct TransitionInfo {
+    AppState    source;
+    ScrollEvent event;
+    AppState    target;   // == source for internal transitions
+    bool        internal;
 };
 
 class StateMachine {
 public:
-    using StateChangeCallback = std::function<void(AppState oldState, AppState newState)>;
+    void SetSink(ScrollSink* sink) { sink_ = sink; }
+    void SetTuning(const ScrollConfig& scroll) { tuning_ = scroll; }
 
-    AppState State() const { return state_; }
-    void SetCallback(StateChangeCallback cb) { callback_ = cb; }
+    // Returns false if no transition handled the event.
+    bool Dispatch(ScrollEvent ev, const ScrollInput& in = {});
 
-    void SetEnabled(bool on) {
-        if (on && state_ == AppState::Disabled) TransitionTo(AppState::Idle);
-        else if (!on && state_ != AppState::Disabled) TransitionTo(AppState::Disabled);
-    }
+    AppState State() const { return state_; }   // current leaf
+    bool IsIn(AppState s) const;                // leaf or one of its parents
 
-    void ToggleEnabled() { SetEnabled(state_ == AppState::Disabled); }
+    void SetEnabled(bool on) { Dispatch(on ? ScrollEvent::Enable : ScrollEvent::Disable); }
+    void ToggleEnabled()     { SetEnabled(!IsEnabled()); }
+    void ToggleEdit()        { Dispatch(ScrollEvent::ToggleEdit); }
 
-    void ToggleEdit() {
-        if (state_ == AppState::Edit) TransitionTo(AppState::Idle);
-        else if (state_ != AppState::Disabled) TransitionTo(AppState::Edit);
-    }
+    bool IsEnabled() const { return IsIn(AppState::Enabled); }
+    bool IsEditing() const { return state_ == AppState::Edit; }
 
-    bool IsEnabled()  const { return state_ != AppState::Disabled; }
-    bool IsEditing()  const { return state_ == AppState::Edit; }
+    const StateMachineStats& Stats() const { return stats_; }
+    static size_t TransitionCount();
+    static TransitionInfo Transition(size_t row);
+    static const char* StateName(AppState s);
+    static const char* EventName(ScrollEvent e);
 
 private:
-    void TransitionTo(AppState ns) {
-        if (state_ == ns) return;
-        AppState old = state_;
-        state_ = ns;
-        if (callback_) callback_(old, ns);
-    }
+    struct Table;   // the transition table and the guards/actions it names
+
+    void Enter(AppState s, const ScrollInput& in);
+    void Exit(AppState s, const ScrollInput& in);
 
     // Default: Disabled. Zone only appears when user toggles via hotkey or tray.
-    // Flow: Disabled → (Ctrl+Alt+S) → Idle → (Ctrl+Alt+E) → Edit → (Ctrl+Alt+E) → Idle
-    AppState state_ = AppState::Disabled;
-    StateChangeCallback callback_;
+    AppState          state_ = AppState::Disabled;
+    ScrollSink*       sink_  = nullptr;
+    ScrollConfig      tuning_;
+    ScrollMode        mode_  = ScrollMode::ClickHold;
+    StateMachineStats stats_;
 
+    // Gesture data
+    uint8_t held_          = 0;       // bit per button
+    int     dirOf_[2]      = {0, 0};  // direction each held button asked for
+    int     holdButton_    = 0;
+    int     direction_     = 0;
+    double  holdStart_     = 0.0;
+    double  lastSpeed_     = 0.0;     // of the running hold, for coasting
+    double  coastSpeed_    = 0.0;
+    double  coastTime_     = 0.0;
+    double  scriptSpeed_   = 0.0;
 };
 
 } // namespace sn
@@ -0,0 +1,197 @@
+#include "StringCatalog.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+namespace sn {
+
+namespace {
+
+const char     kMagic[4] = {'S', 'N', 'L', 'C'};
+const uint32_t kVersion  = 1;
+
+// magic, version, count, buckets, seeds offset, slots offset, file size, reserved
+const size_t kHeaderSize = 32;
+const size_t kSlotWords  = 4;   // key offset, key length, value offset, value length (UTF-16 units)
+
+// One pass over the key, 8 bytes at a time. The high half picks the
+// bucket; the bucket's seed remixes the whole hash to pick the slot.
+uint64_t HashKey(std::string_view key) {
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ key.size();
+    const char* p = key.data();
+    size_t n = key.size();
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t w;
+        std::memcpy(&w, p, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    uint64_t tail = 0;
+    if (n) std::memcpy(&tail, p, n);
+    h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 29);
+}
+
+uint32_t Bucket(uint64_t h, uint32_t buckets) { return (uint32_t)(h >> 32) % buckets; }
+
+uint32_t Slot(uint64_t h, uint32_t seed, uint32_t count) {
+    h ^= seed * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 33; h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return (uint32_t)h % count;
+}
+
+uint32_t Read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+void Put32(std::string& out, size_t at, uint32_t v) {
+    for (int i = 0; i < 4; i++) out[at + i] = (char)((v >> (8 * i)) & 0xFF);
+}
+
+} // namespace
+
+// ───── Reader ─────
+bool StringCatalog::Open(const std::string& path) {
+    Close();
+    if (!file_.Open(path)) return false;
+    if (!Validate(file_.Data(), file_.Size())) { Close(); return false; }
+    return true;
+}
+
+bool StringCatalog::Attach(const void* data, size_t size) {
+    Close();
+    if (!Validate(static_cast<const uint8_t*>(data), size)) { Close(); return false; }
+    return true;
+}
+
+void StringCatalog::Close() {
+    file_.Close();
+    data_    = nullptr;
+    size_    = 0;
+    count_   = 0;
+    buckets_ = 0;
+    seeds_   = nullptr;
+    slots_   = nullptr;
+}
+
+// Header only: slots are checked as they are used, so opening costs
+// the same for ten strings or ten thousand.
+bool StringCatalog::Validate(const uint8_t* data, size_t size) {
+    if (!data || size < kHeaderSize || reinterpret_cast<uintptr_t>(data) % 4) return false;
+    if (std::memcmp(data, kMagic, 4) != 0 || Read32(data + 4) != kVersion) return false;
+
+    const uint32_t count   = Read32(data + 8);
+    const uint32_t buckets = Read32(data + 12);
+    const uint64_t seeds   = Read32(data + 16);
+    const uint64_t slots   = Read32(data + 20);
+    if (Read32(data + 24) != size) return false;   // truncated or padded
+    if (count && !buckets) return false;
+    if (seeds % 4 || slots % 4) return false;
+    if (seeds + (uint64_t)buckets * 4 > size) return false;
+    if (slots + (uint64_t)count * kSlotWords * 4 > size) return false;
+
+    data_    = data;
+    size_    = size;
+    count_   = count;
+    buckets_ = buckets;
+    seeds_   = reinterpret_cast<const uint32_t*>(data + seeds);
+    slots_   = reinterpret_cast<const uint32_t*>(data + slots);
+    return true;
+}
+
+const char16_t* StringCatalog::Find(std::string_view key) const {
+    if (!count_) return nullptr;
+    const uint64_t h     = HashKey(key);
+    const uint32_t* slot = slots_ + (size_t)Slot(h, seeds_[Bucket(h, buckets_)], count_) * kSlotWords;
+
+    const uint64_t keyOff = slot[0], keyLen = slot[1];
+    const uint64_t valOff = slot[2], valLen = slot[3];
+    if (keyLen != key.size() || keyOff + keyLen > size_) return nullptr;
+    if (std::memcmp(data_ + keyOff, key.data(), key.size()) != 0) return nullptr;
+    if (valOff % 2 || valOff + (valLen + 1) * 2 > size_) return nullptr;
+
+    auto* value = reinterpret_cast<const char16_t*>(data_ + valOff);
+    return value[valLen] == 0 ? value : nullptr;
+}
+
+// ───── Builder ─────
+bool BuildStringCatalog(const std::vector<std::pair<std::string, std::u16string>>& entries,
+                        std::string& out, std::string& error) {
+    const uint32_t count   = (uint32_t)entries.size();
+    const uint32_t buckets = std::max<uint32_t>(1, count / 2);   // ~2 keys per bucket
+
+    std::unordered_set<std::string_view> seen;
+    for (const auto& e : entries)
+        if (!seen.insert(e.first).second) { error = "duplicate key \"" + e.first + "\""; return false; }
+
+    // Place the fullest buckets first, while most slots are still free
+    std::vector<uint64_t> hashes(count);
+    std::vector<std::vector<uint32_t>> members(buckets);
+    for (uint32_t i = 0; i < count; i++) {
+        hashes[i] = HashKey(entries[i].first);
+        members[Bucket(hashes[i], buckets)].push_back(i);
+    }
+    std::vector<uint32_t> order(buckets);
+    for (uint32_t b = 0; b < buckets; b++) order[b] = b;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t a, uint32_t b) { return members[a].size() > members[b].size(); });
+
+    std::vector<uint32_t> seeds(buckets, 0);
+    std::vector<int64_t>  slotOf(count, -1);   // slot → entry
+    std::vector<uint32_t> tried;
+    for (uint32_t b : order) {
+        if (members[b].empty()) break;
+        bool placed = false;
+        for (uint32_t seed = 1; seed < (1u << 22) && !placed; seed++) {
+            tried.clear();
+            for (uint32_t i : members[b]) {
+                uint32_t s = Slot(hashes[i], seed, count);
+                if (slotOf[s] >= 0 || std::find(tried.begin(), tried.end(), s) != tried.end()) break;
+                tried.push_back(s);
+            }
+            if (tried.size() != members[b].size()) continue;
+            for (size_t k = 0; k < tried.size(); k++) slotOf[tried[k]] = members[b][k];
+            seeds[b] = seed;
+            placed = true;
+        }
+        if (!placed) { error = "no perfect hash found"; return false; }
+    }
+
+    // Layout: header | seeds | slots | keys | values (2-aligned)
+    const size_t seedsAt = kHeaderSize;
+    const size_t slotsAt = seedsAt + (size_t)buckets * 4;
+    size_t at = slotsAt + (size_t)count * kSlotWords * 4;
+    out.assign(at, '\0');
+    std::memcpy(&out[0], kMagic, 4);
+    Put32(out, 4, kVersion);
+    Put32(out, 8, count);
+    Put32(out, 12, buckets);
+    Put32(out, 16, (uint32_t)seedsAt);
+    Put32(out, 20, (uint32_t)slotsAt);
+    for (uint32_t b = 0; b < buckets; b++) Put32(out, seedsAt + b * 4, seeds[b]);
+
+    std::vector<uint32_t> keyAt(count);
+    for (uint32_t i = 0; i < count; i++) {
+        keyAt[i] = (uint32_t)out.size();
+        out += entries[i].first;
+    }
+    if (out.size() % 2) out += '\0';
+    for (uint32_t s = 0; s < count; s++) {
+        const auto& e = entries[(size_t)slotOf[s]];
+        const size_t slot = slotsAt + (size_t)s * kSlotWords * 4;
+        Put32(out, slot + 0,  keyAt[(size_t)slotOf[s]]);
+        Put32(out, slot + 4,  (uint32_t)e.first.size());
+        Put32(out, slot + 8,  (uint32_t)out.size());
+        Put32(out, slot + 12, (uint32_t)e.second.size());
+        for (char16_t c : e.second) { out += (char)(c & 0xFF); out += (char)(c >> 8); }
+        out += '\0'; out += '\0';
+    }
+    while (out.size() % 4) out += '\0';
+    Put32(out, 24, (uint32_t)out.size());
+    return true;
+}
+
+} // namespace sn
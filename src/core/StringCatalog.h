@@ -0,0 +1,62 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// StringCatalog — compiled UI strings, looked up straight from a map
+//
+// tools/locale_gen flattens locales/<lang>.json ("menu.quit") into a
+// flat little-endian file:
+//
+//   header | seeds[buckets] | slots[count] | keys (UTF-8) | values (UTF-16, NUL-terminated)
+//
+// indexed by a minimal perfect hash (hash-and-displace): the key's
+// bucket picks a seed, the seeded hash picks its slot, and the slot's
+// key is compared once to reject unknown keys. Find() is two hashes and
+// a memcmp on the mapped bytes — no parsing at open, no allocation per
+// lookup, and the value pointer is directly usable as a Win32 LPCWSTR.
+//
+// The header and every slot are bounds-checked before use, so a
+// truncated or foreign file only yields misses.
+// ─────────────────────────────────────────────────────────
+class StringCatalog {
+public:
+    // Map a catalog file (UTF-8 path); false (and empty) if missing or
+    // malformed.
+    bool Open(const std::string& path);
+    // Use an in-memory catalog (kept by the caller while attached).
+    bool Attach(const void* data, size_t size);
+    void Close();
+
+    // Value for `key`, NUL-terminated; nullptr if absent. Valid until
+    // the next Open/Attach/Close.
+    const char16_t* Find(std::string_view key) const;
+
+    size_t Count() const { return count_; }
+    bool IsOpen() const { return data_ != nullptr; }
+
+private:
+    bool Validate(const uint8_t* data, size_t size);
+
+    MappedFile     file_;
+    const uint8_t* data_    = nullptr;
+    size_t         size_    = 0;
+    uint32_t       count_   = 0;
+    uint32_t       buckets_ = 0;
+    const uint32_t* seeds_  = nullptr;
+    const uint32_t* slots_  = nullptr;   // 4 words per slot
+};
+
+// Compile `entries` (key, value) into catalog bytes. Fails (with
+// `error`) on duplicate keys or if no perfect hash is found.
+bool BuildStringCatalog(const std::vector<std::pair<std::string, std::u16string>>& entries,
+                        std::string& out, std::string& error);
+
+} // namespace sn
@@ -0,0 +1,48 @@
+#include "TickSchedule.h"
+#include "Metrics.h"
+#include <algorithm>
+
+namespace sn {
+
+static Counter& g_ticks = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_scroll_ticks_total", "Scroll timer wakeups.");
+static Histogram& g_tickRate = MetricsRegistry::Instance().AddHistogram(
+    "scrollnice_scroll_tick_rate", "Scroll timer wakeups per second, per continuous scroll of 0.5 s or more.",
+    {0.5, 1, 2, 4, 8, 16, 32, 64, 128, 256});
+
+void TickSchedule::SetFrame(double period) {
+    frame_ = std::clamp(period, 0.002, 0.05);
+}
+
+void TickSchedule::Start(double now) {
+    if (running_) {
+        due_ = std::min(due_, now + frame_);
+        return;
+    }
+    running_ = true;
+    start_   = now;
+    last_    = now;
+    due_     = now + frame_;
+    ticks_   = 0;
+}
+
+void TickSchedule::Stop(double now) {
+    if (!running_) return;
+    running_ = false;
+    if (now - start_ >= 0.5) g_tickRate.Observe(ticks_ / (now - start_));
+}
+
+double TickSchedule::Tick(double now) {
+    g_ticks.Add();
+    ticks_++;
+    span_ = std::clamp(now - last_, 0.0, due_ - last_ + kMaxLate);
+    last_ = now;
+    due_  = now + frame_;
+    return span_;
+}
+
+void TickSchedule::After(double in, bool steady) {
+    due_ = last_ + std::clamp(in, frame_, steady ? kMaxSleep : kMaxGap);
+}
+
+} // namespace sn
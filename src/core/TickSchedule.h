@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// TickSchedule — when the next continuous-scroll tick is due
+//
+// Scrolling used to tick every 16 ms at any speed; at hover speeds
+// nearly every tick only moved the accumulator. Now each tick says how
+// long until it has something to send (After()) and the platform timer
+// sleeps until Due(): no sooner than one display frame (SetFrame();
+// every frame is what exact per-frame deltas get), no later than
+// kMaxGap while the speed is still changing (a hold accelerating, a
+// coast decaying) and kMaxSleep otherwise. Start() while running brings
+// the next tick forward (the direction or speed changed).
+//
+// Times are seconds on any steady clock. Span() is the time the current
+// tick covers, for the engine to integrate; a timer that comes late
+// makes up at most kMaxLate of it.
+// ─────────────────────────────────────────────────────────
+class TickSchedule {
+public:
+    static constexpr double kDefaultFrame = 0.016;
+    static constexpr double kMaxGap       = 0.1;
+    static constexpr double kMaxSleep     = 10.0;
+    static constexpr double kMaxLate      = 0.1;
+
+    // Refresh period of the display the target is on (s).
+    void SetFrame(double period);
+    double Frame() const { return frame_; }
+
+    void Start(double now);
+    void Stop(double now);
+
+    // The timer fired at `now`: returns Span(). The next tick is one
+    // frame out unless After() says otherwise.
+    double Tick(double now);
+
+    // Nothing to send for `in` seconds after this tick (`steady`: at a
+    // speed that won't change by itself).
+    void After(double in, bool steady);
+
+    bool   Running() const { return running_; }
+    double Due() const { return due_; }
+    double Span() const { return span_; }
+
+private:
+    double   frame_   = kDefaultFrame;
+    bool     running_ = false;
+    double   start_   = 0.0;
+    double   last_    = 0.0;
+    double   due_     = 0.0;
+    double   span_    = 0.0;
+    uint64_t ticks_   = 0;   // this run
+};
+
+} // namespace sn
@@ -0,0 +1,123 @@
+#include "ZoneRenderer.h"
+#include <algorithm>
+
+namespace sn {
+
+static const float kCornerRadius = 9.0f;   // matches the old RoundRect(…, 18, 18)
+static const float kGlowWidth    = 6.0f;
+
+static const Pixel kWhite      = MakePixel(255, 255, 255);
+static const Pixel kLabelGrey  = MakePixel(220, 220, 220);
+static const Pixel kShadow     = MakePixel(0, 0, 0);
+static const Pixel kEditOrange = MakePixel(255, 165, 0);
+static const Pixel kEditBorder = MakePixel(255, 140, 0);
+static const Pixel kGlow       = MakePixel(59, 130, 246, 178);   // ~70%
+static const Pixel kTopTint    = MakePixel(40, 80, 160);
+static const Pixel kBotTint    = MakePixel(160, 40, 40);
+static const Pixel kGripShadow = MakePixel(100, 100, 100);
+static const Pixel kGripAccent = MakePixel(59, 130, 246);
+
+// Centre a label inside r, like DrawText(DT_CENTER | DT_VCENTER | DT_SINGLELINE).
+static void DrawLabel(const Surface& s, ZoneLabelSource* labels, ZoneLabel id,
+                      IRect r, Pixel color) {
+    if (!labels) return;
+    const CoverageMask* m = labels->Label(id);
+    if (!m || !m->data) return;
+    int x = r.left + ((r.right - r.left) - m->width) / 2;
+    int y = r.top  + ((r.bottom - r.top) - m->height) / 2;
+    raster::BlendMask(s, x, y, *m, color);
+}
+
+// ▲ / ▼ centred in r (the glyphs the old overlay drew with DrawTextW).
+static void DrawArrow(const Surface& s, IRect r, bool up, Pixel color) {
+    const float hw = 5.0f, hh = 4.5f;
+    float cx = (r.left + r.right) * 0.5f;
+    float cy = (r.top + r.bottom) * 0.5f;
+    if (up) raster::FillTriangle(s, cx, cy - hh, cx - hw, cy + hh, cx + hw, cy + hh, color);
+    else    raster::FillTriangle(s, cx - hw, cy - hh, cx + hw, cy - hh, cx, cy + hh, color);
+}
+
+static void DrawModeVisuals(const Surface& s, const ZoneVisualState& st, ZoneLabelSource* labels) {
+    const int w = s.width, h = s.height;
+
+    // ── Mode 1 (ClickHold): ▲ ▼ + "L↑ R↓" label ──
+    if (st.mode == ScrollMode::ClickHold) {
+        DrawArrow(s, {0, h / 4, w, h / 2}, true, kWhite);
+        DrawArrow(s, {0, h / 2, w, 3 * h / 4}, false, kWhite);
+        DrawLabel(s, labels, ZoneLabel::ClickHint, {4, h - 22, w - 4, h - 4}, kLabelGrey);
+        return;
+    }
+
+    // ── Mode 2 (SplitHold): split line + top/bottom arrows ──
+    if (st.mode == ScrollMode::SplitHold) {
+        raster::DashedHLine(s, 8, w - 8, h / 2, 18, 6, kWhite);
+        DrawArrow(s, {0, 4, w, h / 2 - 2}, true, kWhite);
+        DrawArrow(s, {0, h / 2 + 4, w, h - 4}, false, kWhite);
+        return;
+    }
+
+    // ── Mode 3 (HoverAuto): colour tint top/bottom + labels with shadow ──
+    raster::FillRect(s, {4, 4, w - 4, h / 2 - 2}, kTopTint);
+    raster::FillRect(s, {4, h / 2 + 2, w - 4, h - 4}, kBotTint);
+    raster::DashedHLine(s, 8, w - 8, h / 2, 18, 6, kWhite);
+
+    DrawLabel(s, labels, ZoneLabel::HoverUp,   {3, 10 + 3, w + 3, h / 2 - 6 + 3}, kShadow);
+    DrawLabel(s, labels, ZoneLabel::HoverDown, {3, h / 2 + 8 + 3, w + 3, h - 10 + 3}, kShadow);
+    DrawLabel(s, labels, ZoneLabel::HoverUp,   {0, 8, w, h / 2 - 6}, kWhite);
+    DrawLabel(s, labels, ZoneLabel::HoverDown, {0, h / 2 + 8, w, h - 10}, kWhite);
+}
+
+static void DrawResizeGrip(const Surface& s) {
+    const int DOT = 4, GAP = 5;
+    for (int i = 0; i < 3; i++) {
+        int ox = s.width  - 6 - i * (DOT + GAP);
+        int oy = s.height - 6 - i * (DOT + GAP);
+        raster::FillRect(s, {ox + 2, oy + 2, ox + DOT + 2, oy + DOT + 2}, kGripShadow);
+        raster::FillRect(s, {ox, oy, ox + DOT, oy + DOT}, kWhite);
+        raster::FillRect(s, {ox + 1, oy + 1, ox + DOT - 1, oy + DOT - 1}, kGripAccent);
+    }
+}
+
+void RenderZone(const Surface& dst, const ZoneVisualState& st,
+                ZoneLabelSource* labels, const Surface* cover) {
+    const int w = dst.width, h = dst.height;
+    if (w <= 0 || h <= 0) return;
+    const FRect full = {0.0f, 0.0f, (float)w, (float)h};
+
+    // ── Background ──
+    // The zone colour stays underneath a cover so transparent PNGs don't
+    // punch click-through holes in the layered window.
+    bool hasCover = cover && cover->pixels && !st.editMode;
+    Pixel bg = st.editMode ? kEditOrange
+                           : MakePixel((st.color >> 16) & 0xFF, (st.color >> 8) & 0xFF, st.color & 0xFF);
+    raster::Clear(dst, bg);
+    if (hasCover) {
+        raster::Blit(dst, 0, 0, *cover);
+    } else if (!st.editMode) {
+        // Soft highlight over the top third
+        raster::FillVerticalGradient(dst, {0, 0, w, h / 3},
+                                     MakePixel(255, 255, 255, 90), 0);
+    }
+
+    // ── Inner glow ──
+    if (!st.editMode && st.enabled)
+        raster::InnerGlow(dst, full, kCornerRadius, kGlowWidth, kGlow);
+
+    DrawModeVisuals(dst, st, labels);
+
+    // ── Rounded border ──
+    if (st.editMode) raster::StrokeRoundRect(dst, full, kCornerRadius, 3.0f, kEditBorder);
+    else             raster::StrokeRoundRect(dst, full, kCornerRadius, 2.0f, kWhite);
+
+    // ── Lock indicator ──
+    if (st.locked && !st.editMode)
+        DrawLabel(dst, labels, ZoneLabel::Lock, {w - 28, 4, w - 4, 24}, kWhite);
+
+    // ── Edit mode resize grip ──
+    if (st.editMode) DrawResizeGrip(dst);
+
+    // ── Anti-aliased corners ──
+    raster::ClipRoundRect(dst, kCornerRadius);
+}
+
+} // namespace sn
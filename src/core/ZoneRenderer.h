@@ -0,0 +1,45 @@
+#pragma once
+#include "Config.h"
+#include "Rasterizer.h"
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// ZoneRenderer — draws the zone overlay into a BGRA32 surface
+//
+// Everything the overlay shows (background, highlight, glow, mode
+// tints/arrows/divider, border, lock badge, resize grip) is built from
+// Rasterizer primitives, so the same frame can be produced on any
+// platform. Text is the only thing the rasterizer can't shape; the
+// platform supplies it once per label as a coverage mask.
+// ─────────────────────────────────────────────────────────
+
+enum class ZoneLabel {
+    ClickHint,   // "L↑  R↓"            (Mode 1, small font)
+    HoverUp,     // "▲ HOVER"           (Mode 3, bold font)
+    HoverDown,   // "▼ HOVER"           (Mode 3, bold font)
+    Lock,        // lock badge           (small font)
+    Count
+};
+
+class ZoneLabelSource {
+public:
+    virtual ~ZoneLabelSource() = default;
+    // Coverage mask for a label, or nullptr to skip drawing it.
+    virtual const CoverageMask* Label(ZoneLabel id) = 0;
+};
+
+struct ZoneVisualState {
+    ScrollMode mode     = ScrollMode::ClickHold;
+    bool       editMode = false;
+    bool       enabled  = true;
+    bool       locked   = false;
+    uint32_t   color    = 0x3498DB;   // 0xRRGGBB
+};
+
+// Render one frame. `cover` (optional) must already be scaled to the
+// surface size; `labels` may be nullptr (labels are then omitted).
+void RenderZone(const Surface& dst, const ZoneVisualState& st,
+                ZoneLabelSource* labels, const Surface* cover);
+
+} // namespace sn
@@ -7,47 +7,156 @@
 #include <commctrl.h>
 #include <mmsystem.h>
 #include <string>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <chrono>
 #include <cmath>
+#include <future>
+#include <memory>
+#include <vector>
 
 #pragma comment(lib, "comctl32.lib")
 #pragma comment(lib, "winmm.lib")
 
+#include "core/BuiltinPresets.h"
+#include "core/CommandChannel.h"
+#include "core/DeliveryTable.h"
 #include "core/Config.h"
+#include "core/ConfigPersister.h"
+#include "core/ConfigSchema.h"
+#include "core/ConfigLoader.h"
+#include "core/FileWatcher.h"
+#include "core/Metrics.h"
+#include "core/MetricsServer.h"
+#include "core/PanGesture.h"
+#include "core/Profiles.h"
+#include "core/ScrollBackend.h"
+#include "core/ScrollBoundary.h"
 #include "core/Zone.h"
 #include "core/ScrollEngine.h"
+#include "core/SoundEngine.h"
 #include "core/StateMachine.h"
+#include "core/TickSchedule.h"
+#include "platform/win/WinAudioSink.h"
 #include "platform/win/WinMouseHook.h"
+#include "platform/win/WinDisplay.h"
+#include "platform/win/WinForegroundWatcher.h"
+#include "platform/win/WinFramePacer.h"
 #include "platform/win/WinOverlay.h"
+#include "platform/win/WinScrollWatcher.h"
 #include "platform/win/WinTray.h"
+#include "platform/win/WinUiaScroll.h"
 #include "platform/win/WinHotkeys.h"
 #include "platform/win/WinMainWindow.h"
+#include "platform/win/WinGdiPool.h"
+#include "platform/win/WinStartupProfiler.h"
+#include "platform/win/WinStrings.h"
+#include "platform/win/WinTouchInjector.h"
 
 // ─────────── Globals ───────────
 static sn::ConfigStore      g_configStore;
+static sn::ConfigPersister  g_persister;     // write-behind saves (never blocks the UI)
 static sn::ZoneManager      g_zoneManager;
 static sn::ScrollEngine     g_scrollEngine;
+static sn::WinUiaScrollProvider g_uiaScroll;                  // scroll.backend "uia"
+static sn::PatternScroller  g_patternScroller(g_uiaScroll);
+static sn::DeliveryTable    g_deliveryTable;   // learned wheel delivery per app/class
+static sn::ScrollBoundary   g_boundary;        // target at its top/bottom
+static sn::WinTouchInjector g_touchInjector;   // scroll.backend "touch"
 static sn::StateMachine     g_stateMachine;
+static sn::SoundEngine      g_sound;         // click sound (mixer thread, WASAPI)
 static sn::WinOverlay       g_overlay;
 static sn::WinTray          g_tray;
 static sn::WinHotkeys       g_hotkeys;
 static sn::WinMainWindow    g_mainWindow;
 
 static std::string g_configPath;
+static std::string g_deliveryPath;   // delivery.json next to config.json
 static HINSTANCE   g_hInstance = nullptr;
 
-// Continuous/hold scroll state
-static UINT_PTR g_holdTimer = 0;
-static const UINT_PTR TIMER_ID_HOLD = 501;
-static int  g_holdDirection = 0;
-static ULONGLONG g_holdStartTime = 0;
-static bool g_leftHeld = false;
-static bool g_rightHeld = false;
+// Hold/hover/coast scrolling lives in g_stateMachine; this timer wakes
+// it at g_tickSchedule's deadline when no frame pacer is running.
+static const UINT_PTR TIMER_ID_SCROLL = 501;
 
-// Hover scroll state (Mode 3)
-static UINT_PTR g_hoverTimer = 0;
-static const UINT_PTR TIMER_ID_HOVER = 502;
-static int  g_hoverDirection = 0;
+// scroll.backend "touch": frames of the synthetic touch pan
+static const UINT_PTR TIMER_ID_PAN = 502;
+
+// Lazy UI: the settings window is built on first Show and torn down
+// again after it has been hidden for a while; the overlay window is
+// only created once the zone is first enabled or edited.
+static const UINT_PTR TIMER_ID_SETTINGS_IDLE = 503;
+static const UINT     kSettingsIdleReleaseMs = 60 * 1000;
+
+// Config hot reload: the watcher thread posts WM_CONFIG_CHANGED and the
+// reload runs once the burst of notifications from one save has settled.
+static std::unique_ptr<sn::FileWatcher> g_configWatcher;
+static const UINT     WM_CONFIG_CHANGED      = WM_APP + 2;
+static const UINT_PTR TIMER_ID_CONFIG_RELOAD = 504;
+static const UINT     kConfigReloadDelayMs   = 150;
+
+// What ApplyConfig() last pushed into the subsystems; the next call
+// re-applies only the fields that differ. Live edits (tray, hotkeys,
+// settings controls, zone drags) record what they applied here too.
+static sn::AppConfig g_appliedConfig;
+static bool          g_configApplied = false;
+
+// Per-application profiles: built-in presets (plus presets/*.json next to
+// the exe) and the user's config.json profiles, resolved into snapshots by
+// RebuildProfiles(). g_configStore keeps the base config the user edits;
+// everything that scrolls or draws reads ActiveConfig().
+static sn::ProfileIndex                g_profiles;
+static std::vector<sn::ProfileConfig>  g_presets;
+static int                             g_activeProfile = sn::ProfileIndex::kBase;
+static std::string                     g_foregroundExe;
+static std::string                     g_foregroundClass;
+static std::string                     g_pinnedProfile;   // set over the command channel ("" = none)
+
+static const sn::AppConfig& ActiveConfig() { return g_profiles.Config(g_activeProfile); }
+
+// UI language: the mapped string catalog (WinStrings.h). The settings
+// window is rebuilt from the message loop, never from inside its own
+// Save handler.
+static const UINT  WM_LANGUAGE_CHANGED = WM_APP + 3;
+static std::string g_language;
+static bool        g_languageLoaded = false;
+
+// Command channel (scrollnice_ctl, scripts, the browser bridge):
+// requests are executed on the UI thread, posted over from the server
+// thread
+static std::unique_ptr<sn::CommandServer> g_commandServer;
+static const UINT WM_REMOTE_COMMAND = WM_APP + 4;
+struct RemoteCommand {
+    enum : int { Queued, Running, Cancelled };
+    sn::Command                     cmd;
+    std::promise<sn::CommandReply>  reply;
+    std::atomic<int>                state{Queued};   // the caller cancels a request still queued
+};
+// Last State event sent to feed subscribers (the browser bridge)
+static std::string g_feedState;
+static sn::Counter& g_bridgeFrames = sn::MetricsRegistry::Instance().AddCounter(
+    "scrollnice_bridge_frames_total",
+    "Scrolls handed to the browser extension as exact pixel deltas instead of wheel events.");
+
+// Local scrape endpoint ("metrics": true); the counters run regardless
+static std::unique_ptr<sn::MetricsServer> g_metricsServer;
+static sn::Histogram& g_targetResolve = sn::MetricsRegistry::Instance().AddHistogram(
+    "scrollnice_target_resolve_seconds", "Time to find the window behind the zone to scroll.",
+    {10e-6, 25e-6, 50e-6, 100e-6, 250e-6, 500e-6, 1e-3, 2.5e-3, 5e-3, 10e-3});
+static sn::Counter& g_tickOverruns = sn::MetricsRegistry::Instance().AddCounter(
+    "scrollnice_scroll_tick_overruns_total",
+    "Scroll ticks that came more than 32 ms after they were due.");
+
+// Scroll ticks come when the next step is due, on a frame of the
+// target's monitor: WM_SCROLL_FRAME from g_framePacer, or TIMER_ID_SCROLL
+// if it couldn't start. The schedule's clock is WinFramePacer::Now().
+static sn::TickSchedule   g_tickSchedule;
+static sn::WinFramePacer  g_framePacer;
+static HMONITOR           g_paceMonitor = nullptr;   // whose frame timing is in use
+static const UINT         WM_SCROLL_FRAME = WM_APP + 5;
 
 // Last cursor pos outside zone (for FindScrollTarget)
 static POINT g_lastOutsidePos = {-1, -1};
@@ -56,22 +165,99 @@ static POINT g_lastOutsidePos = {-1, -1};
 static const wchar_t* kMsgWindowClass = L"ScrollNice_MsgWnd";
 static HWND g_msgWnd = nullptr;
 
+// What g_panPlanner does to the app: touch contacts and its frame timer.
+class AppPanSink : public sn::PanSink {
+public:
+    bool Inject(const sn::PanContact& contact) override { return g_touchInjector.Inject(contact); }
+    void StartFrames() override {
+        if (g_msgWnd) SetTimer(g_msgWnd, TIMER_ID_PAN, 16, nullptr);
+    }
+    void StopFrames() override {
+        if (g_msgWnd) KillTimer(g_msgWnd, TIMER_ID_PAN);
+    }
+};
+static AppPanSink      g_panSink;
+static sn::PanPlanner  g_panPlanner(g_panSink);
+
+static double TickNow() { return sn::WinFramePacer::Now(); }
+
+// Wake for g_tickSchedule's next tick (nothing when it stopped)
+static void ArmScrollTimer() {
+    if (!g_msgWnd) return;
+    if (g_framePacer.IsRunning()) {
+        if (g_tickSchedule.Running()) g_framePacer.Arm(g_tickSchedule.Due());
+        else g_framePacer.Disarm();
+        return;
+    }
+    if (!g_tickSchedule.Running()) {
+        KillTimer(g_msgWnd, TIMER_ID_SCROLL);
+        return;
+    }
+    const double wait = std::max(0.0, g_tickSchedule.Due() - TickNow());
+    SetTimer(g_msgWnd, TIMER_ID_SCROLL, (UINT)std::ceil(wait * 1000.0), nullptr);
+}
+
+// Frames of the monitor showing `target`, looked up again when it is on
+// another one (or `redetect`: the refresh rate may have been changed)
+static void PaceTo(HWND target, bool redetect = false) {
+    const HMONITOR mon = MonitorFromWindow(target, MONITOR_DEFAULTTONEAREST);
+    if (mon == g_paceMonitor && !redetect) return;
+    const sn::FrameTiming timing = sn::MonitorFrameTiming(target);
+    g_paceMonitor = timing.monitor;
+    g_tickSchedule.SetFrame(timing.period);
+    g_framePacer.SetTiming(timing);
+}
+
 // ─────────── Forward declarations ───────────
-static void HandleZoneClick(int button, bool isDown, POINT clickPos, int zoneW, int zoneH);
-static void HandleZoneHover(POINT clientPos, int zoneW, int zoneH);
-static void StartHoldScroll(int direction);
-static void StopHoldScroll();
-static void StartHoverScroll(int direction);
-static void StopHoverScroll();
+static sn::ScrollInput ZoneInput(int button, const sn::ZoneEventData& e);
+static double NowSeconds();
+static void DispatchModeChanged();
+static void CancelScroll();
+static void LogStateMachineStats();
+static void ApplySound(const sn::SoundConfig& sound);
+static void ApplyMetrics(bool enable);
 static void PlayClickSound();
 static void ApplyConfig();
+static void ApplyActiveConfig();
+static void RebuildProfiles();
+static int ResolveProfile();
+static void LoadPresets();
+static void OnForegroundApp(const sn::ForegroundApp& app);
+static void ApplyLanguage(const std::string& lang);
+static void ReloadConfig();
+static void LogConfigDiagnostics(const sn::ConfigStore& store);
 static void SetStartWithWindows(bool enable);
 static std::string GetConfigPath();
 static void UpdateWheelBlockHook(bool enable);
 static void OnHotkey(int id);
-static HWND FindScrollTarget();
+static HWND FindScrollTarget(POINT* at = nullptr);
+static void AimScroll();
 static void OnMainWindowEvent(int eventId);
 static bool OnMouseEvent(POINT, DWORD, MSLLHOOKSTRUCT*);
+static bool EnsureOverlay();
+static bool EnsureMainWindow();
+static void ShowMainWindow();
+static sn::CommandReply ExecuteCommand(const sn::Command& cmd);
+static sn::CommandReply PostCommand(const sn::Command& cmd);
+static sn::CommandReply CommandState();
+static void PublishFeedState();
+static bool RouteToBrowser(HWND target, double dy, double dt);
+
+// ─────────── Scroll ticks ───────────
+static void OnScrollTick() {
+    // A busy UI thread delays the tick (and WM_TIMER, the fallback, is
+    // a low-priority message rounded up to the 15.6 ms system tick),
+    // so only 32 ms past the deadline counts as late.
+    const double now = TickNow();
+    if (now - g_tickSchedule.Due() > 0.032) g_tickOverruns.Add();
+    g_tickSchedule.Tick(now);
+    PaceTo(g_scrollEngine.GetTargetHwnd());
+
+    sn::ScrollInput in;
+    in.time = NowSeconds();
+    g_stateMachine.Dispatch(sn::ScrollEvent::Tick, in);
+    ArmScrollTimer();
+}
 
 // ─────────── Message window proc (hotkeys + timers) ───────────
 static LRESULT CALLBACK MsgWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
@@ -81,17 +267,18 @@ static LRESULT CALLBACK MsgWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
         return 0;
 
     case WM_TIMER: {
-        auto& cfg = g_configStore.Get();
-        if (wParam == TIMER_ID_HOLD && g_holdDirection != 0) {
-            ULONGLONG now = GetTickCount64();
-            if (now < g_holdStartTime) return 0;
-            double holdSec = (now - g_holdStartTime) / 1000.0;
-            g_scrollEngine.ContinuousScrollTick(g_holdDirection,
-                cfg.scroll.continuous_speed, cfg.scroll.continuous_accel, holdSec);
+        if (wParam == TIMER_ID_SCROLL) OnScrollTick();
+        if (wParam == TIMER_ID_PAN) g_panPlanner.Frame();
+        if (wParam == TIMER_ID_SETTINGS_IDLE) {
+            KillTimer(hwnd, TIMER_ID_SETTINGS_IDLE);
+            if (g_mainWindow.Handle() && !g_mainWindow.IsVisible()) {
+                g_mainWindow.Destroy();
+                sn::GdiPool::Instance().Trim();
+            }
         }
-        if (wParam == TIMER_ID_HOVER && g_hoverDirection != 0) {
-            g_scrollEngine.ContinuousScrollTick(g_hoverDirection,
-                cfg.scroll.hover_speed, 1, 0.5);
+        if (wParam == TIMER_ID_CONFIG_RELOAD) {
+            KillTimer(hwnd, TIMER_ID_CONFIG_RELOAD);
+            ReloadConfig();
         }
         return 0;
     }
@@ -100,22 +287,26 @@ static LRESULT CALLBACK MsgWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
         switch (LOWORD(wParam)) {
         case sn::WinTray::ID_TOGGLE:
             g_stateMachine.ToggleEnabled();
+            if (g_stateMachine.IsEnabled()) EnsureOverlay();
             g_overlay.SetEnabled(g_stateMachine.IsEnabled());
             g_tray.SetEnabled(g_stateMachine.IsEnabled());
             // Sync main window checkbox
             {
                 auto& cfg = g_configStore.Get();
                 cfg.enabled = g_stateMachine.IsEnabled();
+                g_appliedConfig.enabled = cfg.enabled;
+                RebuildProfiles();
                 g_mainWindow.SyncFromConfig(cfg);
             }
             break;
         case sn::WinTray::ID_EDIT:
             g_stateMachine.ToggleEdit();
+            if (g_stateMachine.IsEditing()) EnsureOverlay();
             g_overlay.SetEditMode(g_stateMachine.IsEditing());
             break;
         case sn::WinTray::ID_SETTINGS:
-            // Tray double-click / settings → show main window
-            g_mainWindow.Show();
+            // Tray double-click / settings / second instance → show main window
+            ShowMainWindow();
             break;
         case sn::WinTray::ID_QUIT:
             PostQuitMessage(0);
@@ -128,6 +319,30 @@ static LRESULT CALLBACK MsgWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
             g_tray.HandleMessage(msg, wParam, lParam);
             return 0;
         }
+        if (msg == WM_LANGUAGE_CHANGED) {
+            bool visible = g_mainWindow.IsVisible();
+            g_mainWindow.Destroy();
+            if (visible) ShowMainWindow();
+            return 0;
+        }
+        if (msg == WM_SCROLL_FRAME) {
+            if (g_tickSchedule.Running()) OnScrollTick();
+            return 0;
+        }
+        if (msg == WM_REMOTE_COMMAND) {
+            std::unique_ptr<std::shared_ptr<RemoteCommand>> posted(
+                reinterpret_cast<std::shared_ptr<RemoteCommand>*>(lParam));
+            RemoteCommand& call = **posted;
+            int queued = RemoteCommand::Queued;
+            if (call.state.compare_exchange_strong(queued, RemoteCommand::Running))
+                call.reply.set_value(ExecuteCommand(call.cmd));
+            return 0;
+        }
+        if (msg == WM_CONFIG_CHANGED) {
+            // (Re)start the settle timer; one reload per save
+            SetTimer(hwnd, TIMER_ID_CONFIG_RELOAD, kConfigReloadDelayMs, nullptr);
+            return 0;
+        }
         return DefWindowProcW(hwnd, msg, wParam, lParam);
     }
 }
@@ -136,122 +351,167 @@ static LRESULT CALLBACK MsgWndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
 static void OnZoneEvent(const sn::ZoneEventData& e) {
     switch (e.event) {
     case sn::ZoneEvent::LeftClickDown:
-        g_scrollEngine.SetTargetHwnd(FindScrollTarget());
-        HandleZoneClick(0, true, e.clickPos, e.zoneWidth, e.zoneHeight);
+        AimScroll();
+        g_stateMachine.Dispatch(sn::ScrollEvent::Press, ZoneInput(0, e));
         break;
     case sn::ZoneEvent::LeftClickUp:
-        HandleZoneClick(0, false, e.clickPos, e.zoneWidth, e.zoneHeight);
+        g_stateMachine.Dispatch(sn::ScrollEvent::Release, ZoneInput(0, e));
         break;
     case sn::ZoneEvent::RightClickDown:
-        g_scrollEngine.SetTargetHwnd(FindScrollTarget());
-        HandleZoneClick(1, true, e.clickPos, e.zoneWidth, e.zoneHeight);
+        AimScroll();
+        g_stateMachine.Dispatch(sn::ScrollEvent::Press, ZoneInput(1, e));
         break;
     case sn::ZoneEvent::RightClickUp:
-        HandleZoneClick(1, false, e.clickPos, e.zoneWidth, e.zoneHeight);
+        g_stateMachine.Dispatch(sn::ScrollEvent::Release, ZoneInput(1, e));
         break;
     case sn::ZoneEvent::HoverMove:
         if (!g_scrollEngine.GetTargetHwnd())
-            g_scrollEngine.SetTargetHwnd(FindScrollTarget());
-        HandleZoneHover(e.clickPos, e.zoneWidth, e.zoneHeight);
+            AimScroll();
+        g_stateMachine.Dispatch(sn::ScrollEvent::Hover, ZoneInput(0, e));
         break;
     case sn::ZoneEvent::HoverLeave:
         GetCursorPos(&g_lastOutsidePos);
         g_scrollEngine.SetTargetHwnd(nullptr);
-        StopHoverScroll();
+        g_stateMachine.Dispatch(sn::ScrollEvent::Leave, ZoneInput(0, e));
+        break;
+    case sn::ZoneEvent::DragMove:
+    case sn::ZoneEvent::ResizeEnd: {
+        // The overlay already shows the new geometry; record it so the
+        // next ApplyConfig() or reload doesn't snap the zone back. It goes
+        // into the base config: a profile that sets its own zone size
+        // still resizes the zone when it next becomes active.
+        auto& cfg = g_configStore.Get();
+        cfg.zone.x      = e.newX;
+        cfg.zone.y      = e.newY;
+        cfg.zone.width  = e.zoneWidth;
+        cfg.zone.height = e.zoneHeight;
+        g_appliedConfig.zone.x      = cfg.zone.x;
+        g_appliedConfig.zone.y      = cfg.zone.y;
+        g_appliedConfig.zone.width  = cfg.zone.width;
+        g_appliedConfig.zone.height = cfg.zone.height;
+        RebuildProfiles();
+        g_zoneManager.LoadFromConfig(g_appliedConfig.zone);
+        g_persister.Submit(cfg);
         break;
+    }
     default:
         break;
     }
 }
 
-// ─────────── 3-Mode click/hold logic ───────────
-static void HandleZoneClick(int button, bool isDown, POINT clickPos, int zoneW, int zoneH) {
-    auto& cfg = g_configStore.Get();
-    sn::ScrollMode mode = sn::ScrollModeFromString(cfg.scroll.mode);
-
-    if (mode == sn::ScrollMode::HoverAuto) return;
-
-    if (isDown) {
-        int direction = 0;
-
-        if (mode == sn::ScrollMode::ClickHold) {
-            direction = (button == 0) ? 1 : -1;
-        } else if (mode == sn::ScrollMode::SplitHold) {
-            bool topHalf = (clickPos.y < zoneH / 2);
-            direction = topHalf ? 1 : -1;
-        }
-
-        if (direction != 0) {
-            PlayClickSound();
-            g_scrollEngine.ClickScroll(direction, cfg.scroll.scroll_amount);
-            StartHoldScroll(direction);
-        }
-    } else {
-        StopHoldScroll();
+// ─────────── Scroll state machine ───────────
+// What g_stateMachine does to the app: the tick timer and wheel events.
+class AppScrollSink : public sn::ScrollSink {
+public:
+    void StartTicks() override {
+        if (!g_tickSchedule.Running()) PaceTo(g_scrollEngine.GetTargetHwnd(), true);
+        g_tickSchedule.Start(TickNow());
+        ArmScrollTimer();
     }
-}
-
-// ─────────── Mode 3: Hover logic ───────────
-static void HandleZoneHover(POINT clientPos, int /*zoneW*/, int zoneH) {
-    auto& cfg = g_configStore.Get();
-    sn::ScrollMode mode = sn::ScrollModeFromString(cfg.scroll.mode);
-    if (mode != sn::ScrollMode::HoverAuto) return;
+    void StopTicks() override {
+        g_tickSchedule.Stop(TickNow());
+        ArmScrollTimer();
+    }
+    void ClickScroll(int direction, int amount) override {
+        PlayClickSound();
+        g_scrollEngine.ClickScroll(direction, amount);
+    }
+    void ScrollTick(int direction, double speed, bool steady) override {
+        g_scrollEngine.VelocityTick(direction, speed, g_tickSchedule.Span());
+        g_tickSchedule.After(g_scrollEngine.NextStepIn(direction, speed), steady);
+    }
+    void ResetScroll() override { g_scrollEngine.Reset(); }
+};
+static AppScrollSink g_scrollSink;
 
-    bool topHalf = (clientPos.y < zoneH / 2);
-    int dir = topHalf ? 1 : -1;
+static double NowSeconds() { return GetTickCount64() / 1000.0; }
 
-    if (dir != g_hoverDirection) {
-        StopHoverScroll();
-        StartHoverScroll(dir);
-    }
+static sn::ScrollInput ZoneInput(int button, const sn::ZoneEventData& e) {
+    sn::ScrollInput in;
+    in.button  = button;
+    in.topHalf = e.clickPos.y < e.zoneHeight / 2;
+    in.time    = NowSeconds();
+    return in;
 }
 
-// ─────────── Hold scroll timers ───────────
-static void StartHoldScroll(int direction) {
-    g_holdDirection = direction;
-    g_holdStartTime = GetTickCount64();
-    if (!g_holdTimer && g_msgWnd) {
-        g_holdTimer = SetTimer(g_msgWnd, TIMER_ID_HOLD, 16, nullptr);
-    }
+static void DispatchModeChanged() {
+    sn::ScrollInput in;
+    in.mode = sn::ScrollModeFromString(ActiveConfig().scroll.mode);
+    in.time = NowSeconds();
+    g_stateMachine.Dispatch(sn::ScrollEvent::ModeChanged, in);
 }
 
-static void StopHoldScroll() {
-    g_holdDirection = 0;
-    g_leftHeld = false;
-    g_rightHeld = false;
-    g_scrollEngine.Reset();
-    if (g_holdTimer && g_msgWnd) {
-        KillTimer(g_msgWnd, TIMER_ID_HOLD);
-        g_holdTimer = 0;
-    }
+static void CancelScroll() {
+    sn::ScrollInput in;
+    in.time = NowSeconds();
+    g_stateMachine.Dispatch(sn::ScrollEvent::Cancel, in);
 }
 
-static void StartHoverScroll(int direction) {
-    g_hoverDirection = direction;
-    if (!g_hoverTimer && g_msgWnd) {
-        g_hoverTimer = SetTimer(g_msgWnd, TIMER_ID_HOVER, 16, nullptr);
+// Transitions that fired during the session, for tuning the table
+static void LogStateMachineStats() {
+    const auto& stats = g_stateMachine.Stats();
+    char line[160];
+    snprintf(line, sizeof(line), "ScrollNice: state machine: %llu events, %llu unhandled\n",
+             (unsigned long long)stats.dispatched, (unsigned long long)stats.unhandled);
+    OutputDebugStringA(line);
+    for (size_t r = 0; r < sn::StateMachine::TransitionCount(); r++) {
+        if (!stats.transitions[r]) continue;
+        const auto t = sn::StateMachine::Transition(r);
+        snprintf(line, sizeof(line), "ScrollNice:   %s --%s--> %s%s: %llu\n",
+                 sn::StateMachine::StateName(t.source), sn::StateMachine::EventName(t.event),
+                 sn::StateMachine::StateName(t.target), t.internal ? " (internal)" : "",
+                 (unsigned long long)stats.transitions[r]);
+        OutputDebugStringA(line);
     }
 }
 
-static void StopHoverScroll() {
-    g_hoverDirection = 0;
-    g_scrollEngine.Reset();
-    if (g_hoverTimer && g_msgWnd) {
-        KillTimer(g_msgWnd, TIMER_ID_HOVER);
-        g_hoverTimer = 0;
+// ─────────── Sound ───────────
+// The click is decoded (or synthesised) here, when the sound config is
+// applied; a click is then only a queue push to the mixer thread.
+static void ApplySound(const sn::SoundConfig& sound) {
+    if (!sound.enabled) {
+        g_sound.Stop();
+        return;
     }
+    sn::SoundClip clip;
+    std::string error;
+    if (sound.click_sound.empty() || !sn::LoadWavFile(sound.click_sound, clip, error)) {
+        if (!error.empty()) {
+            std::string line = "ScrollNice: click sound " + sound.click_sound + ": " + error +
+                               "; using the built-in click\n";
+            OutputDebugStringA(line.c_str());
+        }
+        clip = sn::SynthesizeClick();
+    }
+    g_sound.SetClip(std::move(clip));
+    if (!g_sound.IsRunning()) g_sound.Start(sn::CreateWasapiAudioSink());
 }
 
-// ─────────── Sound ───────────
 static void PlayClickSound() {
-    auto& cfg = g_configStore.Get();
-    if (!cfg.sound.enabled) return;
-    MessageBeep(MB_OK);
+    if (!ActiveConfig().sound.enabled) return;
+    if (!g_sound.Play()) MessageBeep(MB_OK);   // no audio device
+}
+
+// ─────────── Metrics ───────────
+static void ApplyMetrics(bool enable) {
+    if (!enable) {
+        g_metricsServer.reset();
+        return;
+    }
+    if (g_metricsServer) return;
+    g_metricsServer = sn::CreateMetricsServer();
+    const bool ok = g_metricsServer->Start([] { return sn::MetricsRegistry::Instance().Render(); });
+    std::string line = "ScrollNice: metrics " + std::string(ok ? "on " : "endpoint unavailable: ") +
+                       g_metricsServer->Endpoint() + "\n";
+    OutputDebugStringA(line.c_str());
+    if (!ok) g_metricsServer.reset();
 }
 
 // ─────────── FindScrollTarget ───────────
 // Finds the scrollable window behind the zone to send WM_MOUSEWHEEL to.
-static HWND FindScrollTarget() {
+// `at` receives the screen point it was found at.
+static HWND FindScrollTarget(POINT* at) {
+    sn::ScopedTimer timer(g_targetResolve);
     POINT pos = g_lastOutsidePos;
     if (pos.x < 0 && pos.y < 0) GetCursorPos(&pos);
 
@@ -277,6 +537,8 @@ static HWND FindScrollTarget() {
     // If still no valid window, return nullptr
     if (!top || top == zoneHwnd) return nullptr;
 
+    if (at) *at = pos;
+
     // Convert to client coordinates for child window search
     POINT clientPos = pos;
     ScreenToClient(top, &clientPos);
@@ -289,26 +551,78 @@ static HWND FindScrollTarget() {
     return (child && child != top) ? child : top;
 }
 
+// Points the engine at the window behind the zone. A touch pan puts its
+// finger down where that window was found, away from the zone.
+static void AimScroll() {
+    POINT at{};
+    HWND target = FindScrollTarget(&at);
+    g_scrollEngine.SetTargetHwnd(target);
+    RECT r;
+    if (!target || !GetWindowRect(target, &r)) return;
+    sn::PanArea area;
+    area.target = reinterpret_cast<uintptr_t>(target);
+    area.x      = std::clamp<int>(at.x, r.left, r.right - 1);
+    area.y      = at.y;
+    area.top    = r.top;
+    area.bottom = r.bottom;
+    g_panPlanner.SetArea(area);
+}
+
 // ─────────── ApplyConfig ───────────
+// The base config changed: re-resolve the profiles and apply whichever
+// one is active.
 static void ApplyConfig() {
-    auto& cfg = g_configStore.Get();
-    g_zoneManager.LoadFromConfig(cfg.zone);
+    RebuildProfiles();
+    ApplyActiveConfig();
+}
 
-    g_stateMachine.SetEnabled(cfg.enabled);
+// Pushes the active config into the subsystems, touching only those
+// whose fields changed since the last call (everything on the first
+// call).
+static void ApplyActiveConfig() {
+    auto& cfg = ActiveConfig();
+    const uint32_t changes = g_configApplied ? sn::DiffConfig(g_appliedConfig, cfg) : sn::CHG_ALL;
+    g_appliedConfig = cfg;
+    g_configApplied = true;
+    PublishFeedState();   // a profile switch can change nothing else
+    if (changes == sn::CHG_NONE) return;
 
-    g_overlay.SetScrollMode(sn::ScrollModeFromString(cfg.scroll.mode));
-    g_overlay.SetPosition(cfg.zone.x, cfg.zone.y);
-    g_overlay.SetSize(cfg.zone.width, cfg.zone.height);
-    g_overlay.SetOpacity(cfg.zone.opacity);
-    g_overlay.SetLocked(cfg.zone.locked);
-    g_overlay.SetEnabled(g_stateMachine.IsEnabled());
+    if (changes & sn::CHG_SCROLL_TUNING) g_stateMachine.SetTuning(cfg.scroll);
+    if (changes & sn::CHG_SCROLL_BACKEND) {
+        g_scrollEngine.SetPatternScroller(cfg.scroll.backend == "uia" ? &g_patternScroller : nullptr);
+        if (cfg.scroll.backend != "touch") g_panPlanner.Cancel();
+        g_scrollEngine.SetPanPlanner(cfg.scroll.backend == "touch" ? &g_panPlanner : nullptr);
+    }
 
-    g_tray.SetEnabled(g_stateMachine.IsEnabled());
-    g_tray.SetModeName(cfg.scroll.mode);
-    SetStartWithWindows(cfg.start_with_windows);
-    UpdateWheelBlockHook(cfg.wheel_block);
+    g_zoneManager.LoadFromConfig(cfg.zone);
 
-    if (g_msgWnd) {
+    if (changes & sn::CHG_ENABLED) {
+        g_stateMachine.SetEnabled(cfg.enabled);
+        if (g_stateMachine.IsEnabled()) EnsureOverlay();
+    }
+    if (changes & sn::CHG_MODE) {
+        DispatchModeChanged();
+        g_overlay.SetScrollMode(sn::ScrollModeFromString(cfg.scroll.mode));
+        g_tray.SetModeName(cfg.scroll.mode);
+    }
+    if (changes & sn::CHG_ZONE_POSITION) g_overlay.SetPosition(cfg.zone.x, cfg.zone.y);
+    if (changes & sn::CHG_ZONE_SIZE)     g_overlay.SetSize(cfg.zone.width, cfg.zone.height);
+    if (changes & sn::CHG_ZONE_OPACITY)  g_overlay.SetOpacity(cfg.zone.opacity);
+    if (changes & sn::CHG_ZONE_COLOR)    g_overlay.SetColor(cfg.zone.color);
+    if (changes & sn::CHG_ZONE_COVER)    g_overlay.SetCoverImage(cfg.zone.cover_image);
+    if (changes & sn::CHG_ZONE_LOCKED)   g_overlay.SetLocked(cfg.zone.locked);
+    if (changes & sn::CHG_ENABLED) {
+        g_overlay.SetEnabled(g_stateMachine.IsEnabled());
+        g_tray.SetEnabled(g_stateMachine.IsEnabled());
+    }
+
+    if (changes & sn::CHG_LANGUAGE)    ApplyLanguage(cfg.language);
+    if (changes & sn::CHG_SOUND)       ApplySound(cfg.sound);
+    if (changes & sn::CHG_METRICS)     ApplyMetrics(cfg.metrics);
+    if (changes & sn::CHG_STARTUP)     SetStartWithWindows(cfg.start_with_windows);
+    if (changes & sn::CHG_WHEEL_BLOCK) UpdateWheelBlockHook(cfg.wheel_block);
+
+    if ((changes & sn::CHG_HOTKEYS) && g_msgWnd) {
         g_hotkeys.Unregister(g_msgWnd);
         int hotkeyCount = g_hotkeys.Register(g_msgWnd,
             cfg.hotkeys.toggle_enabled,
@@ -321,6 +635,113 @@ static void ApplyConfig() {
     }
 }
 
+// ─────────── Profiles ───────────
+static void RebuildProfiles() {
+    const auto& base = g_configStore.Get();
+    g_profiles.Build(base, g_presets);
+    g_activeProfile = ResolveProfile();
+}
+
+// Pinned over the command channel, else by the foreground app (if
+// auto_profile), else the base config
+static int ResolveProfile() {
+    if (!g_pinnedProfile.empty()) return g_profiles.FindId(g_pinnedProfile);
+    return g_configStore.Get().auto_profile ? g_profiles.Find(g_foregroundExe, g_foregroundClass)
+                                            : sn::ProfileIndex::kBase;
+}
+
+// Built-in presets are compiled in; presets/*.json next to the exe add
+// user presets on top (same id → the file replaces the built-in one).
+static void LoadPresets() {
+    g_presets = sn::BuiltinPresets();
+
+    wchar_t buf[MAX_PATH];
+    GetModuleFileNameW(nullptr, buf, MAX_PATH);
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(
+             std::filesystem::path(buf).parent_path() / "presets", ec)) {
+        if (entry.path().extension() != ".json") continue;
+        sn::ProfileConfig preset;
+        auto res = sn::LoadPresetFile(entry.path().string(), preset);
+        for (const auto& d : res.diagnostics) {
+            if (d.severity == sn::ConfigDiagnostic::Severity::Info) continue;
+            std::string line = "ScrollNice: preset " + entry.path().filename().string() + " " +
+                               d.path + ": " + d.message + "\n";
+            OutputDebugStringA(line.c_str());
+        }
+        if (!res.complete) continue;
+
+        bool replaced = false;
+        for (auto& p : g_presets)
+            if (p.id == preset.id) { p = preset; replaced = true; }
+        if (!replaced) g_presets.push_back(std::move(preset));
+    }
+}
+
+// Foreground window changed (WinEvent hook, on the UI thread). One hash
+// lookup; the subsystems are only touched when the profile changes.
+static void OnForegroundApp(const sn::ForegroundApp& app) {
+    g_foregroundExe   = app.exe;
+    g_foregroundClass = app.windowClass;
+    if (!g_configStore.Get().auto_profile || !g_pinnedProfile.empty()) return;
+
+    int profile = g_profiles.Find(app.exe, app.windowClass);
+    if (profile == g_activeProfile) return;
+    g_activeProfile = profile;
+    CancelScroll();
+    ApplyActiveConfig();
+
+    std::string line = "ScrollNice: profile " +
+        (profile == sn::ProfileIndex::kBase ? std::string("(none)") : g_profiles.Id(profile)) +
+        " for " + app.exe + "\n";
+    OutputDebugStringA(line.c_str());
+}
+
+// ─────────── UI language ───────────
+static void ApplyLanguage(const std::string& lang) {
+    if (g_languageLoaded && lang == g_language) return;
+    const bool first = !g_languageLoaded;
+    g_language       = lang;
+    g_languageLoaded = true;
+    sn::SetLanguage(lang);
+    if (first) return;   // WinMain maps it before any UI exists
+
+    g_tray.RefreshStrings();
+    if (g_overlay.Handle()) g_overlay.RefreshStrings();
+    if (g_mainWindow.Handle()) PostMessageW(g_msgWnd, WM_LANGUAGE_CHANGED, 0, 0);
+}
+
+// ─────────── Config hot reload ───────────
+// config.json changed on disk: an editor, a sync tool, or our own save
+// echoing back (which diffs to nothing). Fields that fail to parse keep
+// their defaults, so a half-finished edit never takes the app down.
+static void ReloadConfig() {
+    // A write of ours is queued or in flight: look again once it's done
+    // (an edit that came in meanwhile would otherwise never be read)
+    if (g_persister.Busy()) {
+        SetTimer(g_msgWnd, TIMER_ID_CONFIG_RELOAD, kConfigReloadDelayMs, nullptr);
+        return;
+    }
+
+    sn::ConfigStore fresh;
+    if (!fresh.Load(g_configPath)) return;   // missing or mid-write; the next change retries
+    if (sn::DiffConfig(g_configStore.Get(), fresh.Get()) == sn::CHG_NONE) return;
+
+    LogConfigDiagnostics(fresh);
+    g_configStore.Get() = fresh.Get();
+    g_persister.SetTarget(g_configPath, g_configStore.Get());
+    ApplyConfig();
+    if (g_mainWindow.Handle()) g_mainWindow.SyncFromConfig(g_configStore.Get());
+}
+
+static void LogConfigDiagnostics(const sn::ConfigStore& store) {
+    for (const auto& d : store.Diagnostics()) {
+        std::string line = "ScrollNice: config " + (d.path.empty() ? std::string("file") : d.path) +
+                           ": " + d.message + "\n";
+        OutputDebugStringA(line.c_str());
+    }
+}
+
 // ─────────── Main window events ───────────
 static void OnMainWindowEvent(int eventId) {
     auto& cfg = g_configStore.Get();
@@ -329,7 +750,10 @@ static void OnMainWindowEvent(int eventId) {
     case sn::WinMainWindow::EVT_ZONE_TOGGLED: {
         bool checked = (IsDlgButtonChecked(g_mainWindow.Handle(), 101) == BST_CHECKED);
         cfg.enabled = checked;
+        g_appliedConfig.enabled = checked;
+        RebuildProfiles();
         g_stateMachine.SetEnabled(checked);
+        if (checked) EnsureOverlay();
         g_overlay.SetEnabled(checked);
         g_tray.SetEnabled(checked);
         break;
@@ -339,36 +763,39 @@ static void OnMainWindowEvent(int eventId) {
         if (idx == 0) cfg.scroll.mode = "click_hold";
         if (idx == 1) cfg.scroll.mode = "split_hold";
         if (idx == 2) cfg.scroll.mode = "hover_auto";
+        g_appliedConfig.scroll.mode = cfg.scroll.mode;
+        RebuildProfiles();
         g_overlay.SetScrollMode(sn::ScrollModeFromString(cfg.scroll.mode));
         g_tray.SetModeName(cfg.scroll.mode);
-        StopHoldScroll();
-        StopHoverScroll();
+        DispatchModeChanged();
         break;
     }
     case sn::WinMainWindow::EVT_OPACITY_CHANGED: {
         int pos = (int)SendDlgItemMessage(g_mainWindow.Handle(), 114, TBM_GETPOS, 0, 0);
         cfg.zone.opacity = pos / 100.0;
+        g_appliedConfig.zone.opacity = cfg.zone.opacity;
+        RebuildProfiles();
         g_overlay.SetOpacity(cfg.zone.opacity);
         break;
     }
     case sn::WinMainWindow::EVT_SAVE: {
         // Already read into cfg by WinMainWindow::ReadControls
-        g_configStore.Save(g_configPath);
-        StopHoldScroll();
-        StopHoverScroll();
+        g_persister.Submit(g_configStore.Get());
+        CancelScroll();
         ApplyConfig();
         g_mainWindow.SyncFromConfig(cfg);
         break;
     }
     case sn::WinMainWindow::EVT_RESET: {
-        g_configStore.Save(g_configPath);
-        StopHoldScroll();
-        StopHoverScroll();
+        g_persister.Submit(g_configStore.Get());
+        CancelScroll();
         ApplyConfig();
         break;
     }
     case sn::WinMainWindow::EVT_MINIMIZE:
-        // X was pressed — window already hidden by WinMainWindow
+        // X was pressed — window already hidden by WinMainWindow.
+        // Release the whole settings UI if it stays hidden.
+        SetTimer(g_msgWnd, TIMER_ID_SETTINGS_IDLE, kSettingsIdleReleaseMs, nullptr);
         break;
     }
 }
@@ -392,8 +819,10 @@ static void SetStartWithWindows(bool enable) {
             wchar_t path[MAX_PATH];
             DWORD len = GetModuleFileNameW(nullptr, path, MAX_PATH);
             if (len > 0 && len < MAX_PATH) {
+                // Logon start goes straight to the tray (see --tray in WinMain)
+                std::wstring cmd = L"\"" + std::wstring(path) + L"\" --tray";
                 RegSetValueExW(hKey, L"ScrollNice", 0, REG_SZ,
-                    (BYTE*)path, (DWORD)(wcslen(path) + 1) * sizeof(wchar_t));
+                    (const BYTE*)cmd.c_str(), (DWORD)(cmd.size() + 1) * sizeof(wchar_t));
             }
         } else {
             RegDeleteValueW(hKey, L"ScrollNice");
@@ -431,39 +860,230 @@ static void OnHotkey(int id) {
     case sn::WinHotkeys::HK_TOGGLE_ENABLED:
         g_stateMachine.ToggleEnabled();
         g_tray.SetEnabled(g_stateMachine.IsEnabled());
+        if (g_stateMachine.IsEnabled()) EnsureOverlay();
         g_overlay.SetEnabled(g_stateMachine.IsEnabled());
         {
             auto& cfg = g_configStore.Get();
             cfg.enabled = g_stateMachine.IsEnabled();
+            g_appliedConfig.enabled = cfg.enabled;
+            RebuildProfiles();
             g_mainWindow.SyncFromConfig(cfg);
         }
         break;
     case sn::WinHotkeys::HK_TOGGLE_EDIT:
         g_stateMachine.ToggleEdit();
+        if (g_stateMachine.IsEditing()) EnsureOverlay();
         g_overlay.SetEditMode(g_stateMachine.IsEditing());
         break;
     case sn::WinHotkeys::HK_TOGGLE_WHEEL: {
         auto& cfg = g_configStore.Get();
         cfg.wheel_block = !cfg.wheel_block;
+        g_appliedConfig.wheel_block = cfg.wheel_block;
+        RebuildProfiles();
         UpdateWheelBlockHook(cfg.wheel_block);
-        g_configStore.Save(g_configPath);
+        g_persister.Submit(g_configStore.Get());
         g_mainWindow.SyncFromConfig(cfg);
         break;
     }
     }
 }
 
+// ─────────── Command channel ───────────
+// Runs on the server thread: hand the request to the UI thread and wait
+// for it there. A request the UI thread hasn't started within a second
+// (busy, or gone from the message loop) is cancelled: the client hears
+// TimedOut and the request never runs.
+static sn::CommandReply PostCommand(const sn::Command& cmd) {
+    // Shared with the UI thread, which may get to it after we gave up
+    auto call = std::make_shared<RemoteCommand>();
+    call->cmd = cmd;
+    auto reply = call->reply.get_future();
+    auto* posted = new std::shared_ptr<RemoteCommand>(call);
+    if (!PostMessageW(g_msgWnd, WM_REMOTE_COMMAND, 0, reinterpret_cast<LPARAM>(posted))) {
+        delete posted;
+        return sn::CommandReply{sn::CommandStatus::Rejected};
+    }
+    if (reply.wait_for(std::chrono::seconds(1)) != std::future_status::ready) {
+        // Still queued: drop it, so the client's answer is the truth.
+        // Already running: it finishes soon, wait for its reply.
+        int queued = RemoteCommand::Queued;
+        if (call->state.compare_exchange_strong(queued, RemoteCommand::Cancelled))
+            return sn::CommandReply{sn::CommandStatus::TimedOut};
+    }
+    return reply.get();
+}
+
+// Same effects as the tray menu and the hotkeys.
+static sn::CommandReply ExecuteCommand(const sn::Command& cmd) {
+    sn::CommandReply reply;
+    sn::ScrollInput in;
+    in.time = NowSeconds();
+    switch (cmd.op) {
+    case sn::CommandOp::ScrollBy: {
+        if (!g_stateMachine.IsIn(sn::AppState::Active)) {
+            reply.status = sn::CommandStatus::Rejected;
+            break;
+        }
+        // WM_MOUSEWHEEL carries a 16-bit delta
+        const int px = (int)std::min<int64_t>(std::llabs(cmd.pixels), 20000);
+        AimScroll();
+        g_scrollEngine.ClickScroll(cmd.pixels > 0 ? 1 : -1, px);
+        break;
+    }
+    case sn::CommandOp::StartScroll:
+        in.direction = cmd.direction;
+        in.speed     = cmd.speed;
+        if (g_stateMachine.State() == sn::AppState::Idle)
+            AimScroll();
+        if (!g_stateMachine.Dispatch(sn::ScrollEvent::ScriptStart, in))
+            reply.status = sn::CommandStatus::Rejected;   // disabled, editing or the user is scrolling
+        break;
+    case sn::CommandOp::StopScroll:
+        g_stateMachine.Dispatch(sn::ScrollEvent::ScriptStop, in);
+        break;
+    case sn::CommandOp::SetProfile: {
+        if (!cmd.profile.empty() && g_profiles.FindId(cmd.profile) == sn::ProfileIndex::kBase) {
+            reply.status = sn::CommandStatus::UnknownProfile;
+            break;
+        }
+        g_pinnedProfile = cmd.profile;
+        const int profile = ResolveProfile();
+        if (profile == g_activeProfile) break;
+        g_activeProfile = profile;
+        CancelScroll();
+        ApplyActiveConfig();
+        break;
+    }
+    case sn::CommandOp::Set: {
+        bool current;
+        int hotkey;
+        switch (cmd.target) {
+        case sn::CommandSwitch::Enabled:
+            current = g_stateMachine.IsEnabled();
+            hotkey  = sn::WinHotkeys::HK_TOGGLE_ENABLED;
+            break;
+        case sn::CommandSwitch::Edit:
+            current = g_stateMachine.IsEditing();
+            hotkey  = sn::WinHotkeys::HK_TOGGLE_EDIT;
+            break;
+        default:
+            current = g_configStore.Get().wheel_block;
+            hotkey  = sn::WinHotkeys::HK_TOGGLE_WHEEL;
+            break;
+        }
+        const bool wanted = cmd.value == 2 ? !current : cmd.value == 1;
+        if (wanted != current) OnHotkey(hotkey);
+        // Edit mode needs the zone enabled
+        if (cmd.target == sn::CommandSwitch::Edit && g_stateMachine.IsEditing() != wanted)
+            reply.status = sn::CommandStatus::Rejected;
+        break;
+    }
+    case sn::CommandOp::QueryState:
+    case sn::CommandOp::Subscribe:   // the server adds the connection to the feed
+        reply = CommandState();
+        break;
+    }
+    return reply;
+}
+
+// The state block of QueryState/Subscribe replies and feed State events
+static sn::CommandReply CommandState() {
+    const auto& cfg = ActiveConfig();
+    const auto clamp16 = [](int v) { return (uint16_t)std::clamp(v, 0, 65535); };
+    sn::CommandReply state;
+    state.flags = (g_stateMachine.IsEnabled() ? sn::kStateEnabled : 0) |
+                  (g_stateMachine.IsEditing() ? sn::kStateEditing : 0) |
+                  (g_configStore.Get().wheel_block ? sn::kStateWheelBlock : 0) |
+                  (g_configStore.Get().auto_profile && g_pinnedProfile.empty() ? sn::kStateAutoProfile : 0);
+    state.state            = (uint8_t)g_stateMachine.State();
+    state.profile          = g_profiles.Id(g_activeProfile);
+    state.mode             = cfg.scroll.mode;
+    state.scroll_amount    = clamp16(cfg.scroll.scroll_amount);
+    state.continuous_speed = clamp16(cfg.scroll.continuous_speed);
+    state.continuous_accel = clamp16(cfg.scroll.continuous_accel);
+    state.hover_speed      = clamp16(cfg.scroll.hover_speed);
+    return state;
+}
+
+// Tells feed subscribers about the active profile when it changes.
+static void PublishFeedState() {
+    if (!g_commandServer) return;
+    sn::FeedEvent event;
+    event.kind  = sn::FeedEventKind::State;
+    event.state = CommandState();
+    event.state.state = 0;   // not news: it changes with every scroll
+    std::string frame = sn::EncodeFeedEvent(event);
+    if (frame == g_feedState) return;
+    g_feedState = std::move(frame);
+    g_commandServer->Publish(0, g_feedState);
+}
+
+// ScrollEngine pixel route: scrolling aimed at a browser whose
+// extension has subscribed goes to the page as exact pixel deltas. Only
+// for the foreground browser window, since the extension scrolls the
+// active tab of the focused window.
+static bool RouteToBrowser(HWND target, double dy, double dt) {
+    if (!g_commandServer) return false;
+    HWND root = GetAncestor(target, GA_ROOT);
+    DWORD pid = 0;
+    if (!root || root != GetForegroundWindow() || !GetWindowThreadProcessId(root, &pid)) return false;
+    sn::FeedEvent event;
+    event.dy = dy;
+    event.dt = dt;
+    if (!g_commandServer->Publish(pid, sn::EncodeFeedEvent(event))) return false;
+    g_bridgeFrames.Add();
+    return true;
+}
+
+// ─────────── Lazy UI construction ───────────
+static bool EnsureOverlay() {
+    if (g_overlay.Handle()) return true;
+    if (!g_overlay.Create(g_hInstance, ActiveConfig().zone, OnZoneEvent)) {
+        MessageBoxW(nullptr, L"Failed to create zone overlay.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
+        return false;
+    }
+    return true;
+}
+
+static bool EnsureMainWindow() {
+    if (g_mainWindow.Handle()) return true;
+    if (!g_mainWindow.Create(g_hInstance, g_configStore.Get(),
+        // onSave callback
+        [](const sn::AppConfig& newCfg) {
+            g_configStore.Get() = newCfg;
+            g_persister.Submit(g_configStore.Get());
+            CancelScroll();
+            ApplyConfig();
+        },
+        // onEvent callback
+        OnMainWindowEvent
+    )) {
+        MessageBoxW(nullptr, L"Failed to create main window.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
+        return false;
+    }
+    return true;
+}
+
+static void ShowMainWindow() {
+    if (g_msgWnd) KillTimer(g_msgWnd, TIMER_ID_SETTINGS_IDLE);
+    if (EnsureMainWindow()) g_mainWindow.Show();
+}
+
 // ─────────── Entry Point ───────────
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR cmdLine, int) {
+    sn::StartupProfiler profile;
     g_hInstance = hInstance;
+    // --tray: started at logon — bring up only the tray, hotkeys and zone
+    const bool trayOnly = cmdLine && strstr(cmdLine, "--tray") != nullptr;
 
     HANDLE hMutex = CreateMutexW(nullptr, TRUE, L"ScrollNice_SingleInstance");
     if (GetLastError() == ERROR_ALREADY_EXISTS) {
-        // Find existing main window and bring it to front
-        HWND existing = FindWindowW(L"ScrollNice_MainWindow", nullptr);
+        // Ask the running instance to show its settings window. Its message
+        // window always exists; the settings window may not have been built.
+        HWND existing = FindWindowExW(HWND_MESSAGE, nullptr, kMsgWindowClass, nullptr);
         if (existing) {
-            ShowWindow(existing, SW_SHOW);
-            SetForegroundWindow(existing);
+            AllowSetForegroundWindow(ASFW_ANY);
+            PostMessageW(existing, WM_COMMAND, MAKEWPARAM(sn::WinTray::ID_SETTINGS, 0), 0);
         } else {
             MessageBoxW(nullptr, L"ScrollNice is already running.", L"ScrollNice", MB_OK | MB_ICONINFORMATION);
         }
@@ -478,7 +1098,11 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         // Config load failed - use defaults and save
         g_configStore.Save(g_configPath);
     }
-    auto& cfg = g_configStore.Get();
+    LogConfigDiagnostics(g_configStore);
+    g_persister.SetTarget(g_configPath, g_configStore.Get());
+    LoadPresets();
+    ApplyLanguage(g_configStore.Get().language);
+    profile.Mark(L"config loaded");
 
     // ─── Hidden message window (for hotkeys + scroll timers) ───
     WNDCLASSEXW wc = {};
@@ -496,49 +1120,56 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         MessageBoxW(nullptr, L"Failed to create message window.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
         return 1;
     }
-
-    // ─── Main window (visible GUI) ───
-    if (!g_mainWindow.Create(hInstance, cfg,
-        // onSave callback
-        [](const sn::AppConfig& newCfg) {
-            g_configStore.Get() = newCfg;
-            g_configStore.Save(g_configPath);
-            StopHoldScroll();
-            StopHoverScroll();
-            ApplyConfig();
-        },
-        // onEvent callback
-        OnMainWindowEvent
-    )) {
-        MessageBoxW(nullptr, L"Failed to create main window.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
-        DestroyWindow(g_msgWnd);
-        return 1;
-    }
-
-    // ─── Zone overlay ───
-    if (!g_overlay.Create(hInstance, cfg.zone, OnZoneEvent)) {
-        MessageBoxW(nullptr, L"Failed to create zone overlay.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
-        g_mainWindow.Destroy();
-        DestroyWindow(g_msgWnd);
-        return 1;
-    }
+    if (!g_framePacer.Start(g_msgWnd, WM_SCROLL_FRAME))
+        OutputDebugStringA("ScrollNice: no frame pacer thread, scroll ticks fall back to SetTimer\n");
 
     // ─── Tray icon ───
     if (!g_tray.Create(g_msgWnd, hInstance, [](sn::WinTray::MenuItem item) {
         if (g_msgWnd) PostMessage(g_msgWnd, WM_COMMAND, MAKEWPARAM(item, 0), 0);
     })) {
         MessageBoxW(nullptr, L"Failed to create tray icon.", L"ScrollNice Error", MB_OK | MB_ICONERROR);
-        g_overlay.Destroy();
-        g_mainWindow.Destroy();
         DestroyWindow(g_msgWnd);
         return 1;
     }
+    profile.Mark(L"message window + tray");
+
+    g_stateMachine.SetSink(&g_scrollSink);
 
-    // ─── Apply config (registers hotkeys, hooks, shows overlay/tray state) ───
+    // ─── Foreground tracking first, so the first apply picks the right profile ───
+    sn::WinForegroundWatcher::Instance().Install(OnForegroundApp);
+
+    // ─── Apply config (registers hotkeys, hooks; creates the zone if enabled) ───
     ApplyConfig();
+    profile.Mark(L"config applied (zone, hotkeys)");
+
+    // ─── Hot reload: watch config.json for external edits ───
+    g_configWatcher = sn::CreateFileWatcher();
+    if (!g_configWatcher->Start(g_configPath, [] { PostMessageW(g_msgWnd, WM_CONFIG_CHANGED, 0, 0); }))
+        g_configWatcher.reset();
 
-    // ─── Show main window ───
-    g_mainWindow.Show();
+    // ─── Command channel: scrollnice_ctl, scripts, the browser bridge ───
+    g_commandServer = sn::CreateCommandServer();
+    if (!g_commandServer->Start(PostCommand)) {
+        std::string line = "ScrollNice: command channel unavailable: " + g_commandServer->Endpoint() + "\n";
+        OutputDebugStringA(line.c_str());
+        g_commandServer.reset();
+    }
+    g_scrollEngine.SetPixelRoute(RouteToBrowser);
+
+    // ─── Wheel delivery learned per target app (what scrolled it last time) ───
+    g_deliveryPath = (std::filesystem::path(g_configPath).parent_path() / "delivery.json").string();
+    g_deliveryTable.Load(g_deliveryPath);
+    sn::WinScrollWatcher::Instance().SetCallback(
+        [](HWND hwnd, LONG idObject) { g_scrollEngine.OnTargetScrolled(hwnd, idObject); });
+    g_scrollEngine.SetDeliveryTable(&g_deliveryTable);
+    g_scrollEngine.SetBoundary(&g_boundary, &g_patternScroller);   // no wheel into an end
+
+    // ─── Main window: built and shown now unless started from the tray ───
+    if (!trayOnly) {
+        ShowMainWindow();
+        profile.Mark(L"settings window");
+    }
+    profile.Report();
 
     // ─── Message loop ───
     MSG msg;
@@ -548,23 +1179,48 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
     }
 
     // ─── Cleanup ───
-    StopHoldScroll();
-    StopHoverScroll();
+    g_commandServer.reset();   // a request in flight is refused (the loop is gone)
+    if (g_configWatcher) g_configWatcher->Stop();   // our exit save is not an external edit
+    CancelScroll();
+    g_framePacer.Stop();
+    g_patternScroller.Clear();   // UIA elements go before UIA itself
+    g_uiaScroll.Shutdown();
+    g_panPlanner.Cancel();       // no finger left down on the screen
+    g_touchInjector.Shutdown();
+    LogStateMachineStats();
+    {
+        const auto stats = g_sound.Stats();
+        char line[160];
+        snprintf(line, sizeof(line),
+                 "ScrollNice: click sound: %llu played, %llu dropped, trigger to sample %.0f us mean, %.0f us max\n",
+                 (unsigned long long)stats.played, (unsigned long long)stats.dropped, stats.meanUs, stats.maxUs);
+        OutputDebugStringA(line);
+    }
+    g_sound.Stop();
+    g_metricsServer.reset();
+    sn::WinForegroundWatcher::Instance().Uninstall();
+    sn::WinScrollWatcher::Instance().Uninstall();
     sn::WinMouseHook::Instance().Uninstall();
     g_hotkeys.Unregister(g_msgWnd);
     g_tray.Destroy();
 
-    // Save zone position on exit
-    auto& exitCfg = g_configStore.Get();
-    exitCfg.zone.x = g_overlay.Config().x;
-    exitCfg.zone.y = g_overlay.Config().y;
-    exitCfg.zone.width = g_overlay.Config().width;
-    exitCfg.zone.height = g_overlay.Config().height;
-    g_configStore.Save(g_configPath);
+    // Save zone position on exit (only if the zone was ever created/moved,
+    // and not a profile's geometry over the user's own)
+    if (g_overlay.Handle() && g_activeProfile == sn::ProfileIndex::kBase) {
+        auto& exitCfg = g_configStore.Get();
+        exitCfg.zone.x = g_overlay.Config().x;
+        exitCfg.zone.y = g_overlay.Config().y;
+        exitCfg.zone.width = g_overlay.Config().width;
+        exitCfg.zone.height = g_overlay.Config().height;
+        g_persister.Submit(exitCfg);
+    }
+    g_persister.Flush();   // the one place we wait for the disk
+    g_deliveryTable.Save(g_deliveryPath);
 
     g_overlay.Destroy();
     g_mainWindow.Destroy();
     DestroyWindow(g_msgWnd);
+    sn::GdiPool::Instance().Shutdown();   // reports any handle still referenced
     ReleaseMutex(hMutex);
     CloseHandle(hMutex);
     return 0;
@@ -0,0 +1,199 @@
+// ScrollNice for Linux: the same scroll engine (StateMachine) driven from
+// evdev and delivered through a uinput virtual pointer. No display
+// server code: the zone is an invisible rectangle at the configured
+// position, hit-tested against the pointer position EvdevInput tracks.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "core/Config.h"
+#include "core/StateMachine.h"
+#include "core/TickSchedule.h"
+#include "platform/linux/LinuxEvdev.h"
+#include "platform/linux/LinuxUinput.h"
+
+using Clock = std::chrono::steady_clock;
+
+static volatile std::sig_atomic_t g_stop = 0;
+
+static sn::ConfigStore  g_configStore;
+static sn::StateMachine g_stateMachine;
+static sn::UinputDevice g_uinput;
+static sn::EvdevInput   g_input;
+
+static const char* kDeviceName = "ScrollNice virtual pointer";
+
+enum HotkeyId { HK_TOGGLE_ENABLED = 1 };
+
+static double NowSeconds() {
+    return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+}
+
+// ─────────── Scroll state machine ───────────
+// Ticks come from the poll timeout in main(), when the next whole
+// hi-res wheel unit is due; every step is one uinput frame.
+class LinuxScrollSink : public sn::ScrollSink {
+public:
+    void StartTicks() override { schedule.Start(NowSeconds()); }
+    void StopTicks() override { schedule.Stop(NowSeconds()); }
+    void ClickScroll(int direction, int amount) override {
+        g_uinput.Scroll(direction * amount, 0.0);
+        g_uinput.Flush();
+    }
+    void ScrollTick(int direction, double speed, bool steady) override {
+        g_uinput.Scroll(direction * speed * schedule.Span(), 0.0);
+        g_uinput.Flush();
+        schedule.After(speed > 0.0 ? g_uinput.PxToNextUnitY(direction) / speed : HUGE_VAL, steady);
+    }
+    void ResetScroll() override {}
+
+    sn::TickSchedule schedule;
+};
+static LinuxScrollSink g_scrollSink;
+
+// ─────────── Zone ───────────
+static bool g_inZone = false;
+static bool g_pressed[3] = {};
+
+static bool InZone(int x, int y) {
+    const auto& z = g_configStore.Get().zone;
+    return x >= z.x && x < z.x + z.width && y >= z.y && y < z.y + z.height;
+}
+
+static sn::ScrollInput ZoneInput(int button, int y) {
+    const auto& z = g_configStore.Get().zone;
+    sn::ScrollInput in;
+    in.button  = button;
+    in.topHalf = y - z.y < z.height / 2;
+    in.time    = NowSeconds();
+    return in;
+}
+
+// True: the event belongs to the zone (not forwarded to the desktop)
+static bool OnPointer(const sn::PointerEvent& e) {
+    const bool inside = g_stateMachine.IsIn(sn::AppState::Active) && InZone(e.x, e.y);
+    if (e.kind == sn::PointerEvent::Move) {
+        if (inside) {
+            g_stateMachine.Dispatch(sn::ScrollEvent::Hover, ZoneInput(0, e.y));
+        } else if (g_inZone) {
+            sn::ScrollInput in;
+            in.time = NowSeconds();
+            g_stateMachine.Dispatch(sn::ScrollEvent::Leave, in);
+        }
+        g_inZone = inside;
+        return false;
+    }
+    if (e.button > 1) return false;
+    if (e.down) {
+        if (!inside) return false;
+        g_pressed[e.button] = true;
+        g_stateMachine.Dispatch(sn::ScrollEvent::Press, ZoneInput(e.button, e.y));
+        return true;
+    }
+    if (!g_pressed[e.button]) return false;
+    g_pressed[e.button] = false;
+    g_stateMachine.Dispatch(sn::ScrollEvent::Release, ZoneInput(e.button, e.y));
+    return true;
+}
+
+static void OnHotkey(int id) {
+    if (id != HK_TOGGLE_ENABLED) return;
+    g_stateMachine.ToggleEnabled();
+    std::fprintf(stderr, "scrollnice: %s\n", g_stateMachine.IsEnabled() ? "enabled" : "disabled");
+}
+
+// ─────────── Setup ───────────
+static std::string GetConfigPath(int argc, char** argv) {
+    if (argc > 1) return argv[1];
+    std::filesystem::path dir;
+    if (const char* xdg = std::getenv("XDG_CONFIG_HOME"); xdg && *xdg) dir = xdg;
+    else if (const char* home = std::getenv("HOME")) dir = std::filesystem::path(home) / ".config";
+    return (dir / "scrollnice" / "config.json").string();
+}
+
+// Mode of the first connected output, straight from DRM; 1920x1080 if
+// there is none (a headless box, no permission)
+static void DetectScreen(int& width, int& height) {
+    width = 1920;
+    height = 1080;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/class/drm", ec)) {
+        std::ifstream status(entry.path() / "status"), modes(entry.path() / "modes");
+        std::string s, mode;
+        if (!std::getline(status, s) || s != "connected" || !std::getline(modes, mode)) continue;
+        int w = 0, h = 0;
+        if (std::sscanf(mode.c_str(), "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+            width = w;
+            height = h;
+            return;
+        }
+    }
+}
+
+static void OnSignal(int) { g_stop = 1; }
+
+int main(int argc, char** argv) {
+    const std::string configPath = GetConfigPath(argc, argv);
+    if (!g_configStore.Load(configPath))
+        std::fprintf(stderr, "scrollnice: %s: using defaults\n", configPath.c_str());
+    const auto& cfg = g_configStore.Get();
+
+    if (!g_uinput.Open(kDeviceName)) {
+        std::fprintf(stderr, "scrollnice: can't create a uinput device (is /dev/uinput writable?)\n");
+        return 1;
+    }
+    if (!g_input.Open(kDeviceName, &g_uinput)) {
+        std::fprintf(stderr, "scrollnice: no keyboard or mouse in /dev/input (join the \"input\" group)\n");
+        return 1;
+    }
+    int width, height;
+    DetectScreen(width, height);
+    g_input.SetScreen(width, height);
+    if (!g_input.AddHotkey(HK_TOGGLE_ENABLED, cfg.hotkeys.toggle_enabled))
+        std::fprintf(stderr, "scrollnice: hotkey \"%s\" not understood\n", cfg.hotkeys.toggle_enabled.c_str());
+    g_input.OnHotkey(OnHotkey);
+    g_input.OnPointer(OnPointer);
+    std::fprintf(stderr, "scrollnice: %zu keyboard(s), %zu pointer(s), screen %dx%d, zone %d,%d %dx%d\n",
+                 g_input.Keyboards(), g_input.Pointers(), width, height, cfg.zone.x, cfg.zone.y,
+                 cfg.zone.width, cfg.zone.height);
+
+    g_stateMachine.SetSink(&g_scrollSink);
+    g_stateMachine.SetTuning(cfg.scroll);
+    sn::ScrollInput mode;
+    mode.mode = sn::ScrollModeFromString(cfg.scroll.mode);
+    g_stateMachine.Dispatch(sn::ScrollEvent::ModeChanged, mode);
+    g_stateMachine.SetEnabled(cfg.enabled);
+
+    // No SA_RESTART: the signal has to interrupt poll()
+    struct sigaction sa{};
+    sa.sa_handler = OnSignal;
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    while (!g_stop) {
+        int timeout = -1;
+        if (g_scrollSink.schedule.Running()) {
+            const double wait = g_scrollSink.schedule.Due() - NowSeconds();
+            timeout = (int)std::ceil(std::max(0.0, wait) * 1000.0);
+        }
+        if (!g_input.Poll(timeout) && g_input.Keyboards() + g_input.Pointers() == 0) break;
+
+        const double now = NowSeconds();
+        if (g_scrollSink.schedule.Running() && now >= g_scrollSink.schedule.Due()) {
+            g_scrollSink.schedule.Tick(now);
+            sn::ScrollInput in;
+            in.time = now;
+            g_stateMachine.Dispatch(sn::ScrollEvent::Tick, in);
+        }
+    }
+
+    g_input.Close();   // ungrab before the forwarding device goes away
+    g_uinput.Close();
+    return 0;
+}
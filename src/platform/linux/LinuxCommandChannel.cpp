@@ -0,0 +1,217 @@
+#include "../../core/CommandChannel.h"
+#include "LinuxSocket.h"
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace sn {
+
+static std::string CommandSocketPath() { return RuntimeSocketPath("scrollnice-command.sock"); }
+
+static bool SendAll(int fd, const std::string& data) {
+    for (size_t sent = 0; sent < data.size();) {
+        const ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    return true;
+}
+
+// ─────── Server ───────
+// One poll() loop over the listening socket, the stop pipe and the
+// clients; requests are answered in the order they arrive. Feed frames
+// are written straight from the publishing thread; mutex_ keeps the
+// client list steady under it.
+class UnixCommandServer : public CommandServer {
+public:
+    UnixCommandServer() : path_(CommandSocketPath()) {}
+    ~UnixCommandServer() override { Stop(); }
+
+    bool Start(Handler handler) override {
+        Stop();
+        handler_ = std::move(handler);
+        fd_ = ListenUnixSocket(path_);
+        if (fd_ < 0) return false;
+        if (pipe2(stopPipe_, O_CLOEXEC) != 0) {
+            Close();
+            return false;
+        }
+        thread_ = std::thread(&UnixCommandServer::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            char c = 0;
+            (void)!write(stopPipe_[1], &c, 1);
+            thread_.join();
+        }
+        Close();
+    }
+
+    std::string Endpoint() const override { return path_; }
+
+    bool Publish(uint32_t pid, const std::string& frame) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool matched = false;
+        for (auto& c : clients_) {
+            if (!c.subscribed || (pid && c.pid != pid)) continue;
+            matched = true;
+            const ssize_t n = send(c.fd, frame.data(), frame.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+            // Full socket buffer: skip this frame. A partial write would
+            // break the framing, so that subscriber is cut off instead
+            // (the server loop sees the hang-up and drops it).
+            if (n > 0 && (size_t)n < frame.size()) shutdown(c.fd, SHUT_RDWR);
+        }
+        return matched;
+    }
+
+private:
+    struct Client {
+        int         fd;
+        FrameReader reader;
+        bool        subscribed = false;
+        uint32_t    pid        = 0;
+    };
+
+    void Run() {
+        std::vector<pollfd> fds;
+        char buf[4096];
+        for (;;) {
+            fds.clear();
+            fds.push_back({stopPipe_[0], POLLIN, 0});
+            fds.push_back({fd_, (short)(clients_.size() < (size_t)kMaxClients ? POLLIN : 0), 0});
+            for (const auto& c : clients_) fds.push_back({c.fd, POLLIN, 0});
+            if (poll(fds.data(), fds.size(), -1) < 0) continue;
+            if (fds[0].revents) return;
+
+            // Clients first: accepting below may grow clients_
+            for (size_t i = clients_.size(); i-- > 0;) {
+                if (!fds[2 + i].revents) continue;
+                const ssize_t n = recv(clients_[i].fd, buf, sizeof(buf), 0);
+                if (n <= 0 || !Serve(clients_[i], buf, (size_t)n)) Drop(i);
+            }
+            if (fds[1].revents & POLLIN) {
+                const int fd = accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC);
+                if (fd >= 0) {
+                    // A client that stops reading mustn't stall the others
+                    timeval timeout{1, 0};
+                    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    clients_.push_back(Client{fd, FrameReader{}});
+                }
+            }
+        }
+    }
+
+    // False: drop the client (bad framing or it stopped reading)
+    bool Serve(Client& c, const char* data, size_t size) {
+        if (c.subscribed) return true;   // the feed is one-way
+        c.reader.Append(data, size);
+        std::string body;
+        while (c.reader.Next(body)) {
+            Command cmd;
+            CommandReply reply;
+            if (DecodeCommand(body, cmd)) reply = handler_(cmd);
+            else                          reply.status = CommandStatus::BadRequest;
+            if (!SendAll(c.fd, EncodeReply(cmd.op, reply))) return false;
+            if (cmd.op == CommandOp::Subscribe && reply.status == CommandStatus::Ok) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                c.subscribed = true;
+                c.pid        = cmd.pid;
+                return true;
+            }
+        }
+        return !c.reader.Bad();
+    }
+
+    void Drop(size_t i) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        close(clients_[i].fd);
+        clients_.erase(clients_.begin() + (std::ptrdiff_t)i);
+    }
+
+    void Close() {
+        while (!clients_.empty()) Drop(clients_.size() - 1);
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+            unlink(path_.c_str());
+        }
+        for (int& p : stopPipe_)
+            if (p >= 0) { close(p); p = -1; }
+    }
+
+    std::string         path_;
+    Handler             handler_;
+    int                 fd_          = -1;
+    int                 stopPipe_[2] = {-1, -1};
+    std::vector<Client> clients_;   // changed by the server thread under mutex_
+    std::mutex          mutex_;
+    std::thread         thread_;
+};
+
+// ─────── Client ───────
+class UnixCommandClient : public CommandClient {
+public:
+    ~UnixCommandClient() override {
+        if (fd_ >= 0) close(fd_);
+    }
+
+    bool Connect() override {
+        const std::string path = CommandSocketPath();
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) return false;
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        return fd_ >= 0 && connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    }
+
+    bool Call(const Command& cmd, CommandReply& reply) override {
+        std::string body;
+        return fd_ >= 0 && SendAll(fd_, EncodeCommand(cmd)) && Receive(body) &&
+               DecodeReply(cmd.op, body, reply);
+    }
+
+    bool Receive(std::string& body) override {
+        char buf[1024];
+        while (!reader_.Next(body)) {
+            if (fd_ < 0 || reader_.Bad()) return false;
+            const ssize_t n = recv(fd_, buf, sizeof(buf), 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return false;
+            reader_.Append(buf, (size_t)n);
+        }
+        return true;
+    }
+
+    // shutdown() rather than close(): wakes a recv() blocked on another
+    // thread, and the fd stays valid until the destructor
+    void Close() override {
+        if (fd_ >= 0) shutdown(fd_, SHUT_RDWR);
+    }
+
+private:
+    int         fd_ = -1;
+    FrameReader reader_;
+};
+
+std::unique_ptr<CommandServer> CreateCommandServer() {
+    return std::make_unique<UnixCommandServer>();
+}
+
+std::unique_ptr<CommandClient> CreateCommandClient() {
+    return std::make_unique<UnixCommandClient>();
+}
+
+} // namespace sn
@@ -0,0 +1,221 @@
+#include "LinuxEvdev.h"
+#include "LinuxUinput.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace sn {
+
+// ───── Hotkey specs ─────
+static std::string ToLower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+    return s;
+}
+
+// Evdev codes follow the physical (US) layout, not the alphabet
+static uint16_t LetterKey(char c) {
+    static const char* const kRows[] = {"qwertyuiop", "asdfghjkl", "zxcvbnm"};
+    static const uint16_t    kFirst[] = {KEY_Q, KEY_A, KEY_Z};
+    for (int r = 0; r < 3; r++)
+        if (const char* p = std::strchr(kRows[r], c)) return (uint16_t)(kFirst[r] + (p - kRows[r]));
+    return 0;
+}
+
+bool ParseEvdevHotkey(const std::string& spec, uint8_t& modifiers, uint16_t& key) {
+    modifiers = 0;
+    key = 0;
+    std::istringstream ss(spec);
+    std::string p;
+    while (std::getline(ss, p, '+')) {
+        while (!p.empty() && p.front() == ' ') p.erase(p.begin());
+        while (!p.empty() && p.back() == ' ') p.pop_back();
+        p = ToLower(p);
+        if (p == "ctrl" || p == "control") modifiers |= kModCtrl;
+        else if (p == "alt")                modifiers |= kModAlt;
+        else if (p == "shift")              modifiers |= kModShift;
+        else if (p == "win" || p == "super" || p == "meta") modifiers |= kModMeta;
+        else if (p.size() == 1 && std::isalpha((unsigned char)p[0])) key = LetterKey(p[0]);
+        else if (p.size() == 1 && std::isdigit((unsigned char)p[0])) key = p[0] == '0' ? KEY_0 : (uint16_t)(KEY_1 + (p[0] - '1'));
+        else if (p.size() >= 2 && p[0] == 'f' && std::isdigit((unsigned char)p[1])) {
+            const int n = std::atoi(p.c_str() + 1);
+            if (n >= 1 && n <= 10) key = (uint16_t)(KEY_F1 + n - 1);
+            else if (n == 11)      key = KEY_F11;
+            else if (n == 12)      key = KEY_F12;
+        }
+    }
+    return key != 0;
+}
+
+static uint8_t ModifierBit(uint16_t code) {
+    switch (code) {
+    case KEY_LEFTCTRL:  case KEY_RIGHTCTRL:  return kModCtrl;
+    case KEY_LEFTALT:   case KEY_RIGHTALT:   return kModAlt;
+    case KEY_LEFTSHIFT: case KEY_RIGHTSHIFT: return kModShift;
+    case KEY_LEFTMETA:  case KEY_RIGHTMETA:  return kModMeta;
+    default: return 0;
+    }
+}
+
+// ───── Devices ─────
+static bool TestBit(const unsigned long* bits, int bit) {
+    constexpr int kLong = 8 * sizeof(unsigned long);
+    return (bits[bit / kLong] >> (bit % kLong)) & 1;
+}
+
+bool EvdevInput::Open(const std::string& skipName, UinputDevice* forwardTo) {
+    Close();
+    forward_ = forwardTo;
+    std::error_code ec;
+    std::vector<std::string> paths;
+    for (const auto& entry : std::filesystem::directory_iterator("/dev/input", ec)) {
+        const std::string leaf = entry.path().filename().string();
+        if (leaf.rfind("event", 0) == 0) paths.push_back(entry.path().string());
+    }
+    std::sort(paths.begin(), paths.end());
+
+    for (const auto& path : paths) {
+        const int fd = open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) continue;
+        char name[256] = {};
+        ioctl(fd, EVIOCGNAME(sizeof(name)), name);
+        unsigned long ev[1] = {}, keys[KEY_MAX / (8 * sizeof(unsigned long)) + 1] = {},
+                      rels[REL_MAX / (8 * sizeof(unsigned long)) + 1] = {};
+        ioctl(fd, EVIOCGBIT(0, sizeof(ev)), ev);
+        ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys);
+        ioctl(fd, EVIOCGBIT(EV_REL, sizeof(rels)), rels);
+
+        Device d;
+        d.fd       = fd;
+        d.path     = path;
+        d.keyboard = TestBit(ev, EV_KEY) && TestBit(keys, KEY_A) && TestBit(keys, KEY_SPACE);
+        d.pointer  = TestBit(ev, EV_REL) && TestBit(rels, REL_X) && TestBit(rels, REL_Y) &&
+                     TestBit(keys, BTN_LEFT);
+        if (skipName == name || (!d.keyboard && !d.pointer)) {
+            close(fd);
+            continue;
+        }
+        // Keyboards stay shared: hotkeys are only watched
+        if (d.pointer && forward_ && forward_->IsOpen()) d.grabbed = ioctl(fd, EVIOCGRAB, 1) == 0;
+        devices_.push_back(d);
+    }
+    return !devices_.empty();
+}
+
+void EvdevInput::Close() {
+    for (auto& d : devices_) {
+        if (d.grabbed) ioctl(d.fd, EVIOCGRAB, 0);
+        close(d.fd);
+    }
+    devices_.clear();
+    modifiers_ = 0;
+}
+
+size_t EvdevInput::Keyboards() const {
+    return std::count_if(devices_.begin(), devices_.end(), [](const Device& d) { return d.keyboard; });
+}
+
+size_t EvdevInput::Pointers() const {
+    return std::count_if(devices_.begin(), devices_.end(), [](const Device& d) { return d.pointer; });
+}
+
+void EvdevInput::SetScreen(int width, int height) {
+    width_  = std::max(1, width);
+    height_ = std::max(1, height);
+    x_ = std::clamp(x_, 0, width_ - 1);
+    y_ = std::clamp(y_, 0, height_ - 1);
+}
+
+bool EvdevInput::AddHotkey(int id, const std::string& spec) {
+    Hotkey h{id, 0, 0};
+    if (!ParseEvdevHotkey(spec, h.modifiers, h.key)) return false;
+    hotkeys_.push_back(h);
+    return true;
+}
+
+bool EvdevInput::Poll(int timeoutMs) {
+    if (devices_.empty()) return false;
+    std::vector<pollfd> fds(devices_.size());
+    for (size_t i = 0; i < devices_.size(); i++) fds[i] = {devices_[i].fd, POLLIN, 0};
+    if (poll(fds.data(), fds.size(), timeoutMs) < 0) return errno != EINTR;
+
+    for (size_t i = fds.size(); i-- > 0;) {
+        if (!fds[i].revents) continue;
+        Device& d = devices_[i];
+        input_event evs[64];
+        ssize_t n;
+        while ((n = read(d.fd, evs, sizeof(evs))) > 0)
+            for (ssize_t k = 0; k < n / (ssize_t)sizeof(input_event); k++) Handle(d, evs[k]);
+        if (n < 0 && errno != EAGAIN && errno != EINTR) {
+            // Unplugged
+            close(d.fd);
+            devices_.erase(devices_.begin() + i);
+        }
+    }
+    return !devices_.empty();
+}
+
+void EvdevInput::Key(Device& d, const input_event& ev) {
+    if (const uint8_t bit = ModifierBit(ev.code)) {
+        // Either side holds it; good enough without tracking both
+        if (ev.value) modifiers_ |= bit;
+        else          modifiers_ &= (uint8_t)~bit;
+        return;
+    }
+    if (ev.value != 1 || !d.keyboard) return;   // presses only, no autorepeat
+    for (const auto& h : hotkeys_)
+        if (h.key == ev.code && h.modifiers == modifiers_ && onHotkey_) onHotkey_(h.id);
+}
+
+void EvdevInput::Handle(Device& d, const input_event& ev) {
+    bool forward = d.grabbed;
+    switch (ev.type) {
+    case EV_REL:
+        if (ev.code == REL_X) d.dx += ev.value;
+        if (ev.code == REL_Y) d.dy += ev.value;
+        break;
+    case EV_KEY: {
+        const int button = ev.code == BTN_LEFT ? 0 : ev.code == BTN_RIGHT ? 1 : ev.code == BTN_MIDDLE ? 2 : -1;
+        if (button < 0 || !d.pointer) {
+            Key(d, ev);
+            break;
+        }
+        if (ev.value == 2) break;
+        PointerEvent pe;
+        pe.kind   = PointerEvent::Button;
+        pe.x      = x_;
+        pe.y      = y_;
+        pe.button = button;
+        pe.down   = ev.value != 0;
+        const bool swallow = onPointer_ && onPointer_(pe);
+        // A press that went to the zone takes its release along
+        if (pe.down) d.swallowed[button] = swallow;
+        if (swallow || (!pe.down && d.swallowed[button])) {
+            forward = false;
+            if (!pe.down) d.swallowed[button] = false;
+        }
+        break;
+    }
+    case EV_SYN:
+        if (ev.code == SYN_REPORT && (d.dx || d.dy)) {
+            x_ = std::clamp(x_ + d.dx, 0, width_ - 1);
+            y_ = std::clamp(y_ + d.dy, 0, height_ - 1);
+            d.dx = d.dy = 0;
+            PointerEvent pe;
+            pe.x = x_;
+            pe.y = y_;
+            if (onPointer_) onPointer_(pe);
+        }
+        if (d.grabbed && ev.code == SYN_REPORT) forward_->Flush();
+        return;
+    }
+    if (forward) forward_->Forward(ev);
+}
+
+} // namespace sn
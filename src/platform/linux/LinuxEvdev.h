@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <linux/input.h>
+
+namespace sn {
+
+class UinputDevice;
+
+// A pointer event in screen pixels (see EvdevInput on how the position
+// is known).
+struct PointerEvent {
+    enum Kind : uint8_t { Move, Button } kind = Move;
+    int  x = 0, y = 0;
+    int  button = 0;       // 0 = left, 1 = right, 2 = middle (Button)
+    bool down   = false;   // (Button)
+};
+
+// "Ctrl+Alt+S" → evdev key code and modifier bits; false if unknown.
+enum : uint8_t { kModCtrl = 1, kModAlt = 2, kModShift = 4, kModMeta = 8 };
+bool ParseEvdevHotkey(const std::string& spec, uint8_t& modifiers, uint16_t& key);
+
+// ─────────────────────────────────────────────────────────
+// EvdevInput — keyboards and mice straight from /dev/input
+//
+// Works below any display server: hotkeys are matched on key presses
+// with the exact modifier set, and the pointer position is the sum of
+// the mice's relative motion clamped to the screen. That sum drifts from
+// the real cursor by whatever acceleration the compositor applies, but
+// it re-syncs every time the pointer is pushed against a screen edge —
+// where a scroll zone normally sits.
+//
+// With grabbing on, the mice are taken over (EVIOCGRAB) and every event
+// the pointer callback doesn't swallow is forwarded through a
+// UinputDevice, one frame per SYN_REPORT: that is how a click in the
+// zone stays out of the window under it. Devices present at Open() are
+// used; the virtual device itself is skipped by name.
+//
+// Single-threaded: Poll() reads and calls back on the caller's thread.
+// ─────────────────────────────────────────────────────────
+class EvdevInput {
+public:
+    using HotkeyCallback  = std::function<void(int id)>;
+    using PointerCallback = std::function<bool(const PointerEvent& e)>;   // true: swallow
+
+    ~EvdevInput() { Close(); }
+
+    // Scan /dev/input. False if no keyboard or mouse could be opened
+    // (the user needs to be in the "input" group, or root).
+    bool Open(const std::string& skipName, UinputDevice* forwardTo);
+    void Close();
+
+    void SetScreen(int width, int height);
+    bool AddHotkey(int id, const std::string& spec);   // false: can't parse
+    void ClearHotkeys() { hotkeys_.clear(); }
+
+    void OnHotkey(HotkeyCallback cb) { onHotkey_ = std::move(cb); }
+    void OnPointer(PointerCallback cb) { onPointer_ = std::move(cb); }
+
+    // Wait up to timeoutMs (-1: forever) and handle whatever arrived.
+    // False on a signal or when every device is gone.
+    bool Poll(int timeoutMs);
+
+    size_t Keyboards() const;
+    size_t Pointers() const;
+
+private:
+    struct Device {
+        int         fd = -1;
+        bool        keyboard = false;
+        bool        pointer  = false;
+        bool        grabbed  = false;
+        std::string path;
+        int         dx = 0, dy = 0;   // motion in the current frame
+        bool        swallowed[3] = {};   // buttons whose press went to the zone
+    };
+    struct Hotkey {
+        int      id;
+        uint8_t  modifiers;
+        uint16_t key;
+    };
+
+    void Handle(Device& d, const input_event& ev);
+    void Key(Device& d, const input_event& ev);
+
+    std::vector<Device> devices_;
+    std::vector<Hotkey> hotkeys_;
+    UinputDevice*       forward_ = nullptr;
+    HotkeyCallback      onHotkey_;
+    PointerCallback     onPointer_;
+    uint8_t             modifiers_ = 0;
+    int                 width_ = 1920, height_ = 1080;
+    int                 x_ = 960, y_ = 540;
+};
+
+} // namespace sn
@@ -0,0 +1,84 @@
+#include "../../core/FileWatcher.h"
+#include <filesystem>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace sn {
+
+// ─────── inotify ───────
+// Watches the parent directory (the file itself is replaced by rename
+// on every atomic save, which would orphan a watch on its inode).
+class InotifyFileWatcher : public FileWatcher {
+public:
+    ~InotifyFileWatcher() override { Stop(); }
+
+    bool Start(const std::string& path, Callback onChange) override {
+        Stop();
+        std::filesystem::path p(path);
+        std::string dir = p.has_parent_path() ? p.parent_path().string() : ".";
+        name_     = p.filename().string();
+        callback_ = std::move(onChange);
+
+        fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd_ < 0) return false;
+        if (inotify_add_watch(fd_, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+            pipe2(stopPipe_, O_CLOEXEC) != 0) {
+            Close();
+            return false;
+        }
+        thread_ = std::thread(&InotifyFileWatcher::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            char c = 0;
+            (void)!write(stopPipe_[1], &c, 1);
+            thread_.join();
+        }
+        Close();
+    }
+
+private:
+    void Run() {
+        alignas(inotify_event) char buf[4096];
+        for (;;) {
+            pollfd fds[2] = {{fd_, POLLIN, 0}, {stopPipe_[0], POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0) continue;
+            if (fds[1].revents) return;
+
+            bool hit = false;
+            ssize_t n;
+            while ((n = read(fd_, buf, sizeof(buf))) > 0) {
+                for (char* q = buf; q < buf + n;) {
+                    auto* ev = reinterpret_cast<inotify_event*>(q);
+                    if (ev->len && name_ == ev->name) hit = true;
+                    q += sizeof(inotify_event) + ev->len;
+                }
+            }
+            if (hit && callback_) callback_();
+        }
+    }
+
+    void Close() {
+        if (fd_ >= 0) close(fd_);
+        for (int& f : stopPipe_) if (f >= 0) close(f);
+        fd_ = -1;
+        stopPipe_[0] = stopPipe_[1] = -1;
+    }
+
+    std::string name_;
+    Callback    callback_;
+    int         fd_ = -1;
+    int         stopPipe_[2] = {-1, -1};
+    std::thread thread_;
+};
+
+std::unique_ptr<FileWatcher> CreateFileWatcher() {
+    return std::make_unique<InotifyFileWatcher>();
+}
+
+} // namespace sn
@@ -0,0 +1,30 @@
+#include "../../core/MappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sn {
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) { close(fd); return false; }
+
+    void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // the mapping keeps its own reference
+    if (p == MAP_FAILED) return false;
+    data_ = static_cast<const uint8_t*>(p);
+    size_ = (size_t)st.st_size;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace sn
@@ -0,0 +1,104 @@
+#include "../../core/MetricsServer.h"
+#include "LinuxSocket.h"
+#include <cerrno>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace sn {
+
+// ─────── Unix-domain socket ───────
+// Stand-in for the Windows pipe: same protocol, a socket file only the
+// user can open (the runtime dir is 0700 as well).
+class UnixMetricsServer : public MetricsServer {
+public:
+    UnixMetricsServer() : path_(RuntimeSocketPath("scrollnice-metrics.sock")) {}
+    ~UnixMetricsServer() override { Stop(); }
+
+    bool Start(Render render) override {
+        Stop();
+        render_ = std::move(render);
+
+        fd_ = ListenUnixSocket(path_);
+        if (fd_ < 0) return false;
+        bound_ = true;
+        if (pipe2(stopPipe_, O_CLOEXEC) != 0) {
+            Close();
+            return false;
+        }
+        thread_ = std::thread(&UnixMetricsServer::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            char c = 0;
+            (void)!write(stopPipe_[1], &c, 1);
+            thread_.join();
+        }
+        Close();
+    }
+
+    std::string Endpoint() const override { return path_; }
+
+private:
+    void Run() {
+        for (;;) {
+            pollfd fds[2] = {{fd_, POLLIN, 0}, {stopPipe_[0], POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0) continue;
+            if (fds[1].revents) return;
+            const int client = accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client < 0) continue;
+            // A client that stops reading mustn't hold up Stop()
+            timeval timeout{1, 0};
+            setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            Serve(client);
+            close(client);
+        }
+    }
+
+    void Serve(int client) {
+        // Up to the end of the request headers, whatever arrives in
+        // 100 ms, or EOF
+        std::string request;
+        char buf[1024];
+        while (request.size() < 4096 && request.find("\r\n\r\n") == std::string::npos) {
+            pollfd p{client, POLLIN, 0};
+            if (poll(&p, 1, 100) <= 0) break;
+            const ssize_t n = recv(client, buf, sizeof(buf), 0);
+            if (n <= 0) break;
+            request.append(buf, (size_t)n);
+        }
+
+        const std::string reply = MetricsResponse(request, render_());
+        for (size_t sent = 0; sent < reply.size();) {
+            const ssize_t n = send(client, reply.data() + sent, reply.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return;
+            sent += (size_t)n;
+        }
+    }
+
+    void Close() {
+        if (fd_ >= 0) { close(fd_); fd_ = -1; }
+        if (bound_) { unlink(path_.c_str()); bound_ = false; }
+        for (int& p : stopPipe_)
+            if (p >= 0) { close(p); p = -1; }
+    }
+
+    std::string path_;
+    Render      render_;
+    int         fd_          = -1;
+    bool        bound_       = false;
+    int         stopPipe_[2] = {-1, -1};
+    std::thread thread_;
+};
+
+std::unique_ptr<MetricsServer> CreateMetricsServer() {
+    return std::make_unique<UnixMetricsServer>();
+}
+
+} // namespace sn
@@ -0,0 +1,45 @@
+#include "LinuxSocket.h"
+#include <cstdlib>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace sn {
+
+std::string RuntimeSocketPath(const std::string& name) {
+    const char* dir = std::getenv("XDG_RUNTIME_DIR");
+    if (dir && *dir) return std::string(dir) + "/" + name;
+    const size_t dot = name.rfind('.');
+    return "/tmp/" + name.substr(0, dot) + "-" + std::to_string(getuid()) +
+           (dot == std::string::npos ? "" : name.substr(dot));
+}
+
+int ListenUnixSocket(const std::string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return -1;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+    const int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const bool taken = probe >= 0 &&
+        connect(probe, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    if (probe >= 0) close(probe);
+    if (taken) return -1;
+    unlink(path.c_str());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    const mode_t mask = umask(0177);
+    const bool bound = bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    umask(mask);
+    if (!bound || listen(fd, 8) != 0) {
+        if (bound) unlink(path.c_str());
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace sn
@@ -0,0 +1,17 @@
+#pragma once
+#include <string>
+
+namespace sn {
+
+// Unix-domain socket endpoints shared by the metrics and command servers.
+
+// $XDG_RUNTIME_DIR/<name> ("scrollnice-x.sock"), or /tmp/scrollnice-x-<uid>.sock
+// without a runtime dir.
+std::string RuntimeSocketPath(const std::string& name);
+
+// A listening AF_UNIX stream socket bound at `path` with mode 0600, or
+// -1. A socket file left by a crashed instance is replaced; one that
+// still accepts connections (another instance) is not.
+int ListenUnixSocket(const std::string& path);
+
+} // namespace sn
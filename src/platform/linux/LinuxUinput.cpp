@@ -0,0 +1,126 @@
+#include "LinuxUinput.h"
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace sn {
+
+bool UinputDevice::Open(const std::string& name) {
+    Close();
+    fd_ = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd_ < 0) return false;
+
+    bool ok = ioctl(fd_, UI_SET_EVBIT, EV_SYN) == 0 && ioctl(fd_, UI_SET_EVBIT, EV_KEY) == 0 &&
+              ioctl(fd_, UI_SET_EVBIT, EV_REL) == 0;
+    for (int rel : {REL_X, REL_Y, REL_WHEEL, REL_HWHEEL, REL_WHEEL_HI_RES, REL_HWHEEL_HI_RES})
+        ok = ok && ioctl(fd_, UI_SET_RELBIT, rel) == 0;
+    // The buttons of a forwarded mouse
+    for (int key : {BTN_LEFT, BTN_RIGHT, BTN_MIDDLE, BTN_SIDE, BTN_EXTRA, BTN_FORWARD, BTN_BACK})
+        ok = ok && ioctl(fd_, UI_SET_KEYBIT, key) == 0;
+
+    uinput_setup setup{};
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor  = 0x1209;   // pid.codes test range
+    setup.id.product = 0x5c01;
+    setup.id.version = 1;
+    std::strncpy(setup.name, name.c_str(), UINPUT_MAX_NAME_SIZE - 1);
+    ok = ok && ioctl(fd_, UI_DEV_SETUP, &setup) == 0 && ioctl(fd_, UI_DEV_CREATE) == 0;
+    if (!ok) {
+        Close();
+        return false;
+    }
+    created_ = true;
+    return true;
+}
+
+void UinputDevice::Attach(int fd) {
+    Close();
+    fd_ = fd;
+}
+
+void UinputDevice::Close() {
+    if (fd_ < 0) return;
+    if (created_) ioctl(fd_, UI_DEV_DESTROY);
+    close(fd_);
+    fd_ = -1;
+    created_ = false;
+    batch_.clear();
+    pendingY_ = pendingX_ = 0.0;
+    notchY_ = notchX_ = 0;
+}
+
+std::string UinputDevice::EventNode() const {
+    char sysname[64] = {};
+    if (!created_ || ioctl(fd_, UI_GET_SYSNAME(sizeof(sysname)), sysname) < 0) return {};
+    std::error_code ec;
+    const std::filesystem::path dir = std::filesystem::path("/sys/devices/virtual/input") / sysname;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        const std::string leaf = entry.path().filename().string();
+        if (leaf.rfind("event", 0) == 0) return "/dev/input/" + leaf;
+    }
+    return {};
+}
+
+void UinputDevice::Push(uint16_t type, uint16_t code, int32_t value) {
+    input_event ev{};
+    ev.type  = type;
+    ev.code  = code;
+    ev.value = value;
+    batch_.push_back(ev);
+}
+
+void UinputDevice::Scroll(double dy, double dx) {
+    pendingY_ += dy * kHiResPerNotch / 100.0;
+    pendingX_ += dx * kHiResPerNotch / 100.0;
+}
+
+double UinputDevice::PxToNextUnitY(int direction) const {
+    return (1.0 - direction * pendingY_) * 100.0 / kHiResPerNotch;
+}
+
+void UinputDevice::Forward(const input_event& ev) {
+    if (ev.type == EV_SYN) return;
+    batch_.push_back(ev);
+}
+
+// Whole hi-res units out of the carry, plus a notch per 120 of them
+void UinputDevice::Axis(double& carry, int& sinceNotch, uint16_t hiRes, uint16_t notch) {
+    const int units = (int)std::trunc(carry);
+    if (units == 0) return;
+    carry -= units;
+    Push(EV_REL, hiRes, units);
+    sinceNotch += units;
+    const int notches = sinceNotch / kHiResPerNotch;   // toward zero, keeps the sign
+    if (notches != 0) {
+        Push(EV_REL, notch, notches);
+        sinceNotch -= notches * kHiResPerNotch;
+    }
+}
+
+bool UinputDevice::Flush() {
+    Axis(pendingY_, notchY_, REL_WHEEL_HI_RES, REL_WHEEL);
+    Axis(pendingX_, notchX_, REL_HWHEEL_HI_RES, REL_HWHEEL);
+    if (batch_.empty()) return true;
+    if (fd_ < 0) {
+        batch_.clear();
+        return false;
+    }
+    Push(EV_SYN, SYN_REPORT, 0);
+
+    const char*  data = reinterpret_cast<const char*>(batch_.data());
+    const size_t size = batch_.size() * sizeof(input_event);
+    ssize_t n;
+    do n = write(fd_, data, size);
+    while (n < 0 && errno == EINTR);
+    batch_.clear();
+    if (n != (ssize_t)size) return false;
+    frames_++;
+    return true;
+}
+
+} // namespace sn
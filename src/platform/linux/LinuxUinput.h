@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <linux/input.h>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// UinputDevice — a virtual pointer on /dev/uinput
+//
+// Scroll() queues pixels (+ up / + right) as high-resolution wheel
+// units, 120 per 100 px like WHEEL_DELTA on Windows; Forward() queues
+// events of a grabbed real pointer (the evdev zone proxy). Flush() sends
+// everything queued as one input_event array and a SYN_REPORT in a
+// single write(), so a tick is one frame for the compositor. Legacy
+// REL_WHEEL/REL_HWHEEL notches go out alongside whenever 120 units
+// have built up, for clients that don't read the hi-res axes.
+// ─────────────────────────────────────────────────────────
+class UinputDevice {
+public:
+    static constexpr int kHiResPerNotch = 120;
+
+    UinputDevice() = default;
+    ~UinputDevice() { Close(); }
+    UinputDevice(const UinputDevice&) = delete;
+    UinputDevice& operator=(const UinputDevice&) = delete;
+
+    // Create the device (needs write access to /dev/uinput).
+    bool Open(const std::string& name);
+
+    // Send to `fd` instead (a pipe, to look at the frames); takes it over.
+    void Attach(int fd);
+
+    void Close();
+    bool IsOpen() const { return fd_ >= 0; }
+
+    void Scroll(double dy, double dx);
+    void Forward(const input_event& ev);   // not EV_SYN: Flush() ends the frame
+    bool Flush();
+
+    // Pixels of scrolling in `direction` (+1 up) still to queue before
+    // a Flush() has a whole hi-res unit to send.
+    double PxToNextUnitY(int direction) const;
+
+    // /dev/input/eventN of the created device ("" if unknown), for a
+    // loopback reader.
+    std::string EventNode() const;
+
+    uint64_t Frames() const { return frames_; }
+
+private:
+    void Push(uint16_t type, uint16_t code, int32_t value);
+    void Axis(double& carry, int& sinceNotch, uint16_t hiRes, uint16_t notch);
+
+    int                      fd_ = -1;
+    bool                     created_ = false;
+    std::vector<input_event> batch_;
+    double                   pendingY_ = 0.0, pendingX_ = 0.0;   // hi-res units, fractional
+    int                      notchY_ = 0, notchX_ = 0;           // hi-res units since the last notch
+    uint64_t                 frames_ = 0;
+};
+
+} // namespace sn
@@ -0,0 +1,159 @@
+#include "WinAudioSink.h"
+#include <windows.h>
+#include <mmreg.h>
+#include <mmdeviceapi.h>
+#include <audioclient.h>
+#include <avrt.h>
+#include <wrl/client.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace sn {
+
+namespace {
+
+// ─────── WASAPI ───────
+// Everything but Interrupt() runs on the mixer thread, which joins the
+// MTA and the "Pro Audio" MMCSS class between Open() and Close().
+class WasapiAudioSink : public AudioSink {
+public:
+    WasapiAudioSink() { interrupt_ = CreateEventW(nullptr, TRUE, FALSE, nullptr); }
+    ~WasapiAudioSink() override {
+        Close();
+        if (interrupt_) CloseHandle(interrupt_);
+    }
+
+    bool Open(AudioFormat& format) override {
+        comInit_ = SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED));
+        DWORD taskIndex = 0;
+        mmcss_ = AvSetMmThreadCharacteristicsW(L"Pro Audio", &taskIndex);
+        if (!interrupt_ || !OpenStream(format)) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close() override {
+        if (client_) client_->Stop();
+        render_.Reset();
+        client_.Reset();
+        if (event_) { CloseHandle(event_); event_ = nullptr; }
+        if (mmcss_) { AvRevertMmThreadCharacteristics(mmcss_); mmcss_ = nullptr; }
+        if (comInit_) { CoUninitialize(); comInit_ = false; }
+    }
+
+    float* Acquire(size_t& frames) override {
+        for (;;) {
+            HANDLE handles[2] = {interrupt_, event_};
+            // A running stream signals every period; silence this long
+            // means the endpoint is gone
+            if (WaitForMultipleObjects(2, handles, FALSE, 2000) != WAIT_OBJECT_0 + 1) return nullptr;
+
+            UINT32 padding = 0;
+            if (FAILED(client_->GetCurrentPadding(&padding))) return nullptr;
+            const UINT32 avail = bufferFrames_ - padding;
+            if (!avail) continue;
+            if (FAILED(render_->GetBuffer(avail, &device_))) return nullptr;
+
+            queued_ = (double)padding / sampleRate_;
+            frames  = avail;
+            if (isFloat_) return reinterpret_cast<float*>(device_);
+            scratch_.resize((size_t)avail * channels_);
+            return scratch_.data();
+        }
+    }
+
+    void Commit(size_t frames) override {
+        if (!isFloat_) {
+            auto* out = reinterpret_cast<int16_t*>(device_);
+            for (size_t i = 0; i < frames * channels_; i++)
+                out[i] = (int16_t)std::lround(std::clamp(scratch_[i], -1.0f, 1.0f) * 32767.0f);
+        }
+        render_->ReleaseBuffer((UINT32)frames, 0);
+    }
+
+    double QueuedSeconds() const override { return queued_; }
+
+    void Pause() override {
+        client_->Stop();
+        client_->Reset();
+    }
+    void Resume() override { client_->Start(); }
+
+    void Interrupt() override { SetEvent(interrupt_); }
+
+private:
+    bool OpenStream(AudioFormat& format) {
+        ComPtr<IMMDeviceEnumerator> enumerator;
+        ComPtr<IMMDevice> device;
+        if (FAILED(CoCreateInstance(__uuidof(MMDeviceEnumerator), nullptr, CLSCTX_ALL,
+                                    IID_PPV_ARGS(&enumerator))) ||
+            FAILED(enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &device)) ||
+            FAILED(device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, nullptr,
+                                    reinterpret_cast<void**>(client_.GetAddressOf()))))
+            return false;
+
+        WAVEFORMATEX* mix = nullptr;
+        if (FAILED(client_->GetMixFormat(&mix))) return false;
+        const WORD tag = mix->wFormatTag == WAVE_FORMAT_EXTENSIBLE
+            ? (WORD)reinterpret_cast<WAVEFORMATEXTENSIBLE*>(mix)->SubFormat.Data1
+            : mix->wFormatTag;
+        isFloat_ = tag == WAVE_FORMAT_IEEE_FLOAT && mix->wBitsPerSample == 32;
+        const bool isPcm16 = tag == WAVE_FORMAT_PCM && mix->wBitsPerSample == 16;
+        sampleRate_ = (int)mix->nSamplesPerSec;
+        channels_   = mix->nChannels;
+
+        bool ok = false;
+        ComPtr<IAudioClient3> client3;
+        if ((isFloat_ || isPcm16) && SUCCEEDED(client_.As(&client3))) {
+            UINT32 defaultPeriod = 0, fundamental = 0, minPeriod = 0, maxPeriod = 0;
+            ok = SUCCEEDED(client3->GetSharedModeEnginePeriod(mix, &defaultPeriod, &fundamental,
+                                                              &minPeriod, &maxPeriod)) &&
+                 SUCCEEDED(client3->InitializeSharedAudioStream(AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
+                                                                minPeriod, mix, nullptr));
+        }
+        if ((isFloat_ || isPcm16) && !ok)
+            ok = SUCCEEDED(client_->Initialize(AUDCLNT_SHAREMODE_SHARED, AUDCLNT_STREAMFLAGS_EVENTCALLBACK,
+                                               0, 0, mix, nullptr));
+        CoTaskMemFree(mix);
+        if (!ok) return false;
+
+        event_ = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!event_ || FAILED(client_->SetEventHandle(event_)) ||
+            FAILED(client_->GetBufferSize(&bufferFrames_)) ||
+            FAILED(client_->GetService(IID_PPV_ARGS(&render_))) ||
+            FAILED(client_->Start()))
+            return false;
+
+        format.sampleRate = sampleRate_;
+        format.channels   = channels_;
+        return true;
+    }
+
+    ComPtr<IAudioClient>       client_;
+    ComPtr<IAudioRenderClient> render_;
+    HANDLE                     event_     = nullptr;   // period ready
+    HANDLE                     interrupt_ = nullptr;
+    HANDLE                     mmcss_     = nullptr;
+    bool                       comInit_   = false;
+
+    bool               isFloat_      = true;
+    int                sampleRate_   = 48000;
+    int                channels_     = 2;
+    UINT32             bufferFrames_ = 0;
+    BYTE*              device_       = nullptr;   // the buffer GetBuffer() returned
+    std::vector<float> scratch_;                  // mix buffer for 16-bit devices
+    double             queued_       = 0.0;
+};
+
+} // namespace
+
+std::unique_ptr<AudioSink> CreateWasapiAudioSink() {
+    return std::make_unique<WasapiAudioSink>();
+}
+
+} // namespace sn
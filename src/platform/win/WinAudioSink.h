@@ -0,0 +1,14 @@
+#pragma once
+#include <memory>
+#include "../../core/AudioSink.h"
+
+namespace sn {
+
+// Shared-mode, event-driven WASAPI stream on the default render device,
+// at the shortest period the audio engine allows (IAudioClient3, Windows
+// 10+; the engine's default period before that). Float or 16-bit mix
+// formats. Acquire() returns nullptr when the device is lost, and the
+// engine reopens the new default.
+std::unique_ptr<AudioSink> CreateWasapiAudioSink();
+
+} // namespace sn
@@ -0,0 +1,320 @@
+#include "../../core/CommandChannel.h"
+#include <windows.h>
+#include <mutex>
+#include <thread>
+
+namespace sn {
+
+static const wchar_t* kCommandPipe = L"\\\\.\\pipe\\ScrollNice-command";
+
+// ─────── Server ───────
+// kMaxClients overlapped pipe instances, each either waiting for a
+// client or for its next request; one thread waits on all of their
+// events and a stop event. Feed frames are written straight from the
+// publishing thread, with their own OVERLAPPED; mutex_ covers the
+// subscription fields and those writes.
+class WinCommandServer : public CommandServer {
+public:
+    ~WinCommandServer() override { Stop(); }
+
+    bool Start(Handler handler) override {
+        Stop();
+        handler_    = std::move(handler);
+        stopEvent_  = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        writeEvent_ = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!stopEvent_ || !writeEvent_) { Close(); return false; }
+        for (int i = 0; i < kMaxClients; i++) {
+            Instance& in = instances_[i];
+            in.event     = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+            in.pushEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+            // FIRST_PIPE_INSTANCE: fail rather than share the name with
+            // another process's server
+            in.pipe = CreateNamedPipeW(kCommandPipe,
+                                       PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED |
+                                           (i == 0 ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+                                       PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT |
+                                           PIPE_REJECT_REMOTE_CLIENTS,
+                                       kMaxClients, 4096, 4096, 0, nullptr);
+            if (in.pipe == INVALID_HANDLE_VALUE) in.pipe = nullptr;
+            if (!in.event || !in.pushEvent || !in.pipe) { Close(); return false; }
+            Listen(in);
+        }
+        thread_ = std::thread(&WinCommandServer::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            SetEvent(stopEvent_);
+            thread_.join();
+        }
+        Close();
+    }
+
+    std::string Endpoint() const override { return "\\\\.\\pipe\\ScrollNice-command"; }
+
+    bool Publish(uint32_t pid, const std::string& frame) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool matched = false;
+        for (auto& in : instances_) {
+            if (!in.subscribed || (pid && in.pid != pid)) continue;
+            matched = true;
+            // The last frame is still on its way: skip this one
+            if (in.pushing && !HasOverlappedIoCompleted(&in.pushOv)) continue;
+            in.pushBuf = frame;
+            ZeroMemory(&in.pushOv, sizeof(in.pushOv));
+            ResetEvent(in.pushEvent);
+            in.pushOv.hEvent = in.pushEvent;
+            // A failed write means the client is gone; the pending read
+            // reports that to the server thread
+            in.pushing = WriteFile(in.pipe, in.pushBuf.data(), (DWORD)in.pushBuf.size(), nullptr,
+                                   &in.pushOv) ||
+                         GetLastError() == ERROR_IO_PENDING;
+        }
+        return matched;
+    }
+
+private:
+    struct Instance {
+        HANDLE      pipe  = nullptr;
+        HANDLE      event = nullptr;
+        OVERLAPPED  ov{};
+        bool        connected = false;
+        char        buf[1024];
+        FrameReader reader;
+        // Feed (under mutex_)
+        bool        subscribed = false;
+        uint32_t    pid        = 0;
+        bool        pushing    = false;
+        HANDLE      pushEvent  = nullptr;
+        OVERLAPPED  pushOv{};
+        std::string pushBuf;
+    };
+
+    void Arm(Instance& in) {
+        ZeroMemory(&in.ov, sizeof(in.ov));
+        ResetEvent(in.event);
+        in.ov.hEvent = in.event;
+    }
+
+    void Listen(Instance& in) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            Arm(in);
+            in.connected = false;
+            if (ConnectNamedPipe(in.pipe, &in.ov) || GetLastError() == ERROR_IO_PENDING) return;
+            if (GetLastError() == ERROR_PIPE_CONNECTED) {
+                in.connected = true;
+                Read(in);
+                return;
+            }
+            // ERROR_NO_DATA: a client came and went before we got here
+            DisconnectNamedPipe(in.pipe);
+        }
+        // Otherwise the instance stays idle (its event never fires)
+    }
+
+    void Read(Instance& in) {
+        Arm(in);
+        if (!ReadFile(in.pipe, in.buf, sizeof(in.buf), nullptr, &in.ov) &&
+            GetLastError() != ERROR_IO_PENDING)
+            Recycle(in);
+    }
+
+    void Recycle(Instance& in) {
+        Unsubscribe(in);
+        DisconnectNamedPipe(in.pipe);
+        in.reader = FrameReader{};
+        Listen(in);
+    }
+
+    void Unsubscribe(Instance& in) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (in.pushing) {
+            DWORD n = 0;
+            CancelIoEx(in.pipe, &in.pushOv);
+            GetOverlappedResult(in.pipe, &in.pushOv, &n, TRUE);
+            in.pushing = false;
+        }
+        in.subscribed = false;
+        in.pid        = 0;
+    }
+
+    void Run() {
+        HANDLE waits[kMaxClients + 1];
+        waits[0] = stopEvent_;
+        for (int i = 0; i < kMaxClients; i++) waits[i + 1] = instances_[i].event;
+        for (;;) {
+            const DWORD r = WaitForMultipleObjects(kMaxClients + 1, waits, FALSE, INFINITE);
+            if (r == WAIT_OBJECT_0 || r == WAIT_FAILED) return;
+            const DWORD i = r - WAIT_OBJECT_0 - 1;
+            if (i >= (DWORD)kMaxClients) continue;
+            Instance& in = instances_[i];
+
+            DWORD n = 0;
+            if (!GetOverlappedResult(in.pipe, &in.ov, &n, FALSE)) { Recycle(in); continue; }
+            if (!in.connected) {
+                in.connected = true;
+                Read(in);
+                continue;
+            }
+            if (!n || !Serve(in, n)) { Recycle(in); continue; }
+            Read(in);
+        }
+    }
+
+    // False: drop the client (bad framing or it stopped reading)
+    bool Serve(Instance& in, DWORD size) {
+        if (in.subscribed) return true;   // the feed is one-way
+        in.reader.Append(in.buf, size);
+        std::string body;
+        while (in.reader.Next(body)) {
+            Command cmd;
+            CommandReply reply;
+            if (DecodeCommand(body, cmd)) reply = handler_(cmd);
+            else                          reply.status = CommandStatus::BadRequest;
+            if (!Write(in, EncodeReply(cmd.op, reply))) return false;
+            if (cmd.op == CommandOp::Subscribe && reply.status == CommandStatus::Ok) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                in.subscribed = true;
+                in.pid        = cmd.pid;
+                return true;
+            }
+        }
+        return !in.reader.Bad();
+    }
+
+    // Replies are a few bytes against a 4 KB pipe buffer; a client that
+    // lets a second of them pile up unread is dropped.
+    bool Write(Instance& in, const std::string& data) {
+        OVERLAPPED ov{};
+        ResetEvent(writeEvent_);
+        ov.hEvent = writeEvent_;
+        DWORD n = 0;
+        if (!WriteFile(in.pipe, data.data(), (DWORD)data.size(), nullptr, &ov) &&
+            GetLastError() != ERROR_IO_PENDING)
+            return false;
+        if (WaitForSingleObject(writeEvent_, 1000) != WAIT_OBJECT_0) {
+            CancelIoEx(in.pipe, &ov);
+            GetOverlappedResult(in.pipe, &ov, &n, TRUE);
+            return false;
+        }
+        return GetOverlappedResult(in.pipe, &ov, &n, FALSE) && n == data.size();
+    }
+
+    void Close() {
+        for (auto& in : instances_) {
+            if (in.pipe) {
+                Unsubscribe(in);
+                CancelIoEx(in.pipe, nullptr);
+                CloseHandle(in.pipe);
+                in.pipe = nullptr;
+            }
+            if (in.event)     { CloseHandle(in.event);     in.event = nullptr; }
+            if (in.pushEvent) { CloseHandle(in.pushEvent); in.pushEvent = nullptr; }
+            in.reader = FrameReader{};
+        }
+        if (writeEvent_) { CloseHandle(writeEvent_); writeEvent_ = nullptr; }
+        if (stopEvent_)  { CloseHandle(stopEvent_);  stopEvent_ = nullptr; }
+    }
+
+    Handler     handler_;
+    Instance    instances_[kMaxClients];
+    std::mutex  mutex_;
+    HANDLE      stopEvent_  = nullptr;
+    HANDLE      writeEvent_ = nullptr;
+    std::thread thread_;
+};
+
+// ─────── Client ───────
+// Overlapped I/O so Close() can interrupt a read from another thread:
+// every wait also watches closeEvent_.
+class WinCommandClient : public CommandClient {
+public:
+    WinCommandClient() {
+        ioEvent_    = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        closeEvent_ = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    }
+    ~WinCommandClient() override {
+        if (pipe_ != INVALID_HANDLE_VALUE) CloseHandle(pipe_);
+        if (ioEvent_)    CloseHandle(ioEvent_);
+        if (closeEvent_) CloseHandle(closeEvent_);
+    }
+
+    bool Connect() override {
+        if (!ioEvent_ || !closeEvent_) return false;
+        for (int attempt = 0; attempt < 2; attempt++) {
+            pipe_ = CreateFileW(kCommandPipe, GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr);
+            if (pipe_ != INVALID_HANDLE_VALUE) return true;
+            // All kMaxClients instances are in use: wait for one to free up
+            if (GetLastError() != ERROR_PIPE_BUSY || !WaitNamedPipeW(kCommandPipe, 1000)) break;
+        }
+        return false;
+    }
+
+    bool Call(const Command& cmd, CommandReply& reply) override {
+        const std::string frame = EncodeCommand(cmd);
+        DWORD n = 0;
+        OVERLAPPED ov = Arm();
+        if (pipe_ == INVALID_HANDLE_VALUE ||
+            (!WriteFile(pipe_, frame.data(), (DWORD)frame.size(), nullptr, &ov) &&
+             GetLastError() != ERROR_IO_PENDING) ||
+            !Finish(ov, n) || n != frame.size())
+            return false;
+        std::string body;
+        return Receive(body) && DecodeReply(cmd.op, body, reply);
+    }
+
+    bool Receive(std::string& body) override {
+        char buf[1024];
+        while (!reader_.Next(body)) {
+            if (pipe_ == INVALID_HANDLE_VALUE || reader_.Bad()) return false;
+            DWORD n = 0;
+            OVERLAPPED ov = Arm();
+            if ((!ReadFile(pipe_, buf, sizeof(buf), nullptr, &ov) &&
+                 GetLastError() != ERROR_IO_PENDING) ||
+                !Finish(ov, n) || !n)
+                return false;
+            reader_.Append(buf, n);
+        }
+        return true;
+    }
+
+    void Close() override {
+        if (closeEvent_) SetEvent(closeEvent_);
+    }
+
+private:
+    OVERLAPPED Arm() {
+        OVERLAPPED ov{};
+        ResetEvent(ioEvent_);
+        ov.hEvent = ioEvent_;
+        return ov;
+    }
+
+    // Waits for the operation started on ov, or cancels it on Close()
+    bool Finish(OVERLAPPED& ov, DWORD& n) {
+        const HANDLE waits[2] = {ioEvent_, closeEvent_};
+        if (WaitForMultipleObjects(2, waits, FALSE, INFINITE) != WAIT_OBJECT_0) {
+            CancelIoEx(pipe_, &ov);
+            GetOverlappedResult(pipe_, &ov, &n, TRUE);
+            return false;
+        }
+        return GetOverlappedResult(pipe_, &ov, &n, FALSE) != FALSE;
+    }
+
+    HANDLE      pipe_       = INVALID_HANDLE_VALUE;
+    HANDLE      ioEvent_    = nullptr;
+    HANDLE      closeEvent_ = nullptr;
+    FrameReader reader_;
+};
+
+std::unique_ptr<CommandServer> CreateCommandServer() {
+    return std::make_unique<WinCommandServer>();
+}
+
+std::unique_ptr<CommandClient> CreateCommandClient() {
+    return std::make_unique<WinCommandClient>();
+}
+
+} // namespace sn
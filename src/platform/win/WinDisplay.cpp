@@ -0,0 +1,45 @@
+#include "WinDisplay.h"
+#include <dwmapi.h>
+#include <cmath>
+
+namespace sn {
+
+static UINT RefreshHz(HMONITOR mon) {
+    MONITORINFOEXW mi = {};
+    mi.cbSize = sizeof(mi);
+    if (!mon || !GetMonitorInfoW(mon, &mi)) return 60;
+
+    DEVMODEW dm = {};
+    dm.dmSize = sizeof(dm);
+    if (!EnumDisplaySettingsW(mi.szDevice, ENUM_CURRENT_SETTINGS, &dm)) return 60;
+    // 0 and 1 mean "hardware default"
+    return dm.dmDisplayFrequency > 1 ? dm.dmDisplayFrequency : 60;
+}
+
+UINT MonitorRefreshHz(HWND hwnd) {
+    return RefreshHz(MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST));
+}
+
+UINT FrameIntervalMs(HWND hwnd) {
+    UINT ms = 1000 / MonitorRefreshHz(hwnd);
+    return ms < USER_TIMER_MINIMUM ? USER_TIMER_MINIMUM : ms;
+}
+
+FrameTiming MonitorFrameTiming(HWND hwnd) {
+    FrameTiming t;
+    t.monitor = MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST);
+    const UINT hz = RefreshHz(t.monitor);
+    t.period = 1.0 / hz;
+
+    // dmDisplayFrequency is rounded (59 for 59.94): 3% is close enough
+    DWM_TIMING_INFO ti = {};
+    ti.cbSize = sizeof(ti);
+    if (SUCCEEDED(DwmGetCompositionTimingInfo(nullptr, &ti)) && ti.rateRefresh.uiDenominator) {
+        const double dwmHz = (double)ti.rateRefresh.uiNumerator / ti.rateRefresh.uiDenominator;
+        t.dwmPaced = std::abs(dwmHz - hz) < hz * 0.03;
+        if (t.dwmPaced) t.period = 1.0 / dwmHz;
+    }
+    return t;
+}
+
+} // namespace sn
@@ -0,0 +1,23 @@
+#pragma once
+#include <windows.h>
+
+namespace sn {
+
+// Refresh rate (Hz) of the monitor showing `hwnd`; 60 if unknown.
+UINT MonitorRefreshHz(HWND hwnd);
+
+// One refresh period of that monitor in ms, for pacing timers.
+// Never below USER_TIMER_MINIMUM (SetTimer can't go faster anyway).
+UINT FrameIntervalMs(HWND hwnd);
+
+// Frame timing of the monitor showing `hwnd`: its refresh period, and
+// whether DWM composes at that rate (then DwmFlush() returns on its
+// vblanks; with mixed rates DWM may follow another monitor).
+struct FrameTiming {
+    HMONITOR monitor  = nullptr;
+    double   period   = 1.0 / 60;   // s
+    bool     dwmPaced = false;
+};
+FrameTiming MonitorFrameTiming(HWND hwnd);
+
+} // namespace sn
@@ -0,0 +1,112 @@
+#include "../../core/FileWatcher.h"
+#include <windows.h>
+#include <filesystem>
+#include <thread>
+
+namespace sn {
+
+// ─────── ReadDirectoryChangesW ───────
+// Watches the parent directory (the file itself is replaced by rename
+// on every atomic save). One overlapped read is kept outstanding; the
+// thread waits on it and on a stop event.
+class WinFileWatcher : public FileWatcher {
+public:
+    ~WinFileWatcher() override { Stop(); }
+
+    bool Start(const std::string& path, Callback onChange) override {
+        Stop();
+        std::filesystem::path p(path);
+        std::wstring dir = p.has_parent_path() ? p.parent_path().wstring() : L".";
+        name_     = p.filename().wstring();
+        callback_ = std::move(onChange);
+
+        dir_ = CreateFileW(dir.c_str(), FILE_LIST_DIRECTORY,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                           OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (dir_ == INVALID_HANDLE_VALUE) { dir_ = nullptr; return false; }
+        ioEvent_   = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        stopEvent_ = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!ioEvent_ || !stopEvent_ || !Arm()) { Close(); return false; }
+
+        thread_ = std::thread(&WinFileWatcher::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            SetEvent(stopEvent_);
+            thread_.join();
+        }
+        Close();
+    }
+
+private:
+    static const DWORD kFilter = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME |
+                                 FILE_NOTIFY_CHANGE_SIZE;
+
+    bool Arm() {
+        ZeroMemory(&ov_, sizeof(ov_));
+        ov_.hEvent = ioEvent_;
+        pending_ = ReadDirectoryChangesW(dir_, buf_, sizeof(buf_), FALSE, kFilter,
+                                         nullptr, &ov_, nullptr) != 0;
+        return pending_;
+    }
+
+    void Run() {
+        HANDLE waits[2] = {ioEvent_, stopEvent_};
+        for (;;) {
+            if (WaitForMultipleObjects(2, waits, FALSE, INFINITE) != WAIT_OBJECT_0) break;
+            DWORD bytes = 0;
+            pending_ = false;
+            if (!GetOverlappedResult(dir_, &ov_, &bytes, FALSE)) break;
+
+            // bytes == 0: the buffer overflowed and the details are lost —
+            // assume our file was among the changes.
+            bool hit = bytes == 0;
+            for (DWORD off = 0; bytes && !hit;) {
+                auto* fni = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buf_ + off);
+                bool relevant = fni->Action == FILE_ACTION_MODIFIED ||
+                                fni->Action == FILE_ACTION_ADDED ||
+                                fni->Action == FILE_ACTION_RENAMED_NEW_NAME;
+                if (relevant && CompareStringOrdinal(fni->FileName, (int)(fni->FileNameLength / sizeof(WCHAR)),
+                                                     name_.c_str(), (int)name_.size(), TRUE) == CSTR_EQUAL)
+                    hit = true;
+                if (!fni->NextEntryOffset) break;
+                off += fni->NextEntryOffset;
+            }
+
+            ResetEvent(ioEvent_);
+            if (!Arm()) break;
+            if (hit && callback_) callback_();
+        }
+        if (pending_) {
+            CancelIoEx(dir_, &ov_);
+            DWORD ignored;
+            GetOverlappedResult(dir_, &ov_, &ignored, TRUE);   // let the cancel land before buf_ goes
+            pending_ = false;
+        }
+    }
+
+    void Close() {
+        if (dir_)       CloseHandle(dir_);
+        if (ioEvent_)   CloseHandle(ioEvent_);
+        if (stopEvent_) CloseHandle(stopEvent_);
+        dir_ = ioEvent_ = stopEvent_ = nullptr;
+    }
+
+    std::wstring name_;
+    Callback     callback_;
+    HANDLE       dir_       = nullptr;
+    HANDLE       ioEvent_   = nullptr;
+    HANDLE       stopEvent_ = nullptr;
+    OVERLAPPED   ov_        = {};
+    bool         pending_   = false;   // a read is outstanding on dir_
+    alignas(DWORD) BYTE buf_[8192];
+    std::thread  thread_;
+};
+
+std::unique_ptr<FileWatcher> CreateFileWatcher() {
+    return std::make_unique<WinFileWatcher>();
+}
+
+} // namespace sn
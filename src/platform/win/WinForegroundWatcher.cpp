@@ -0,0 +1,81 @@
+#include "WinForegroundWatcher.h"
+
+namespace sn {
+
+static std::string WideToUtf8(const wchar_t* s, int len) {
+    if (len <= 0) return {};
+    int n = WideCharToMultiByte(CP_UTF8, 0, s, len, nullptr, 0, nullptr, nullptr);
+    std::string out(n, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, s, len, out.data(), n, nullptr, nullptr);
+    return out;
+}
+
+std::string ProcessExeName(DWORD pid) {
+    HANDLE proc = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid);
+    if (!proc) return {};
+    wchar_t path[MAX_PATH];
+    DWORD len = MAX_PATH;
+    std::string exe;
+    if (QueryFullProcessImageNameW(proc, 0, path, &len)) {
+        const wchar_t* name = path + len;
+        while (name > path && name[-1] != L'\\' && name[-1] != L'/') name--;
+        exe = WideToUtf8(name, (int)(path + len - name));
+    }
+    CloseHandle(proc);
+    return exe;
+}
+
+std::string WindowClassName(HWND hwnd) {
+    wchar_t cls[256];
+    return WideToUtf8(cls, GetClassNameW(hwnd, cls, 256));
+}
+
+WinForegroundWatcher& WinForegroundWatcher::Instance() {
+    static WinForegroundWatcher inst;
+    return inst;
+}
+
+bool WinForegroundWatcher::Install(ForegroundCallback cb) {
+    callback_ = cb;
+    hook_ = SetWinEventHook(EVENT_SYSTEM_FOREGROUND, EVENT_SYSTEM_FOREGROUND, nullptr,
+                            WinEventProc, 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
+    if (!hook_) return false;
+    Report(GetForegroundWindow());
+    return true;
+}
+
+void WinForegroundWatcher::Uninstall() {
+    if (hook_) {
+        UnhookWinEvent(hook_);
+        hook_ = nullptr;
+    }
+    callback_ = nullptr;
+    lastPid_ = 0;
+    lastExe_.clear();
+}
+
+void CALLBACK WinForegroundWatcher::WinEventProc(HWINEVENTHOOK, DWORD event, HWND hwnd,
+                                                 LONG idObject, LONG idChild, DWORD, DWORD) {
+    if (event != EVENT_SYSTEM_FOREGROUND || idObject != OBJID_WINDOW || idChild != CHILDID_SELF)
+        return;
+    Instance().Report(hwnd);
+}
+
+void WinForegroundWatcher::Report(HWND hwnd) {
+    if (!hwnd || !callback_) return;
+    ForegroundApp app;
+    app.hwnd = hwnd;
+    GetWindowThreadProcessId(hwnd, &app.pid);
+    if (!app.pid || app.pid == GetCurrentProcessId()) return;   // (Install's initial query)
+
+    if (app.pid != lastPid_) {
+        lastPid_ = app.pid;
+        lastExe_ = ProcessExeName(app.pid);
+    }
+    app.exe = lastExe_;
+
+    app.windowClass = WindowClassName(hwnd);
+    callback_(app);
+}
+
+} // namespace sn
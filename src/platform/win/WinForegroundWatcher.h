@@ -0,0 +1,50 @@
+#pragma once
+#include <windows.h>
+#include <functional>
+#include <string>
+
+namespace sn {
+
+// The application owning the foreground window.
+struct ForegroundApp {
+    HWND        hwnd = nullptr;
+    DWORD       pid  = 0;
+    std::string exe;           // file name only, UTF-8, e.g. "chrome.exe"
+    std::string windowClass;   // class of the top-level window, UTF-8
+};
+
+// File name of the process image ("chrome.exe"); empty if the process
+// can't be opened (elevated or protected processes, when we aren't).
+std::string ProcessExeName(DWORD pid);
+
+// Window class name, UTF-8.
+std::string WindowClassName(HWND hwnd);
+
+using ForegroundCallback = std::function<void(const ForegroundApp& app)>;
+
+// Reports foreground window changes through an out-of-context WinEvent
+// hook (EVENT_SYSTEM_FOREGROUND) — no polling. The callback runs on the
+// thread that called Install(), from its message loop. Our own windows
+// are ignored so opening the settings doesn't switch profiles.
+class WinForegroundWatcher {
+public:
+    static WinForegroundWatcher& Instance();
+
+    // Also reports the current foreground window right away.
+    bool Install(ForegroundCallback cb);
+    void Uninstall();
+    bool IsInstalled() const { return hook_ != nullptr; }
+
+private:
+    WinForegroundWatcher() = default;
+    static void CALLBACK WinEventProc(HWINEVENTHOOK hook, DWORD event, HWND hwnd,
+                                      LONG idObject, LONG idChild, DWORD thread, DWORD time);
+    void Report(HWND hwnd);
+
+    HWINEVENTHOOK      hook_ = nullptr;
+    ForegroundCallback callback_;
+    DWORD              lastPid_ = 0;   // exe name cache: one process query per new process
+    std::string        lastExe_;
+};
+
+} // namespace sn
@@ -0,0 +1,134 @@
+#include "WinFramePacer.h"
+#include <dwmapi.h>
+#include <mmsystem.h>
+#include <cmath>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace sn {
+
+double WinFramePacer::Now() {
+    static const double freq = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return (double)f.QuadPart;
+    }();
+    LARGE_INTEGER c;
+    QueryPerformanceCounter(&c);
+    return c.QuadPart / freq;
+}
+
+bool WinFramePacer::Start(HWND hwnd, UINT msg) {
+    Stop();
+    hwnd_ = hwnd;
+    msg_  = msg;
+    // High resolution timers need Windows 10 1803
+    timer_  = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    coarse_ = !timer_;
+    if (!timer_) timer_ = CreateWaitableTimerW(nullptr, FALSE, nullptr);
+    wake_ = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (!timer_ || !wake_) {
+        Stop();
+        return false;
+    }
+    quit_   = false;
+    armed_  = false;
+    thread_ = std::thread(&WinFramePacer::Run, this);
+    return true;
+}
+
+void WinFramePacer::Stop() {
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        SetEvent(wake_);
+        thread_.join();
+    }
+    Disarm();
+    if (timer_) CloseHandle(timer_);
+    if (wake_) CloseHandle(wake_);
+    timer_ = wake_ = nullptr;
+}
+
+void WinFramePacer::SetTiming(const FrameTiming& timing) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    timing_ = timing;
+}
+
+void WinFramePacer::Arm(double due) {
+    if (coarse_ && !raised_) raised_ = timeBeginPeriod(1) == TIMERR_NOERROR;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        due_   = due;
+        armed_ = true;
+    }
+    SetEvent(wake_);
+}
+
+void WinFramePacer::Disarm() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        armed_ = false;
+    }
+    if (raised_) timeEndPeriod(1);
+    raised_ = false;
+}
+
+bool WinFramePacer::WaitUntil(double t) {
+    const double wait = t - Now();
+    if (wait <= 0.0) return true;
+    LARGE_INTEGER li;
+    li.QuadPart = -(LONGLONG)(wait * 1e7);   // relative, 100 ns units
+    if (!SetWaitableTimer(timer_, &li, 0, nullptr, nullptr, FALSE))
+        return WaitForSingleObject(wake_, (DWORD)std::ceil(wait * 1000.0)) != WAIT_OBJECT_0;
+    HANDLE waits[2] = {wake_, timer_};
+    return WaitForMultipleObjects(2, waits, FALSE, INFINITE) == WAIT_OBJECT_0 + 1;
+}
+
+void WinFramePacer::Run() {
+    for (;;) {
+        double      due;
+        FrameTiming timing;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (quit_) return;
+            due    = armed_ ? due_ : -1.0;
+            timing = timing_;
+        }
+        if (due < 0.0) {
+            WaitForSingleObject(wake_, INFINITE);
+            continue;
+        }
+
+        if (due - Now() > timing.period * 1.5) {
+            WaitUntil(due - timing.period);
+            continue;   // look at the deadline again: it may have moved
+        }
+        if (timing.dwmPaced) {
+            // DwmFlush can return at once when DWM has nothing to
+            // compose; then the timer has to do
+            const double before = Now();
+            if (FAILED(DwmFlush()) || Now() - before < timing.period / 4) {
+                if (!WaitUntil(due)) continue;
+            } else if (Now() < due - timing.period / 2) {
+                continue;   // a vblank early: wait for the next one
+            }
+        } else if (!WaitUntil(due)) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (quit_) return;
+            if (!armed_ || due_ != due) continue;   // re-armed meanwhile
+            armed_ = false;
+        }
+        PostMessageW(hwnd_, msg_, 0, 0);
+    }
+}
+
+} // namespace sn
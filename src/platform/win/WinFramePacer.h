@@ -0,0 +1,58 @@
+#pragma once
+#include <windows.h>
+#include <mutex>
+#include <thread>
+#include "WinDisplay.h"
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// WinFramePacer — posts a message to a window at a deadline, on a frame
+//
+// Its own thread does the waiting, so the wake isn't rounded up to the
+// 15.6 ms system tick like SetTimer, and keeps coming inside modal
+// loops (menus, the settings dialog). Until one frame before the
+// deadline it sleeps on a high-resolution waitable timer. The last
+// stretch is DwmFlush() when DWM composes at the monitor's rate (the
+// message goes out right after a vblank), the timer otherwise. Each
+// Arm() posts one message; the next deadline comes once the window
+// has handled it, so a busy window never has a backlog of them.
+// ─────────────────────────────────────────────────────────
+class WinFramePacer {
+public:
+    ~WinFramePacer() { Stop(); }
+
+    bool Start(HWND hwnd, UINT msg);
+    void Stop();
+    bool IsRunning() const { return thread_.joinable(); }
+
+    void SetTiming(const FrameTiming& timing);
+
+    // Post the message at `due` (Now() seconds), replacing any deadline
+    // not reached yet.
+    void Arm(double due);
+    void Disarm();
+
+    // QueryPerformanceCounter in seconds: the clock of Arm().
+    static double Now();
+
+private:
+    void Run();
+    bool WaitUntil(double t);   // false: woken early (re-armed, stopping)
+
+    HWND        hwnd_  = nullptr;
+    UINT        msg_   = 0;
+    HANDLE      timer_ = nullptr;
+    HANDLE      wake_  = nullptr;
+    bool        coarse_ = false;   // no high-resolution timer: timeBeginPeriod(1) while armed
+    bool        raised_ = false;
+    std::thread thread_;
+
+    std::mutex  mutex_;   // guards the fields below
+    FrameTiming timing_;
+    double      due_   = 0.0;
+    bool        armed_ = false;
+    bool        quit_  = false;
+};
+
+} // namespace sn
@@ -0,0 +1,102 @@
+#include "WinGdiPool.h"
+#include <cwchar>
+
+namespace sn {
+
+GdiPool& GdiPool::Instance() {
+    static GdiPool pool;
+    return pool;
+}
+
+GdiPool::Entry* GdiPool::Find(Kind kind, COLORREF color, int width, int style,
+                              DWORD quality, const wchar_t* face) {
+    stats_.acquires++;
+    for (auto& e : entries_) {
+        if (e.kind == kind && e.color == color && e.width == width && e.style == style &&
+            e.quality == quality && (!face || e.face == face)) {
+            if (e.refs++ == 0) stats_.inUse++;
+            stats_.hits++;
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+HGDIOBJ GdiPool::Add(Entry e) {
+    if (!e.handle) return nullptr;
+    e.refs = 1;
+    stats_.created++;
+    stats_.live++;
+    stats_.inUse++;
+    entries_.push_back(std::move(e));
+    return entries_.back().handle;
+}
+
+HBRUSH GdiPool::AcquireBrush(COLORREF color) {
+    if (Entry* e = Find(Kind::Brush, color, 0, 0, 0, nullptr)) return (HBRUSH)e->handle;
+    Entry e{Kind::Brush, color};
+    e.handle = CreateSolidBrush(color);
+    return (HBRUSH)Add(std::move(e));
+}
+
+HPEN GdiPool::AcquirePen(COLORREF color, int width, int style) {
+    if (Entry* e = Find(Kind::Pen, color, width, style, 0, nullptr)) return (HPEN)e->handle;
+    Entry e{Kind::Pen, color, width, style};
+    e.handle = CreatePen(style, width, color);
+    return (HPEN)Add(std::move(e));
+}
+
+HFONT GdiPool::AcquireFont(const FontSpec& spec, UINT dpi) {
+    int px = MulDiv(spec.height, dpi ? dpi : USER_DEFAULT_SCREEN_DPI, USER_DEFAULT_SCREEN_DPI);
+    if (Entry* e = Find(Kind::Font, 0, px, spec.weight, spec.quality, spec.face)) return (HFONT)e->handle;
+    Entry e{Kind::Font, 0, px, spec.weight, spec.quality, spec.face};
+    e.handle = CreateFontW(px, 0, 0, 0, spec.weight, FALSE, FALSE, FALSE,
+                           DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+                           spec.quality, DEFAULT_PITCH, spec.face);
+    return (HFONT)Add(std::move(e));
+}
+
+void GdiPool::Release(HGDIOBJ handle) {
+    if (!handle) return;
+    for (auto& e : entries_) {
+        if (e.handle == handle) {
+            if (e.refs > 0 && --e.refs == 0) stats_.inUse--;
+            return;
+        }
+    }
+}
+
+void GdiPool::Trim() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->refs == 0) {
+            DeleteObject(it->handle);
+            stats_.live--;
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void GdiPool::Shutdown() {
+    static const wchar_t* kKindName[] = {L"brush", L"pen", L"font"};
+    for (auto& e : entries_) {
+        if (e.refs > 0) {
+            wchar_t buf[160];
+            swprintf_s(buf, L"ScrollNice: leaked GDI %ls (COLORREF 0x%06X, size %d, %d ref(s))\n",
+                       kKindName[(int)e.kind], (unsigned)e.color, e.width, e.refs);
+            OutputDebugStringW(buf);
+        }
+        DeleteObject(e.handle);
+    }
+    entries_.clear();
+    stats_.live  = 0;
+    stats_.inUse = 0;
+
+    wchar_t buf[160];
+    swprintf_s(buf, L"ScrollNice: GDI pool created %llu handles for %llu acquires (%llu hits)\n",
+               stats_.created, stats_.acquires, stats_.hits);
+    OutputDebugStringW(buf);
+}
+
+} // namespace sn
@@ -0,0 +1,81 @@
+#pragma once
+#include <windows.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sn {
+
+// Font request; `height` is in px at 96 DPI and scaled by the DPI the
+// font is acquired for.
+struct FontSpec {
+    const wchar_t* face    = L"Segoe UI";
+    int            height  = 16;
+    int            weight  = FW_NORMAL;
+    DWORD          quality = CLEARTYPE_QUALITY;
+};
+
+struct GdiPoolStats {
+    uint64_t created  = 0;   // CreateXxx calls over the process lifetime
+    uint64_t acquires = 0;
+    uint64_t hits     = 0;   // acquires answered by an existing handle
+    size_t   live     = 0;   // GDI objects currently held by the pool
+    size_t   inUse    = 0;   // of those, with at least one reference
+};
+
+// ─────────────────────────────────────────────────────────
+// GdiPool — process-wide cache of brushes, pens and fonts
+//
+// Every window used to create its own copies of the same palette, and
+// owner-draw paths created and deleted a brush per paint. The pool
+// hands out one shared handle per (kind, colour, width/style, font
+// spec, DPI) with a reference count.
+//
+// Releasing the last reference keeps the handle idle rather than
+// deleting it, so per-paint Acquire/Release pairs cost a lookup, not a
+// GDI allocation. Trim() deletes idle handles; Shutdown() deletes
+// everything and reports any handle still referenced as a leak.
+//
+// UI thread only. Callers must not DeleteObject() pooled handles.
+// ─────────────────────────────────────────────────────────
+class GdiPool {
+public:
+    static GdiPool& Instance();
+
+    HBRUSH AcquireBrush(COLORREF color);
+    HPEN   AcquirePen(COLORREF color, int width = 1, int style = PS_SOLID);
+    HFONT  AcquireFont(const FontSpec& spec, UINT dpi = USER_DEFAULT_SCREEN_DPI);
+
+    // Drop one reference; nullptr and non-pooled handles are ignored.
+    void Release(HGDIOBJ handle);
+
+    // Delete handles nobody references right now.
+    void Trim();
+
+    // Delete everything (end of process). Handles still referenced are
+    // written to the debug output as leaks first.
+    void Shutdown();
+
+    const GdiPoolStats& Stats() const { return stats_; }
+
+private:
+    enum class Kind : uint8_t { Brush, Pen, Font };
+    struct Entry {
+        Kind         kind;
+        COLORREF     color  = 0;
+        int          width  = 0;   // pen width, or font height in device px
+        int          style  = 0;   // pen style, or font weight
+        DWORD        quality = 0;
+        std::wstring face;
+        HGDIOBJ      handle = nullptr;
+        int          refs   = 0;
+    };
+
+    Entry* Find(Kind kind, COLORREF color, int width, int style, DWORD quality, const wchar_t* face);
+    HGDIOBJ Add(Entry e);
+
+    std::vector<Entry> entries_;
+    GdiPoolStats       stats_;
+};
+
+} // namespace sn
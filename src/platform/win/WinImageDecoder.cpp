@@ -0,0 +1,58 @@
+#include "WinImageDecoder.h"
+#include <windows.h>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+using Microsoft::WRL::ComPtr;
+
+namespace sn {
+
+static std::wstring Utf8ToWide(const std::string& s) {
+    if (s.empty()) return {};
+    int n = MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), nullptr, 0);
+    std::wstring w(n, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), w.data(), n);
+    return w;
+}
+
+static bool Decode(const std::wstring& path, Image& out) {
+    ComPtr<IWICImagingFactory> factory;
+    if (FAILED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER,
+                                IID_PPV_ARGS(&factory))))
+        return false;
+
+    ComPtr<IWICBitmapDecoder> decoder;
+    if (FAILED(factory->CreateDecoderFromFilename(path.c_str(), nullptr, GENERIC_READ,
+                                                  WICDecodeMetadataCacheOnDemand, &decoder)))
+        return false;
+
+    ComPtr<IWICBitmapFrameDecode> frame;
+    if (FAILED(decoder->GetFrame(0, &frame))) return false;
+
+    // Straight → premultiplied happens in the converter, once, here.
+    ComPtr<IWICFormatConverter> conv;
+    if (FAILED(factory->CreateFormatConverter(&conv)) ||
+        FAILED(conv->Initialize(frame.Get(), GUID_WICPixelFormat32bppPBGRA,
+                                WICBitmapDitherTypeNone, nullptr, 0.0,
+                                WICBitmapPaletteTypeCustom)))
+        return false;
+
+    UINT w = 0, h = 0;
+    if (FAILED(conv->GetSize(&w, &h)) || w == 0 || h == 0 || w > 16384 || h > 16384)
+        return false;
+
+    out.width  = (int)w;
+    out.height = (int)h;
+    out.pixels.resize((size_t)w * h);
+    UINT stride = w * sizeof(Pixel);
+    return SUCCEEDED(conv->CopyPixels(nullptr, stride, stride * h, (BYTE*)out.pixels.data()));
+}
+
+bool DecodeImageWIC(const std::string& path, Image& out) {
+    HRESULT init = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    bool ok = Decode(Utf8ToWide(path), out);
+    if (SUCCEEDED(init)) CoUninitialize();
+    return ok;
+}
+
+} // namespace sn
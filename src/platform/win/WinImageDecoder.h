@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+#include "../../core/ImageCache.h"
+
+namespace sn {
+
+// Decode any format WIC understands (PNG, JPEG, BMP, GIF, TIFF, …) into
+// premultiplied BGRA32. `path` is UTF-8. Initialises COM for the
+// duration of the call, so it can run on any thread (ImageCache calls
+// it from its worker).
+bool DecodeImageWIC(const std::string& path, Image& out);
+
+} // namespace sn
@@ -1,7 +1,11 @@
 #include "WinInputInjector.h"
+#include "../../core/Metrics.h"
 
 namespace sn {
 
+static Counter& g_limited = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_injector_dropped_total", "Wheel units the input injector's rate limit dropped.");
+
 void WinInputInjector::SendWheel(int units) {
     if (units == 0) return;
 
@@ -11,12 +15,12 @@ void WinInputInjector::SendWheel(int units) {
         last_send_ms_ = now;
         events_this_sec_ = 0;
     }
-    if (events_this_sec_ >= max_per_sec_) return;
 
     int abs_units = (units > 0) ? units : -units;
     int sign = (units > 0) ? 1 : -1;
 
-    for (int i = 0; i < abs_units && events_this_sec_ < max_per_sec_; ++i) {
+    int sent = 0;
+    for (; sent < abs_units && events_this_sec_ < max_per_sec_; ++sent) {
         INPUT input = {};
         input.type = INPUT_MOUSE;
         input.mi.dwFlags = MOUSEEVENTF_WHEEL;
@@ -24,6 +28,7 @@ void WinInputInjector::SendWheel(int units) {
         SendInput(1, &input, sizeof(INPUT));
         events_this_sec_++;
     }
+    if (sent < abs_units) g_limited.Add((uint64_t)(abs_units - sent));
 }
 
 } // namespace sn
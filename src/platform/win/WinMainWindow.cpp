@@ -1,4 +1,6 @@
 #include "WinMainWindow.h"
+#include "WinGdiPool.h"
+#include "WinStrings.h"
 #include <commctrl.h>
 #include <sstream>
 
@@ -72,20 +74,15 @@ bool WinMainWindow::Create(HINSTANCE hInst, AppConfig& cfg,
     onSave_   = onSave;
     onEvent_  = onEvent;
 
-    hBrushBg_      = CreateSolidBrush(CLR_BG);
-    hBrushSurface_ = CreateSolidBrush(CLR_SURFACE);
-    hBrushCard_    = CreateSolidBrush(CLR_CARD);
+    GdiPool& gdi = GdiPool::Instance();
+    hBrushBg_      = gdi.AcquireBrush(CLR_BG);
+    hBrushSurface_ = gdi.AcquireBrush(CLR_SURFACE);
+    hBrushCard_    = gdi.AcquireBrush(CLR_CARD);
 
     // Modern font with better readability
-    hFont_ = CreateFontW(16, 0, 0, 0, FW_NORMAL, 0, 0, 0,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
-    hFontBold_ = CreateFontW(16, 0, 0, 0, FW_SEMIBOLD, 0, 0, 0,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
-    hFontSmall_ = CreateFontW(13, 0, 0, 0, FW_NORMAL, 0, 0, 0,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
+    hFont_      = gdi.AcquireFont({L"Segoe UI", 16, FW_NORMAL});
+    hFontBold_  = gdi.AcquireFont({L"Segoe UI", 16, FW_SEMIBOLD});
+    hFontSmall_ = gdi.AcquireFont({L"Segoe UI", 13, FW_NORMAL});
 
     WNDCLASSEXW wc = {};
     wc.cbSize        = sizeof(wc);
@@ -93,7 +90,7 @@ bool WinMainWindow::Create(HINSTANCE hInst, AppConfig& cfg,
     wc.lpfnWndProc   = WndProc;
     wc.hInstance      = hInst;
     wc.lpszClassName  = kMainClass;
-    wc.hbrBackground  = hBrushBg_;
+    wc.hbrBackground  = nullptr;   // WM_ERASEBKGND paints hBrushBg_ (the window may be rebuilt)
     wc.hCursor        = LoadCursor(nullptr, IDC_ARROW);
     wc.hIcon          = LoadIcon(nullptr, IDI_APPLICATION);
     RegisterClassExW(&wc);
@@ -102,7 +99,8 @@ bool WinMainWindow::Create(HINSTANCE hInst, AppConfig& cfg,
     int sx = (GetSystemMetrics(SM_CXSCREEN) - W) / 2;
     int sy = (GetSystemMetrics(SM_CYSCREEN) - H) / 2;
 
-    hwnd_ = CreateWindowExW(WS_EX_APPWINDOW | WS_EX_WINDOWEDGE, kMainClass, L"ScrollNice - Settings",
+    hwnd_ = CreateWindowExW(WS_EX_APPWINDOW | WS_EX_WINDOWEDGE, kMainClass,
+        Tr("main.title", L"ScrollNice - Settings"),
         WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_MINIMIZEBOX,
         sx, sy, W, H, nullptr, nullptr, hInst, nullptr);
     if (!hwnd_) return false;
@@ -114,12 +112,13 @@ bool WinMainWindow::Create(HINSTANCE hInst, AppConfig& cfg,
 
 void WinMainWindow::Destroy() {
     if (hwnd_) { DestroyWindow(hwnd_); hwnd_ = nullptr; }
-    if (hFont_)          { DeleteObject(hFont_);          hFont_ = nullptr; }
-    if (hFontBold_)      { DeleteObject(hFontBold_);      hFontBold_ = nullptr; }
-    if (hFontSmall_)     { DeleteObject(hFontSmall_);     hFontSmall_ = nullptr; }
-    if (hBrushBg_)       { DeleteObject(hBrushBg_);       hBrushBg_ = nullptr; }
-    if (hBrushSurface_)  { DeleteObject(hBrushSurface_);  hBrushSurface_ = nullptr; }
-    if (hBrushCard_)     { DeleteObject(hBrushCard_);     hBrushCard_ = nullptr; }
+    GdiPool& gdi = GdiPool::Instance();
+    gdi.Release(hFont_);          hFont_ = nullptr;
+    gdi.Release(hFontBold_);      hFontBold_ = nullptr;
+    gdi.Release(hFontSmall_);     hFontSmall_ = nullptr;
+    gdi.Release(hBrushBg_);       hBrushBg_ = nullptr;
+    gdi.Release(hBrushSurface_);  hBrushSurface_ = nullptr;
+    gdi.Release(hBrushCard_);     hBrushCard_ = nullptr;
     g_mainWnd = nullptr;
 }
 
@@ -141,32 +140,32 @@ void WinMainWindow::InitControls() {
     const int EDIT_W = 75;   // edit field width
 
     // ═══ Zone GroupBox ═══
-    HWND g1 = mk(L"BUTTON", L"  🖱️ Zone Settings", BS_GROUPBOX, LX, y, PW, 190, 0);
+    HWND g1 = mk(L"BUTTON", Tr("main.group_zone", L"  🖱️ Zone Settings"), BS_GROUPBOX, LX, y, PW, 190, 0);
     SendMessage(g1, WM_SETFONT, (WPARAM)hFontBold_, TRUE);
     y += 28;
 
-    mk(L"BUTTON", L"Enable Zone", BS_AUTOCHECKBOX, LX+20, y, 150, 24, IDC_ZONE_ENABLE);
-    mk(L"STATIC", L"Scroll Mode:", 0, LX+200, y, 90, 22, 0);
+    mk(L"BUTTON", Tr("main.enable_zone", L"Enable Zone"), BS_AUTOCHECKBOX, LX+20, y, 150, 24, IDC_ZONE_ENABLE);
+    mk(L"STATIC", Tr("main.scroll_mode", L"Scroll Mode:"), 0, LX+200, y, 90, 22, 0);
     HWND combo = mk(L"COMBOBOX", L"", CBS_DROPDOWNLIST | WS_VSCROLL,
                      LX+295, y-2, 200, 120, IDC_MODE_COMBO);
-    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)L"Mode 1: Click/Hold");
-    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)L"Mode 2: Top/Bottom Split");
-    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)L"Mode 3: Hover Auto");
+    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)Tr("main.mode_click_hold", L"Mode 1: Click/Hold"));
+    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)Tr("main.mode_split_hold", L"Mode 2: Top/Bottom Split"));
+    SendMessage(combo, CB_ADDSTRING, 0, (LPARAM)Tr("main.mode_hover_auto", L"Mode 3: Hover Auto"));
     y += 32;
 
-    mk(L"STATIC", L"Position X:", 0, LX+20, y, LBL_W, 22, 0);
+    mk(L"STATIC", Tr("main.position_x", L"Position X:"), 0, LX+20, y, LBL_W, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+130, y-2, EDIT_W, 26, IDC_ZONE_X);
     mk(L"STATIC", L"Y:", 0, LX+220, y, 20, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+245, y-2, EDIT_W, 26, IDC_ZONE_Y);
     y += 30;
 
-    mk(L"STATIC", L"Size Width:", 0, LX+20, y, LBL_W, 22, 0);
+    mk(L"STATIC", Tr("main.size_width", L"Size Width:"), 0, LX+20, y, LBL_W, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+130, y-2, EDIT_W, 26, IDC_ZONE_W);
-    mk(L"STATIC", L"Height:", 0, LX+220, y, 50, 22, 0);
+    mk(L"STATIC", Tr("main.height", L"Height:"), 0, LX+220, y, 50, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+275, y-2, EDIT_W, 26, IDC_ZONE_H);
     y += 32;
 
-    mk(L"STATIC", L"Opacity:", 0, LX+20, y, 70, 22, 0);
+    mk(L"STATIC", Tr("main.opacity", L"Opacity:"), 0, LX+20, y, 70, 22, 0);
     HWND slider = mk(TRACKBAR_CLASSW, L"", TBS_HORZ | TBS_AUTOTICKS,
                      LX+95, y-3, 280, 30, IDC_ZONE_OPACITY);
     SendMessage(slider, TBM_SETRANGE, TRUE, MAKELPARAM(5, 100));
@@ -174,60 +173,60 @@ void WinMainWindow::InitControls() {
     mk(L"STATIC", L"25%", SS_CENTER, LX+390, y, 50, 24, IDC_ZONE_OPACITY_LBL);
     y += 32;
 
-    mk(L"BUTTON", L"Lock Position", BS_AUTOCHECKBOX, LX+20, y, 160, 24, IDC_ZONE_LOCKED);
+    mk(L"BUTTON", Tr("main.lock_position", L"Lock Position"), BS_AUTOCHECKBOX, LX+20, y, 160, 24, IDC_ZONE_LOCKED);
     y += 32 + 8;
 
     // ═══ Scroll GroupBox ═══
-    HWND g2 = mk(L"BUTTON", L"  ⚙️ Scroll Settings", BS_GROUPBOX, LX, y, PW, 130, 0);
+    HWND g2 = mk(L"BUTTON", Tr("main.group_scroll", L"  ⚙️ Scroll Settings"), BS_GROUPBOX, LX, y, PW, 130, 0);
     SendMessage(g2, WM_SETFONT, (WPARAM)hFontBold_, TRUE);
     y += 28;
 
-    mk(L"STATIC", L"Scroll Amount:", 0, LX+20, y, 100, 22, 0);
+    mk(L"STATIC", Tr("main.scroll_amount", L"Scroll Amount:"), 0, LX+20, y, 100, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+125, y-2, EDIT_W, 26, IDC_SCROLL_AMOUNT);
-    mk(L"STATIC", L"px/click", 0, LX+210, y, 70, 22, 0);
+    mk(L"STATIC", Tr("main.px_per_click", L"px/click"), 0, LX+210, y, 70, 22, 0);
     y += 30;
 
-    mk(L"STATIC", L"Hold Speed:", 0, LX+20, y, 90, 22, 0);
+    mk(L"STATIC", Tr("main.hold_speed", L"Hold Speed:"), 0, LX+20, y, 90, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+115, y-2, 55, 26, IDC_HOLD_SPEED);
-    mk(L"STATIC", L"Accel:", 0, LX+185, y, 50, 22, 0);
+    mk(L"STATIC", Tr("main.accel", L"Accel:"), 0, LX+185, y, 50, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+240, y-2, 55, 26, IDC_HOLD_ACCEL);
-    mk(L"STATIC", L"Hover:", 0, LX+310, y, 50, 22, 0);
+    mk(L"STATIC", Tr("main.hover_speed", L"Hover:"), 0, LX+310, y, 50, 22, 0);
     mk(L"EDIT", L"", WS_BORDER | ES_NUMBER, LX+365, y-2, 55, 26, IDC_HOVER_SPEED);
     y += 32 + 8;
 
     // ═══ General GroupBox ═══
-    HWND g3 = mk(L"BUTTON", L"  🎛️ General Settings", BS_GROUPBOX, LX, y, PW, 110, 0);
+    HWND g3 = mk(L"BUTTON", Tr("main.group_general", L"  🎛️ General Settings"), BS_GROUPBOX, LX, y, PW, 110, 0);
     SendMessage(g3, WM_SETFONT, (WPARAM)hFontBold_, TRUE);
     y += 28;
 
-    mk(L"BUTTON", L"Block Mouse Wheel (Ctrl+Alt+W)", BS_AUTOCHECKBOX, LX+20, y, 320, 24, IDC_WHEEL_BLOCK);
+    mk(L"BUTTON", Tr("main.block_wheel", L"Block Mouse Wheel (Ctrl+Alt+W)"), BS_AUTOCHECKBOX, LX+20, y, 320, 24, IDC_WHEEL_BLOCK);
     y += 26;
-    mk(L"BUTTON", L"Start with Windows", BS_AUTOCHECKBOX, LX+20, y, 200, 24, IDC_START_WINDOWS);
+    mk(L"BUTTON", Tr("main.start_with_windows", L"Start with Windows"), BS_AUTOCHECKBOX, LX+20, y, 200, 24, IDC_START_WINDOWS);
     y += 26;
-    mk(L"BUTTON", L"Click Sound", BS_AUTOCHECKBOX, LX+20, y, 150, 24, IDC_SOUND_ENABLED);
+    mk(L"BUTTON", Tr("main.click_sound", L"Click Sound"), BS_AUTOCHECKBOX, LX+20, y, 150, 24, IDC_SOUND_ENABLED);
     y += 32 + 8;
 
     // ═══ Hotkeys GroupBox ═══
-    HWND g4 = mk(L"BUTTON", L"  ⌨️ Hotkey Settings", BS_GROUPBOX, LX, y, PW, 100, 0);
+    HWND g4 = mk(L"BUTTON", Tr("main.group_hotkeys", L"  ⌨️ Hotkey Settings"), BS_GROUPBOX, LX, y, PW, 100, 0);
     SendMessage(g4, WM_SETFONT, (WPARAM)hFontBold_, TRUE);
     y += 28;
 
-    mk(L"STATIC", L"Toggle Zone:", 0, LX+20, y, 90, 22, 0);
+    mk(L"STATIC", Tr("main.hotkey_toggle", L"Toggle Zone:"), 0, LX+20, y, 90, 22, 0);
     mk(L"EDIT", L"", WS_BORDER, LX+115, y-2, 120, 26, IDC_HK_TOGGLE);
-    mk(L"STATIC", L"Edit Mode:", 0, LX+255, y, 80, 22, 0);
+    mk(L"STATIC", Tr("main.hotkey_edit", L"Edit Mode:"), 0, LX+255, y, 80, 22, 0);
     mk(L"EDIT", L"", WS_BORDER, LX+340, y-2, 120, 26, IDC_HK_EDIT);
     y += 30;
-    mk(L"STATIC", L"Block Wheel:", 0, LX+20, y, 90, 22, 0);
+    mk(L"STATIC", Tr("main.hotkey_wheel", L"Block Wheel:"), 0, LX+20, y, 90, 22, 0);
     mk(L"EDIT", L"", WS_BORDER, LX+115, y-2, 120, 26, IDC_HK_WHEEL);
     y += 36 + 8;
 
     // ═══ Buttons ═══
-    mk(L"BUTTON", L"💾 Save Settings", BS_DEFPUSHBUTTON, LX+140, y, 130, 42, IDC_SAVE_BTN);
-    mk(L"BUTTON", L"🔄 Reset to Default", 0, LX+290, y, 130, 42, IDC_RESET_BTN);
+    mk(L"BUTTON", Tr("main.save", L"💾 Save Settings"), BS_DEFPUSHBUTTON, LX+140, y, 130, 42, IDC_SAVE_BTN);
+    mk(L"BUTTON", Tr("main.reset", L"🔄 Reset to Default"), 0, LX+290, y, 130, 42, IDC_RESET_BTN);
     y += 52;
 
     // ═══ Status Bar ═══
-    mk(L"STATIC", L"Zone: OFF | Mode 1 | Ready",
+    mk(L"STATIC", Tr("main.status_initial", L"Zone: OFF | Mode 1 | Ready"),
        SS_CENTER | SS_SUNKEN, 0, y, 560, 26, IDC_STATUS_BAR);
 
     // Apply font to all children
@@ -362,40 +361,40 @@ LRESULT CALLBACK WinMainWindow::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPAR
             HDC hdc = dis->hDC;
             RECT rc = dis->rcItem;
 
-            // Background
-            HBRUSH bgBrush;
+            // Background (pooled brush/pen: a lookup per paint, not a GDI alloc)
+            COLORREF bgColor = CLR_CARD;
             COLORREF textColor = CLR_TEXT;
             COLORREF borderColor = CLR_BORDER;
 
             if (dis->itemState & ODS_SELECTED) {
-                bgBrush = CreateSolidBrush(CLR_ACCENT);
+                bgColor = CLR_ACCENT;
                 textColor = RGB(255, 255, 255);
                 borderColor = CLR_ACCENT_H;
             } else if (dis->itemState & ODS_HOT) {
-                bgBrush = CreateSolidBrush(CLR_CARD_H);
+                bgColor = CLR_CARD_H;
                 borderColor = CLR_BORDER_H;
-            } else {
-                bgBrush = CreateSolidBrush(CLR_CARD);
             }
 
+            GdiPool& gdi = GdiPool::Instance();
+            HBRUSH bgBrush = gdi.AcquireBrush(bgColor);
             FillRect(hdc, &rc, bgBrush);
 
             // Border
-            HPEN pen = CreatePen(PS_SOLID, 1, borderColor);
+            HPEN pen = gdi.AcquirePen(borderColor);
             HPEN oldPen = (HPEN)SelectObject(hdc, pen);
             HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, (HBRUSH)GetStockObject(NULL_BRUSH));
             Rectangle(hdc, rc.left, rc.top, rc.right, rc.bottom);
             SelectObject(hdc, oldPen);
             SelectObject(hdc, oldBrush);
-            DeleteObject(pen);
-            DeleteObject(bgBrush);
+            gdi.Release(pen);
+            gdi.Release(bgBrush);
 
             // Text
             wchar_t text[256];
             GetWindowTextW(dis->hwndItem, text, 256);
             SetBkMode(hdc, TRANSPARENT);
             SetTextColor(hdc, textColor);
-            HFONT oldFont = (HFONT)SelectObject(hdc, hFont_);
+            HFONT oldFont = (HFONT)SelectObject(hdc, self->hFont_);
             DrawTextW(hdc, text, -1, &rc, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
             SelectObject(hdc, oldFont);
 
@@ -419,12 +418,16 @@ LRESULT CALLBACK WinMainWindow::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPAR
     case WM_TIMER:
         if (self && wParam == IDC_TIMER_STATUS) {
             bool zoneOn = self->cfg_ && self->cfg_->enabled;
-            std::wstring status = zoneOn ? L"✓ Zone: ON" : L"✗ Zone: OFF";
+            std::wstring status = zoneOn ? Tr("main.status_on", L"✓ Zone: ON") : Tr("main.status_off", L"✗ Zone: OFF");
 
             int modeIdx = (int)SendDlgItemMessage(hwnd, IDC_MODE_COMBO, CB_GETCURSEL, 0, 0);
-            const wchar_t* modeNames[] = {L"Click/Hold", L"Top/Bottom", L"Hover Auto"};
+            const wchar_t* modeNames[] = {Tr("main.status_click_hold", L"Click/Hold"),
+                                          Tr("main.status_split_hold", L"Top/Bottom"),
+                                          Tr("main.status_hover_auto", L"Hover Auto")};
             if (modeIdx >= 0 && modeIdx < 3) {
-                status += L" | Mode: ";
+                status += L" | ";
+                status += Tr("main.status_mode", L"Mode:");
+                status += L" ";
                 status += modeNames[modeIdx];
             }
 
@@ -0,0 +1,43 @@
+#include "../../core/MappedFile.h"
+#include <windows.h>
+
+namespace sn {
+
+static std::wstring Utf8ToWide(const std::string& s) {
+    if (s.empty()) return {};
+    int n = MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), nullptr, 0);
+    std::wstring w(n, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), w.data(), n);
+    return w;
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    HANDLE file = CreateFileW(Utf8ToWide(path).c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size = {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) { CloseHandle(file); return false; }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);   // the mapping keeps its own reference
+    if (!mapping) return false;
+    void* p = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!p) { CloseHandle(mapping); return false; }
+
+    data_    = static_cast<const uint8_t*>(p);
+    size_    = (size_t)size.QuadPart;
+    mapping_ = mapping;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data_)    UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(mapping_);
+    data_    = nullptr;
+    size_    = 0;
+    mapping_ = nullptr;
+}
+
+} // namespace sn
@@ -0,0 +1,137 @@
+#include "../../core/MetricsServer.h"
+#include <windows.h>
+#include <thread>
+
+namespace sn {
+
+// ─────── Named pipe ───────
+// One overlapped pipe instance at a time; the thread waits on it and on
+// a stop event. The next instance is created before the served one is
+// closed, so a scraper never finds the name missing. Closing (rather
+// than DisconnectNamedPipe) leaves the reply readable by the client.
+class WinMetricsServer : public MetricsServer {
+public:
+    ~WinMetricsServer() override { Stop(); }
+
+    bool Start(Render render) override {
+        Stop();
+        render_ = std::move(render);
+        ioEvent_   = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        stopEvent_ = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        // FIRST_PIPE_INSTANCE: fail rather than share the name with
+        // another process's server
+        if (!ioEvent_ || !stopEvent_ || !(pipe_ = CreateInstance(FILE_FLAG_FIRST_PIPE_INSTANCE))) {
+            Close();
+            return false;
+        }
+        thread_ = std::thread(&WinMetricsServer::Run, this);
+        return true;
+    }
+
+    void Stop() override {
+        if (thread_.joinable()) {
+            SetEvent(stopEvent_);
+            thread_.join();
+        }
+        Close();
+    }
+
+    std::string Endpoint() const override { return "\\\\.\\pipe\\ScrollNice-metrics"; }
+
+private:
+    static constexpr const wchar_t* kPipeName = L"\\\\.\\pipe\\ScrollNice-metrics";
+
+    HANDLE CreateInstance(DWORD extraFlags) {
+        HANDLE h = CreateNamedPipeW(kPipeName, PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | extraFlags,
+                                    PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT |
+                                        PIPE_REJECT_REMOTE_CLIENTS,
+                                    2, 64 * 1024, 4096, 0, nullptr);
+        return h == INVALID_HANDLE_VALUE ? nullptr : h;
+    }
+
+    // Wait for the pending operation on pipe_ for up to `ms`; false on
+    // stop, timeout (the operation is cancelled) or failure.
+    bool Complete(DWORD& bytes, DWORD ms) {
+        HANDLE waits[2] = {ioEvent_, stopEvent_};
+        if (WaitForMultipleObjects(2, waits, FALSE, ms) != WAIT_OBJECT_0) {
+            CancelIoEx(pipe_, &ov_);
+            GetOverlappedResult(pipe_, &ov_, &bytes, TRUE);
+            return false;
+        }
+        return GetOverlappedResult(pipe_, &ov_, &bytes, FALSE) != 0;
+    }
+
+    void Reset() {
+        ZeroMemory(&ov_, sizeof(ov_));
+        ResetEvent(ioEvent_);
+        ov_.hEvent = ioEvent_;
+    }
+
+    void Run() {
+        for (;;) {
+            Reset();
+            DWORD bytes = 0;
+            bool connected = ConnectNamedPipe(pipe_, &ov_) != 0;
+            const DWORD err = GetLastError();
+            if (!connected && err == ERROR_PIPE_CONNECTED) connected = true;
+            else if (!connected && err == ERROR_IO_PENDING) connected = Complete(bytes, INFINITE);
+            if (WaitForSingleObject(stopEvent_, 0) == WAIT_OBJECT_0) return;
+
+            if (connected) Serve();
+            HANDLE next = CreateInstance(0);
+            CloseHandle(pipe_);
+            pipe_ = next;
+            if (!pipe_) return;
+        }
+    }
+
+    void Serve() {
+        // Up to the end of the request headers, whatever arrives in
+        // 100 ms, or EOF
+        std::string request;
+        char buf[1024];
+        const ULONGLONG deadline = GetTickCount64() + 100;
+        while (request.size() < 4096 && request.find("\r\n\r\n") == std::string::npos) {
+            const ULONGLONG now = GetTickCount64();
+            if (now >= deadline) break;
+            Reset();
+            DWORD n = 0;
+            if (!ReadFile(pipe_, buf, sizeof(buf), &n, &ov_) &&
+                (GetLastError() != ERROR_IO_PENDING || !Complete(n, (DWORD)(deadline - now))))
+                break;
+            if (!n) break;
+            request.append(buf, n);
+        }
+
+        const std::string reply = MetricsResponse(request, render_());
+        for (size_t sent = 0; sent < reply.size();) {
+            Reset();
+            DWORD n = 0;
+            // A client that stops reading mustn't hold up Stop()
+            if (!WriteFile(pipe_, reply.data() + sent, (DWORD)(reply.size() - sent), &n, &ov_) &&
+                (GetLastError() != ERROR_IO_PENDING || !Complete(n, 1000)))
+                return;
+            if (!n) return;
+            sent += n;
+        }
+    }
+
+    void Close() {
+        if (pipe_)      { CloseHandle(pipe_);      pipe_ = nullptr; }
+        if (ioEvent_)   { CloseHandle(ioEvent_);   ioEvent_ = nullptr; }
+        if (stopEvent_) { CloseHandle(stopEvent_); stopEvent_ = nullptr; }
+    }
+
+    Render      render_;
+    HANDLE      pipe_      = nullptr;
+    HANDLE      ioEvent_   = nullptr;
+    HANDLE      stopEvent_ = nullptr;
+    OVERLAPPED  ov_{};
+    std::thread thread_;
+};
+
+std::unique_ptr<MetricsServer> CreateMetricsServer() {
+    return std::make_unique<WinMetricsServer>();
+}
+
+} // namespace sn
@@ -1,7 +1,13 @@
 #include "WinMouseHook.h"
+#include "../../core/Metrics.h"
 
 namespace sn {
 
+static Counter& g_hookSeen = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_hook_events_total", "Mouse events the low-level hook saw.");
+static Counter& g_hookBlocked = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_hook_blocked_total", "Mouse events the low-level hook swallowed.");
+
 WinMouseHook& WinMouseHook::Instance() {
     static WinMouseHook inst;
     return inst;
@@ -25,9 +31,13 @@ LRESULT CALLBACK WinMouseHook::LowLevelMouseProc(int nCode, WPARAM wParam, LPARA
     if (nCode == HC_ACTION) {
         auto* data = reinterpret_cast<MSLLHOOKSTRUCT*>(lParam);
         auto& inst = Instance();
+        g_hookSeen.Add();
         if (inst.callback_) {
             bool eat = inst.callback_(data->pt, (DWORD)wParam, data);
-            if (eat) return 1; // block the event
+            if (eat) {
+                g_hookBlocked.Add();
+                return 1; // block the event
+            }
         }
     }
     return CallNextHookEx(nullptr, nCode, wParam, lParam);
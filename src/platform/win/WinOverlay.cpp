@@ -1,11 +1,27 @@
 #include "WinOverlay.h"
+#include "WinImageDecoder.h"
+#include "WinDisplay.h"
+#include "WinGdiPool.h"
+#include "WinStrings.h"
+#include "../../core/Metrics.h"
+#include "../../core/Resampler.h"
 #include <windowsx.h>
 #include <algorithm>
+#include <cstring>
+#include <cwchar>
 
 namespace sn {
 
 static WinOverlay* g_zoneWnd = nullptr;
 static const wchar_t* kZoneClass = L"ScrollNice_Zone";
+static const UINT WM_COVER_READY = WM_APP + 1;     // ImageCache worker finished a job
+static const UINT WM_GESTURE_FRAME = WM_APP + 2;   // drag/resize frame from gesturePacer_
+static const UINT_PTR kGestureTimer = 1;            // the same, when the pacer can't start
+
+static Counter& g_presents = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_overlay_paints_total", "Overlay frames pushed to the screen (UpdateLayeredWindow).");
+static Counter& g_renders = MetricsRegistry::Instance().AddCounter(
+    "scrollnice_overlay_renders_total", "Overlay frames rendered rather than taken from the frame cache.");
 
 // ─────── Helpers ───────
 static COLORREF HexToColorRef(const std::string& hex) {
@@ -18,36 +34,142 @@ static COLORREF HexToColorRef(const std::string& hex) {
 
 // ─────── GDI cache ───────
 void WinOverlay::InitGDI() {
-    // Fonts
-    fontBold_  = CreateFontW(14, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                              DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-                              CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
-    fontSmall_ = CreateFontW(10, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                              DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-                              CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
-    // Pens
-    borderPen_ = CreatePen(PS_SOLID, 2, RGB(255, 255, 255));
-    editPen_   = CreatePen(PS_SOLID, 3, RGB(255, 140, 0));
-    dashPen_   = CreatePen(PS_DASH,  1, RGB(255, 255, 255));
-
-    // Brushes (Mode 3 tint areas)
-    topBrush_  = CreateSolidBrush(RGB(40, 80, 160));
-    botBrush_  = CreateSolidBrush(RGB(160, 40, 40));
-    editBrush_ = CreateSolidBrush(RGB(255, 140, 0));
+    // Fonts — grayscale AA: labels are rasterised into coverage masks,
+    // which ClearType's per-channel subpixel output can't represent.
+    GdiPool& gdi = GdiPool::Instance();
+    fontBold_  = gdi.AcquireFont({L"Segoe UI", 14, FW_BOLD,   ANTIALIASED_QUALITY}, dpi_);
+    fontSmall_ = gdi.AcquireFont({L"Segoe UI", 10, FW_NORMAL, ANTIALIASED_QUALITY}, dpi_);
 }
 
 void WinOverlay::DestroyGDI() {
-    auto del = [](auto*& h) { if (h) { DeleteObject(h); h = nullptr; } };
-    del(fontBold_);
-    del(fontSmall_);
-    del(borderPen_);
-    del(editPen_);
-    del(dashPen_);
-    del(glowPen_);
-    del(topBrush_);
-    del(botBrush_);
-    del(editBrush_);
-    del(hoverBrush_);
+    GdiPool& gdi = GdiPool::Instance();
+    gdi.Release(fontBold_);  fontBold_  = nullptr;
+    gdi.Release(fontSmall_); fontSmall_ = nullptr;
+    for (auto& l : labels_) l = LabelMask{};
+}
+
+// ─────── Label masks ───────
+// Text shaping happens here exactly once per label; every frame after
+// that just blends the cached coverage.
+const CoverageMask* WinOverlay::Label(ZoneLabel id) {
+    LabelMask& lm = labels_[(int)id];
+    if (lm.built) return lm.bits.empty() ? nullptr : &lm.mask;
+    lm.built = true;
+    if (!fontBold_) InitGDI();
+
+    const wchar_t* text = L"";
+    HFONT font = fontBold_;
+    switch (id) {
+        case ZoneLabel::ClickHint: text = L"L\u2191  R\u2193"; font = fontSmall_; break;
+        case ZoneLabel::HoverUp:   text = Tr("zone.hover_up",   L"\u25B2 HOVER"); break;
+        case ZoneLabel::HoverDown: text = Tr("zone.hover_down", L"\u25BC HOVER"); break;
+        case ZoneLabel::Lock:      text = L"🔒";             font = fontSmall_; break;
+        default: return nullptr;
+    }
+    int len = (int)wcslen(text);
+
+    HDC dc = CreateCompatibleDC(nullptr);
+    HFONT oldFont = (HFONT)SelectObject(dc, font);
+    SIZE sz = {};
+    GetTextExtentPoint32W(dc, text, len, &sz);
+
+    BITMAPINFO bi = {};
+    bi.bmiHeader.biSize        = sizeof(bi.bmiHeader);
+    bi.bmiHeader.biWidth       = sz.cx;
+    bi.bmiHeader.biHeight      = -sz.cy;
+    bi.bmiHeader.biPlanes      = 1;
+    bi.bmiHeader.biBitCount    = 32;
+    bi.bmiHeader.biCompression = BI_RGB;
+    void* bits = nullptr;
+    HBITMAP bmp = (sz.cx > 0 && sz.cy > 0)
+        ? CreateDIBSection(dc, &bi, DIB_RGB_COLORS, &bits, nullptr, 0) : nullptr;
+
+    if (bmp) {
+        HBITMAP oldBmp = (HBITMAP)SelectObject(dc, bmp);
+        ZeroMemory(bits, (size_t)sz.cx * sz.cy * 4);
+        SetBkMode(dc, TRANSPARENT);
+        SetTextColor(dc, RGB(255, 255, 255));
+        TextOutW(dc, 0, 0, text, len);
+        GdiFlush();
+
+        // White-on-black render: any channel is the coverage
+        const uint32_t* px = static_cast<const uint32_t*>(bits);
+        lm.bits.resize((size_t)sz.cx * sz.cy);
+        for (size_t i = 0; i < lm.bits.size(); ++i)
+            lm.bits[i] = (uint8_t)((px[i] >> 8) & 0xFF);
+        lm.mask = {lm.bits.data(), (int)sz.cx, (int)sz.cy, (int)sz.cx};
+
+        SelectObject(dc, oldBmp);
+        DeleteObject(bmp);
+    }
+    SelectObject(dc, oldFont);
+    DeleteDC(dc);
+    return lm.bits.empty() ? nullptr : &lm.mask;
+}
+
+// ─────── Back buffer ───────
+// Grow-only: a smaller zone uses the top-left w × h of the bitmap it
+// already has, so shrinking (and growing back) during a resize creates
+// no GDI objects. Growth takes half again as much room, so a resize
+// that keeps growing reallocates a handful of times, not every frame.
+bool WinOverlay::EnsureBackBuffer(int w, int h) {
+    if (w <= 0 || h <= 0) return false;
+    if (!backDC_) {
+        backDC_ = CreateCompatibleDC(nullptr);
+        if (!backDC_) return false;
+    }
+    if (backBits_ && w <= backCapW_ && h <= backCapH_) {
+        backW_ = w; backH_ = h;
+        return true;
+    }
+
+    const int capW = std::max(w, backCapW_ + backCapW_ / 2);
+    const int capH = std::max(h, backCapH_ + backCapH_ / 2);
+    BITMAPINFO bi = {};
+    bi.bmiHeader.biSize        = sizeof(bi.bmiHeader);
+    bi.bmiHeader.biWidth       = capW;
+    bi.bmiHeader.biHeight      = -capH;   // top-down
+    bi.bmiHeader.biPlanes      = 1;
+    bi.bmiHeader.biBitCount    = 32;
+    bi.bmiHeader.biCompression = BI_RGB;
+
+    void* bits = nullptr;
+    HBITMAP bmp = CreateDIBSection(nullptr, &bi, DIB_RGB_COLORS, &bits, nullptr, 0);
+    if (!bmp) return false;
+
+    HBITMAP old = (HBITMAP)SelectObject(backDC_, bmp);
+    if (backBmp_) DeleteObject(backBmp_);
+    else          backOld_ = old;
+    backBmp_  = bmp;
+    backBits_ = static_cast<uint32_t*>(bits);
+    backCapW_ = capW; backCapH_ = capH;
+    backW_ = w; backH_ = h;
+    return true;
+}
+
+void WinOverlay::ReleaseBackBuffer() {
+    if (backDC_ && backOld_) SelectObject(backDC_, backOld_);
+    if (backBmp_) DeleteObject(backBmp_);
+    if (backDC_)  DeleteDC(backDC_);
+    backDC_ = nullptr; backBmp_ = nullptr; backOld_ = nullptr;
+    backBits_ = nullptr; backW_ = backH_ = backCapW_ = backCapH_ = 0;
+}
+
+BYTE WinOverlay::PresentAlpha() const {
+    BYTE a = (BYTE)(cfg_.opacity * 255);
+    return a < 20 ? 20 : a;
+}
+
+void WinOverlay::Present() {
+    if (!hwnd_ || !backDC_) return;
+    BYTE a = PresentAlpha();
+
+    POINT dst = {cfg_.x, cfg_.y};
+    POINT src = {0, 0};
+    SIZE  sz  = {backW_, backH_};
+    BLENDFUNCTION bf = {AC_SRC_OVER, 0, a, AC_SRC_ALPHA};
+    UpdateLayeredWindow(hwnd_, nullptr, &dst, &sz, backDC_, &src, 0, &bf, ULW_ALPHA);
+    g_presents.Add();
 }
 
 // ─────── Create / Destroy ───────
@@ -58,7 +180,7 @@ bool WinOverlay::Create(HINSTANCE hInst, const ZoneConfig& cfg, ZoneEventCallbac
 
     WNDCLASSEXW wc   = {};
     wc.cbSize        = sizeof(wc);
-    wc.style         = CS_HREDRAW | CS_VREDRAW | CS_DBLCLKS;
+    wc.style         = CS_DBLCLKS;
     wc.lpfnWndProc   = WndProc;
     wc.hInstance      = hInst;
     wc.lpszClassName  = kZoneClass;
@@ -75,8 +197,14 @@ bool WinOverlay::Create(HINSTANCE hInst, const ZoneConfig& cfg, ZoneEventCallbac
     );
     if (!hwnd_) return false;
 
-    InitGDI();
-    SetOpacity(cfg_.opacity);
+    dpi_ = GetDpiForWindow(hwnd_);
+    if (dpi_ == 0) dpi_ = USER_DEFAULT_SCREEN_DPI;
+    // Fonts, label masks, the back buffer and the image cache are all
+    // built on first use, so a hidden zone costs no GDI objects.
+    // The first UpdateLayeredWindow call gives the layered window its content.
+    // SetLayeredWindowAttributes must never be used on this window: it would
+    // switch it to constant-alpha mode and make UpdateLayeredWindow fail.
+    if (enabled_) Redraw();
     // Don't show here — let the caller (ApplyConfig) control visibility
     // based on whether the app starts enabled or disabled.
     return true;
@@ -84,8 +212,12 @@ bool WinOverlay::Create(HINSTANCE hInst, const ZoneConfig& cfg, ZoneEventCallbac
 }
 
 void WinOverlay::Destroy() {
+    gesturePacer_.Stop();
+    frames_.Invalidate();
     DestroyGDI();
-    if (coverBmp_) { DeleteObject(coverBmp_); coverBmp_ = nullptr; }
+    ReleaseBackBuffer();
+    images_.reset();   // joins the decode worker before the window goes away
+    cover_.reset();
     if (hwnd_) { DestroyWindow(hwnd_); hwnd_ = nullptr; }
     g_zoneWnd = nullptr;
 }
@@ -99,9 +231,7 @@ void WinOverlay::SetPosition(int x, int y) {
 
 void WinOverlay::SetSize(int w, int h) {
     cfg_.width = w; cfg_.height = h;
-    if (hwnd_) SetWindowPos(hwnd_, nullptr, 0, 0, w, h,
-                             SWP_NOMOVE | SWP_NOZORDER | SWP_NOACTIVATE);
-    Redraw();
+    Redraw();   // UpdateLayeredWindow resizes the window to the new buffer
 }
 
 void WinOverlay::SetLocked(bool locked) { cfg_.locked = locked; Redraw(); }
@@ -110,212 +240,206 @@ void WinOverlay::SetScrollMode(ScrollMode mode) { mode_ = mode; Redraw(); }
 
 void WinOverlay::SetOpacity(double alpha) {
     cfg_.opacity = alpha;
-    if (hwnd_) {
-        BYTE a = (BYTE)(alpha * 255);
-        if (a < 20) a = 20;
-        SetLayeredWindowAttributes(hwnd_, 0, a, LWA_ALPHA);
-    }
+    if (!hwnd_ || !backDC_) return;
+    // Only the constant alpha changes: with no source DC, UpdateLayeredWindow
+    // keeps the window's current bitmap — no repaint, no pixel upload.
+    BLENDFUNCTION bf = {AC_SRC_OVER, 0, PresentAlpha(), AC_SRC_ALPHA};
+    UpdateLayeredWindow(hwnd_, nullptr, nullptr, nullptr, nullptr, nullptr, 0, &bf, ULW_ALPHA);
+}
+
+void WinOverlay::SetColor(const std::string& color) {
+    if (color == cfg_.color) return;
+    cfg_.color = color;
+    Redraw();   // the frame cache context includes the colour
 }
 
 void WinOverlay::SetEnabled(bool enabled) {
     enabled_ = enabled;
     if (hwnd_) ShowWindow(hwnd_, enabled ? SW_SHOWNOACTIVATE : SW_HIDE);
+    Redraw();
 }
 
 void WinOverlay::SetCoverImage(const std::string& path) {
+    if (path == cfg_.cover_image && (cover_ || path.empty())) return;   // already decoded
+    // Same path with no cover means it failed to decode: drop that too so
+    // it is read again
+    if (images_ && !cfg_.cover_image.empty())
+        images_->Drop(cfg_.cover_image);
     cfg_.cover_image = path;
-    if (coverBmp_) { DeleteObject(coverBmp_); coverBmp_ = nullptr; }
-    if (!path.empty()) {
-        std::wstring wp(path.begin(), path.end());
-        coverBmp_ = (HBITMAP)LoadImageW(nullptr, wp.c_str(), IMAGE_BITMAP,
-                                          cfg_.width, cfg_.height, LR_LOADFROMFILE);
-    }
+    cover_.reset();
+    coverExact_ = false;
+    coverGen_++;
     Redraw();
 }
 
-void WinOverlay::Redraw() { if (hwnd_) InvalidateRect(hwnd_, nullptr, TRUE); }
-void WinOverlay::Show()   { if (hwnd_) ShowWindow(hwnd_, SW_SHOWNOACTIVATE); }
-void WinOverlay::Hide()   { if (hwnd_) ShowWindow(hwnd_, SW_HIDE); }
+void WinOverlay::RefreshStrings() {
+    for (auto& l : labels_) l = LabelMask{};
+    frames_.Invalidate();
+    Redraw();
+}
 
-// ─────── Painting (DOUBLE-BUFFERED) ───────
-void WinOverlay::Paint(HDC hdc, int w, int h) {
-    // ── off-screen buffer ──
-    HDC     memDC  = CreateCompatibleDC(hdc);
-    HBITMAP memBmp = CreateCompatibleBitmap(hdc, w, h);
-    HBITMAP oldBmp = (HBITMAP)SelectObject(memDC, memBmp);
-
-    // ── Background with gradient ──
-    COLORREF bgColor = editMode_ ? RGB(255, 165, 0) : HexToColorRef(cfg_.color);
-
-    if (coverBmp_ && !editMode_) {
-        HDC tmpDC   = CreateCompatibleDC(memDC);
-        HBITMAP old = (HBITMAP)SelectObject(tmpDC, coverBmp_);
-        StretchBlt(memDC, 0, 0, w, h, tmpDC, 0, 0, w, h, SRCCOPY);
-        SelectObject(tmpDC, old);
-        DeleteDC(tmpDC);
-    } else {
-        // Create gradient background
-        RECT rc = {0, 0, w, h};
-        HBRUSH bgBrush = CreateSolidBrush(bgColor);
-        FillRect(memDC, &rc, bgBrush);
-        DeleteObject(bgBrush);
-
-        // Add subtle gradient overlay
-        if (!editMode_) {
-            HBRUSH gradBrush = CreateSolidBrush(RGB(255, 255, 255));
-            RECT topGrad = {0, 0, w, h/3};
-            FillRect(memDC, &topGrad, gradBrush);
-            DeleteObject(gradBrush);
+void WinOverlay::Redraw() {
+    if (!hwnd_) return;
+    const int w = cfg_.width, h = cfg_.height;
+    if (!EnsureBackBuffer(w, h)) return;
+
+    UpdateCover(w, h);
+    ZoneVisualState st = VisualState();
+    frames_.SetContext(w, h, dpi_, st.color, coverGen_);
+
+    FrameKey key;
+    key.mode    = (uint8_t)st.mode;
+    key.edit    = st.editMode;
+    key.locked  = st.locked;
+    key.enabled = st.enabled;
+
+    const Surface* frame = frames_.Find(key);
+    if (!frame) {
+        if (Surface* slot = frames_.Insert(key)) {
+            Paint(*slot, st);
+            frame = slot;
         }
     }
-
-    // ── Mode visuals ──
-    DrawModeVisuals(memDC, w, h);
-
-    // ── Enhanced rounded border with glow ──
-    HPEN   pen      = editMode_ ? editPen_ : borderPen_;
-    HPEN   oldPen   = (HPEN)SelectObject(memDC, pen);
-    HBRUSH nullBrush = (HBRUSH)GetStockObject(NULL_BRUSH);
-    HBRUSH oldBrush  = (HBRUSH)SelectObject(memDC, nullBrush);
-
-    // Draw outer glow
-    if (!editMode_ && enabled_) {
-        HPEN glowPen = CreatePen(PS_SOLID, 4, RGB(59, 130, 246));
-        HPEN oldGlow = (HPEN)SelectObject(memDC, glowPen);
-        RoundRect(memDC, 2, 2, w-2, h-2, 18, 18);
-        SelectObject(memDC, oldGlow);
-        DeleteObject(glowPen);
-    }
-
-    RoundRect(memDC, 0, 0, w, h, 18, 18);
-    SelectObject(memDC, oldPen);
-    SelectObject(memDC, oldBrush);
-
-    // ── Lock indicator ──
-    if (cfg_.locked && !editMode_) {
-        SetBkMode(memDC, TRANSPARENT);
-        SetTextColor(memDC, RGB(255, 255, 255));
-        HFONT old = (HFONT)SelectObject(memDC, fontSmall_);
-        RECT  lockR = {w - 28, 4, w - 4, 24};
-        DrawTextW(memDC, L"🔒", -1, &lockR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-        SelectObject(memDC, old);
-    }
-
-    // ── Edit mode resize grip (3 diagonal dots, Win-style) ──
-    if (editMode_) {
-        DrawResizeGrip(memDC, w, h);
+    const Surface back = BackSurface();
+    if (frame) {
+        for (int y = 0; y < h; y++) std::memcpy(back.Row(y), frame->Row(y), (size_t)w * sizeof(uint32_t));
+    } else {
+        Paint(back, st);   // frame alone exceeds the cache cap
     }
-
-    // ── Blit to screen ──
-    BitBlt(hdc, 0, 0, w, h, memDC, 0, 0, SRCCOPY);
-
-    SelectObject(memDC, oldBmp);
-    DeleteObject(memBmp);
-    DeleteDC(memDC);
+    Present();
 }
+void WinOverlay::Show()   { if (hwnd_) ShowWindow(hwnd_, SW_SHOWNOACTIVATE); }
+void WinOverlay::Hide()   { if (hwnd_) ShowWindow(hwnd_, SW_HIDE); }
 
-void WinOverlay::DrawResizeGrip(HDC hdc, int w, int h) {
-    // Enhanced resize grip with better visual design
-    const int DOT = 4, GAP = 5;
-    HBRUSH wBrush = CreateSolidBrush(RGB(255, 255, 255));
-    HBRUSH dBrush = CreateSolidBrush(RGB(100, 100, 100));
-    HBRUSH sBrush = CreateSolidBrush(RGB(59, 130, 246));
-
-    for (int i = 0; i < 3; i++) {
-        int ox = w - 6 - i * (DOT + GAP);
-        int oy = h - 6 - i * (DOT + GAP);
-
-        // Shadow
-        RECT rS = {ox + 2, oy + 2, ox + DOT + 2, oy + DOT + 2};
-        FillRect(hdc, &rS, dBrush);
+// ─────── Painting (platform-neutral renderer) ───────
+ZoneVisualState WinOverlay::VisualState() const {
+    ZoneVisualState st;
+    st.mode       = mode_;
+    st.editMode   = editMode_;
+    st.enabled    = enabled_;
+    st.locked     = cfg_.locked;
+    COLORREF c    = HexToColorRef(cfg_.color);
+    st.color      = ((uint32_t)GetRValue(c) << 16) | ((uint32_t)GetGValue(c) << 8) | GetBValue(c);
+    return st;
+}
 
-        // Main dot
-        RECT r1 = {ox, oy, ox + DOT, oy + DOT};
-        FillRect(hdc, &r1, wBrush);
+void WinOverlay::Paint(const Surface& dst, const ZoneVisualState& st) {
+    g_renders.Add();
+    Surface cover;
+    if (cover_ && !st.editMode) cover = cover_->View();
+    RenderZone(dst, st, this, cover.pixels ? &cover : nullptr);
+}
 
-        // Accent dot (inner)
-        RECT r2 = {ox + 1, oy + 1, ox + DOT - 1, oy + DOT - 1};
-        FillRect(hdc, &r2, sBrush);
+// Pick the cover for a w × h frame without blocking: the exact variant
+// if the cache has it, else a Fast resample of the closest resident one
+// while the exact variant is made in the background (WM_COVER_READY
+// redraws when it lands).
+void WinOverlay::UpdateCover(int w, int h) {
+    if (cfg_.cover_image.empty() || editMode_) return;
+    if (!images_) {
+        images_ = std::make_unique<ImageCache>(DecodeImageWIC);
+        HWND hwnd = hwnd_;
+        images_->SetReadyCallback([hwnd] { PostMessageW(hwnd, WM_COVER_READY, 0, 0); });
+    }
+    if (cover_ && coverExact_ && cover_->width == w && cover_->height == h) return;
+
+    ImagePtr next = images_->Acquire(cfg_.cover_image, w, h);
+    bool exact = next != nullptr;
+    if (!next) {
+        if (cover_ && cover_->width == w && cover_->height == h) return;   // stand-in already fits
+        if (ImagePtr closest = images_->Closest(cfg_.cover_image, w, h)) {
+            auto img = std::make_shared<Image>();
+            img->width  = w;
+            img->height = h;
+            img->pixels.resize((size_t)w * h);
+            resample::Resize(closest->View(), img->View(), resample::Quality::Fast);
+            next = std::move(img);
+        }
+    }
+    if (next != cover_) {
+        cover_      = std::move(next);
+        coverExact_ = exact;
+        coverGen_++;
     }
-    DeleteObject(wBrush);
-    DeleteObject(dBrush);
-    DeleteObject(sBrush);
 }
 
-void WinOverlay::DrawModeVisuals(HDC hdc, int w, int h) {
-    SetBkMode(hdc, TRANSPARENT);
-
-    // ── Mode 1 (ClickHold): L↑ R↓ label ──
-    if (mode_ == ScrollMode::ClickHold) {
-        HFONT old = (HFONT)SelectObject(hdc, fontBold_);
-        SetTextColor(hdc, RGB(255, 255, 255));
-
-        RECT topR = {0, h / 4, w, h / 2};
-        DrawTextW(hdc, L"\u25B2", -1, &topR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-        RECT botR = {0, h / 2, w, 3 * h / 4};
-        DrawTextW(hdc, L"\u25BC", -1, &botR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-        // Label at bottom with better styling
-        SelectObject(hdc, fontSmall_);
-        SetTextColor(hdc, RGB(220, 220, 220));
-        RECT labelR = {4, h - 22, w - 4, h - 4};
-        DrawTextW(hdc, L"L\u2191  R\u2193", -1, &labelR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-        SelectObject(hdc, old);
-        return;
+// ─────── Drag / resize gesture ───────
+void WinOverlay::BeginGesture() {
+    gesturePending_ = false;
+    if (isResizing_ && backBits_) {
+        gestureFrame_.width  = backW_;
+        gestureFrame_.height = backH_;
+        gestureFrame_.pixels.resize((size_t)backW_ * backH_);
+        const Surface back = BackSurface();
+        for (int y = 0; y < backH_; y++)
+            std::memcpy(gestureFrame_.View().Row(y), back.Row(y), (size_t)backW_ * sizeof(uint32_t));
     }
+    // Frames come from a pacer thread so they follow the display (after
+    // a vblank when DWM composes at its rate). SetTimer is the fallback:
+    // WM_TIMER rounds to the ~15.6 ms system tick, so it caps at ~64 Hz.
+    if (gesturePacer_.IsRunning() || gesturePacer_.Start(hwnd_, WM_GESTURE_FRAME)) {
+        gestureTiming_ = MonitorFrameTiming(hwnd_);
+        gesturePacer_.SetTiming(gestureTiming_);
+        gesturePacer_.Arm(WinFramePacer::Now() + gestureTiming_.period);
+    } else if (!gestureTimer_) {
+        gestureTimer_ = SetTimer(hwnd_, kGestureTimer, FrameIntervalMs(hwnd_), nullptr) != 0;
+    }
+}
 
-    // ── Mode 2 (SplitHold): split line + top/bottom arrows ──
-    if (mode_ == ScrollMode::SplitHold) {
-        HPEN oldPen = (HPEN)SelectObject(hdc, dashPen_);
-        MoveToEx(hdc, 8, h / 2, nullptr);
-        LineTo(hdc, w - 8, h / 2);
-        SelectObject(hdc, oldPen);
-
-        HFONT old = (HFONT)SelectObject(hdc, fontBold_);
-        SetTextColor(hdc, RGB(255, 255, 255));
-
-        RECT topR = {0, 4, w, h / 2 - 2};
-        DrawTextW(hdc, L"\u25B2", -1, &topR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+void WinOverlay::OnGestureFrame() {
+    if (!isDragging_ && !isResizing_) return;   // posted just before the gesture ended
+    ApplyGesture();
+    gesturePacer_.Arm(WinFramePacer::Now() + gestureTiming_.period);
+}
 
-        RECT botR = {0, h / 2 + 4, w, h - 4};
-        DrawTextW(hdc, L"\u25BC", -1, &botR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+void WinOverlay::ApplyGesture() {
+    if (!gesturePending_) return;
+    gesturePending_ = false;
+    const RECT& t = gestureTarget_;
+    cfg_.x = t.left;
+    cfg_.y = t.top;
 
-        SelectObject(hdc, old);
+    if (!isResizing_) {
+        SetWindowPos(hwnd_, nullptr, t.left, t.top, 0, 0,
+                     SWP_NOSIZE | SWP_NOZORDER | SWP_NOACTIVATE | SWP_NOREDRAW);
         return;
     }
 
-    // ── Mode 3 (HoverAuto): color tint top/bottom + arrows ──
-    if (mode_ == ScrollMode::HoverAuto) {
-        RECT topArea = {4, 4,   w - 4, h / 2 - 2};
-        RECT botArea = {4, h / 2 + 2, w - 4, h - 4};
-        FillRect(hdc, &topArea, topBrush_);
-        FillRect(hdc, &botArea, botBrush_);
-
-        // Divider
-        HPEN oldPen = (HPEN)SelectObject(hdc, dashPen_);
-        MoveToEx(hdc, 8, h / 2, nullptr);
-        LineTo(hdc, w - 8, h / 2);
-        SelectObject(hdc, oldPen);
-
-        // Labels with shadow
-        HFONT old = (HFONT)SelectObject(hdc, fontBold_);
-
-        SetTextColor(hdc, RGB(0, 0, 0));
-        RECT topRS = {3, 10, w + 3, h / 2 - 6 + 3};
-        DrawTextW(hdc, L"\u25B2 HOVER", -1, &topRS, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-        RECT botRS = {3, h / 2 + 8 + 3, w + 3, h - 10 + 3};
-        DrawTextW(hdc, L"\u25BC HOVER", -1, &botRS, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-        SetTextColor(hdc, RGB(255, 255, 255));
-        RECT topR = {0, 8,   w, h / 2 - 6};
-        DrawTextW(hdc, L"\u25B2 HOVER", -1, &topR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-        RECT botR = {0, h / 2 + 8, w, h - 10};
-        DrawTextW(hdc, L"\u25BC HOVER", -1, &botR, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+    // Stretch the frame captured at gesture start — cheap enough for
+    // every refresh; the real render happens once on release.
+    int w = t.right - t.left, h = t.bottom - t.top;
+    if (w == backW_ && h == backH_) return;
+    cfg_.width  = w;
+    cfg_.height = h;
+    if (!EnsureBackBuffer(w, h)) return;
+    if (!gestureFrame_.pixels.empty())
+        resample::Resize(gestureFrame_.View(), BackSurface(), resample::Quality::Fast);
+    Present();
+}
 
-        SelectObject(hdc, old);
+void WinOverlay::EndGesture() {
+    if (!isDragging_ && !isResizing_) return;
+    ApplyGesture();
+    bool resized = isResizing_;
+    isDragging_ = false;
+    isResizing_ = false;
+    gesturePacer_.Stop();
+    if (gestureTimer_) { KillTimer(hwnd_, kGestureTimer); gestureTimer_ = false; }
+    gestureFrame_ = Image{};
+    if (resized) Redraw();   // full-quality frame at the final size
+
+    // A plain click on an unlocked zone is a gesture that went nowhere:
+    // nothing to report (the app would rewrite and save the config)
+    const bool changed = resized ? cfg_.width != resizeStartSize_.cx || cfg_.height != resizeStartSize_.cy
+                                 : cfg_.x != dragStartRect_.left || cfg_.y != dragStartRect_.top;
+    if (callback_ && changed) {
+        ZoneEventData d = {};
+        d.event      = resized ? ZoneEvent::ResizeEnd : ZoneEvent::DragMove;
+        d.zoneWidth  = cfg_.width;
+        d.zoneHeight = cfg_.height;
+        d.newX       = cfg_.x;
+        d.newY       = cfg_.y;
+        callback_(d);
     }
 }
 
@@ -326,15 +450,15 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
 
     switch (msg) {
     case WM_PAINT: {
+        // Content is supplied by UpdateLayeredWindow in Present();
+        // just validate the update region.
         PAINTSTRUCT ps;
-        HDC hdc = BeginPaint(hwnd, &ps);
-        RECT rc; GetClientRect(hwnd, &rc);
-        self->Paint(hdc, rc.right, rc.bottom);
+        BeginPaint(hwnd, &ps);
         EndPaint(hwnd, &ps);
         return 0;
     }
     case WM_ERASEBKGND:
-        return 1; // handled in Paint via double-buffer
+        return 1; // nothing to erase — layered content comes from the back buffer
 
     case WM_LBUTTONDOWN: {
         POINT pt = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam)};
@@ -345,6 +469,8 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
             if (pt.x > rc.right - 20 && pt.y > rc.bottom - 20) {
                 self->isResizing_ = true;
                 self->resizeStart_ = pt;
+                self->resizeStartSize_ = {rc.right, rc.bottom};
+                self->BeginGesture();
                 SetCapture(hwnd);
                 return 0;
             }
@@ -355,6 +481,7 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
             self->isDragging_ = true;
             self->dragStart_  = pt;
             GetWindowRect(hwnd, &self->dragStartRect_);
+            self->BeginGesture();
             SetCapture(hwnd);
         }
 
@@ -371,8 +498,7 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
 
     case WM_LBUTTONUP: {
         if (self->isDragging_ || self->isResizing_) {
-            self->isDragging_  = false;
-            self->isResizing_  = false;
+            self->EndGesture();
             ReleaseCapture();
         }
         if (self->callback_ && self->enabled_ && !self->editMode_) {
@@ -413,27 +539,20 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
     case WM_MOUSEMOVE: {
         POINT pt = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam)};
 
+        // Only record where the window should be; ApplyGesture() shows it
+        // on the next refresh tick, however many moves arrive before then.
         if (self->isResizing_) {
-            int dw = pt.x - self->resizeStart_.x;
-            int dh = pt.y - self->resizeStart_.y;
-            RECT wr; GetWindowRect(hwnd, &wr);
-            int nw = (std::max)(60, int(wr.right - wr.left) + dw);
-            int nh = (std::max)(60, int(wr.bottom - wr.top) + dh);
-
-            self->resizeStart_ = pt;
-            self->cfg_.width  = nw;
-            self->cfg_.height = nh;
-            SetWindowPos(hwnd, nullptr, 0, 0, nw, nh,
-                         SWP_NOMOVE | SWP_NOZORDER | SWP_NOACTIVATE);
-            self->Redraw();
+            int nw = (std::max)(60, int(self->resizeStartSize_.cx + pt.x - self->resizeStart_.x));
+            int nh = (std::max)(60, int(self->resizeStartSize_.cy + pt.y - self->resizeStart_.y));
+            self->gestureTarget_  = {self->cfg_.x, self->cfg_.y, self->cfg_.x + nw, self->cfg_.y + nh};
+            self->gesturePending_ = true;
         } else if (self->isDragging_) {
             POINT screenPt = pt;
             ClientToScreen(hwnd, &screenPt);
             int nx = screenPt.x - self->dragStart_.x;
             int ny = screenPt.y - self->dragStart_.y;
-            self->cfg_.x = nx; self->cfg_.y = ny;
-            SetWindowPos(hwnd, nullptr, nx, ny, 0, 0,
-                         SWP_NOSIZE | SWP_NOZORDER | SWP_NOACTIVATE);
+            self->gestureTarget_  = {nx, ny, nx + self->cfg_.width, ny + self->cfg_.height};
+            self->gesturePending_ = true;
         }
 
         // Cursor styling in edit mode
@@ -472,6 +591,29 @@ LRESULT CALLBACK WinOverlay::WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
         return 0;
     }
 
+    case WM_TIMER:
+        if (wParam == kGestureTimer) { self->ApplyGesture(); return 0; }
+        return DefWindowProcW(hwnd, msg, wParam, lParam);
+
+    case WM_CAPTURECHANGED:
+        self->EndGesture();   // capture stolen mid-gesture (Alt+Tab, another window)
+        return 0;
+
+    case WM_GESTURE_FRAME:
+        self->OnGestureFrame();
+        return 0;
+
+    case WM_COVER_READY:
+        if (!self->isResizing_) self->Redraw();   // EndGesture() redraws anyway
+        return 0;
+
+    case WM_DPICHANGED:
+        // Fonts (and with them the label masks and every cached frame) are DPI-specific
+        self->dpi_ = HIWORD(wParam);
+        self->DestroyGDI();   // rebuilt lazily by the next Label()
+        self->Redraw();
+        return 0;
+
     case WM_CONTEXTMENU:
         return 0; // suppress right-click context menu
 
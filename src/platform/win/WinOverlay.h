@@ -1,8 +1,15 @@
 #pragma once
 #include <windows.h>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <functional>
+#include <memory>
 #include "../../core/Config.h"
+#include "../../core/ZoneRenderer.h"
+#include "../../core/FrameCache.h"
+#include "../../core/ImageCache.h"
+#include "WinFramePacer.h"
 
 namespace sn {
 
@@ -12,8 +19,8 @@ enum class ZoneEvent {
     LeftClickUp,
     RightClickDown,
     RightClickUp,
-    DragMove,
-    ResizeEnd,
+    DragMove,     // drag released: newX/newY hold the final position
+    ResizeEnd,    // resize released: final position and zoneWidth/zoneHeight
     HoverMove,    // mouse moved inside zone (for Mode 3)
     HoverLeave,   // mouse left zone (for Mode 3)
     Closed
@@ -29,7 +36,7 @@ struct ZoneEventData {
 
 using ZoneEventCallback = std::function<void(const ZoneEventData&)>;
 
-class WinOverlay {
+class WinOverlay : private ZoneLabelSource {
 public:
     bool Create(HINSTANCE hInst, const ZoneConfig& cfg, ZoneEventCallback cb);
     void Destroy();
@@ -40,8 +47,10 @@ public:
     void SetEditMode(bool edit);
     void SetScrollMode(ScrollMode mode);
     void SetOpacity(double alpha);
+    void SetColor(const std::string& color);
     void SetEnabled(bool enabled);
     void SetCoverImage(const std::string& path);
+    void RefreshStrings();   // UI language changed: re-shape the labels
 
     void Redraw();
     void Show();
@@ -52,9 +61,32 @@ public:
 
 private:
     static LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
-    void Paint(HDC hdc, int w, int h);
-    void DrawModeVisuals(HDC hdc, int w, int h);
-    void DrawResizeGrip(HDC hdc, int w, int h);
+    ZoneVisualState VisualState() const;
+    void Paint(const Surface& dst, const ZoneVisualState& st);
+    void UpdateCover(int w, int h);
+
+    // ── Drag / resize gesture ──
+    // Mouse moves only record the target geometry; ApplyGesture() runs
+    // once per display refresh (gesturePacer_; a SetTimer fallback is
+    // limited to the ~15.6 ms system tick) and EndGesture() does the
+    // final render.
+    void BeginGesture();
+    void ApplyGesture();
+    void OnGestureFrame();
+    void EndGesture();
+
+    // ZoneLabelSource: text rendered once per label via GDI into an 8-bit mask
+    const CoverageMask* Label(ZoneLabel id) override;
+
+    // ── Persistent back buffer (32-bit premultiplied BGRA DIB section) ──
+    // The DC lives as long as the window; the bitmap only ever grows and
+    // frames use its top-left backW_ × backH_. Presented with
+    // UpdateLayeredWindow so every pixel carries its own alpha.
+    bool EnsureBackBuffer(int w, int h);
+    void ReleaseBackBuffer();
+    Surface BackSurface() const { return Surface{backBits_, backW_, backH_, backCapW_}; }
+    void Present();
+    BYTE PresentAlpha() const;   // constant alpha from cfg_.opacity (never fully invisible)
 
     // ── Cached GDI objects (no per-frame alloc) ──
     void InitGDI();
@@ -70,22 +102,48 @@ private:
     RECT  dragStartRect_ = {};
     bool isResizing_ = false;
     POINT resizeStart_ = {};
+    SIZE  resizeStartSize_ = {};
+    WinFramePacer gesturePacer_;     // runs only during a gesture
+    FrameTiming   gestureTiming_;    // of the monitor the gesture started on
+    bool  gestureTimer_ = false;     // SetTimer fallback running
+    bool  gesturePending_ = false;   // target geometry not applied yet
+    RECT  gestureTarget_ = {};       // screen rect to show on the next tick
+    Image gestureFrame_;             // frame at gesture start, rescaled while resizing
     bool mouseTracking_ = false;
+    UINT dpi_ = USER_DEFAULT_SCREEN_DPI;
+
+    // Rendered frames per visual state; Redraw() is a copy on a hit
+    FrameCache frames_;
+    uint64_t   coverGen_ = 0;   // bumped whenever the cover image changes
 
     ZoneEventCallback callback_;
-    HBITMAP coverBmp_ = nullptr;
+
+    // ── Cover image ──
+    // Decoded and resampled off-thread by images_; the UI thread only
+    // picks up finished variants (or a quick stand-in while one is made).
+    std::unique_ptr<ImageCache> images_;
+    ImagePtr cover_;               // scaled to the current zone size
+    bool     coverExact_ = false;  // false = Fast stand-in, exact variant pending
+
+    HDC       backDC_   = nullptr;
+    HBITMAP   backBmp_  = nullptr;
+    HBITMAP   backOld_  = nullptr;
+    uint32_t* backBits_ = nullptr;  // top-down, backCapW_ pixels per row
+    int       backW_    = 0;        // current frame
+    int       backH_    = 0;
+    int       backCapW_ = 0;        // bitmap size
+    int       backCapH_ = 0;
 
     // ── Cached GDI objects (no per-frame alloc) ──
-    HFONT   fontBold_   = nullptr;  // 16pt Segoe UI Bold
-    HFONT   fontSmall_  = nullptr;  // 11pt Segoe UI
-    HPEN    borderPen_  = nullptr;  // 2px white
-    HPEN    editPen_    = nullptr;  // 3px orange
-    HPEN    dashPen_    = nullptr;  // 1px dashed white
-    HPEN    glowPen_    = nullptr;  // 1px blue glow
-    HBRUSH  topBrush_   = nullptr;  // Mode 3 top tint (blue)
-    HBRUSH  botBrush_   = nullptr;  // Mode 3 bottom tint (red)
-    HBRUSH  editBrush_  = nullptr;  // edit mode background tint
-    HBRUSH  hoverBrush_ = nullptr;  // hover state brush
+    HFONT   fontBold_   = nullptr;  // 14px @96dpi Segoe UI Bold (grayscale AA for masks)
+    HFONT   fontSmall_  = nullptr;  // 10px @96dpi Segoe UI
+
+    struct LabelMask {
+        std::vector<uint8_t> bits;
+        CoverageMask mask;
+        bool built = false;
+    };
+    LabelMask labels_[(int)ZoneLabel::Count];
 };
 
 } // namespace sn
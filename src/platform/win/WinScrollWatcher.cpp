@@ -0,0 +1,36 @@
+#include "WinScrollWatcher.h"
+
+namespace sn {
+
+WinScrollWatcher& WinScrollWatcher::Instance() {
+    static WinScrollWatcher inst;
+    return inst;
+}
+
+void WinScrollWatcher::Watch(DWORD pid) {
+    if (pid == pid_) return;
+    if (scrollingHook_) UnhookWinEvent(scrollingHook_);
+    if (valueHook_) UnhookWinEvent(valueHook_);
+    scrollingHook_ = valueHook_ = nullptr;
+    pid_ = pid;
+    if (!pid) return;
+    scrollingHook_ = SetWinEventHook(EVENT_SYSTEM_SCROLLINGSTART, EVENT_SYSTEM_SCROLLINGEND, nullptr,
+                                     WinEventProc, pid, 0, WINEVENT_OUTOFCONTEXT);
+    valueHook_ = SetWinEventHook(EVENT_OBJECT_VALUECHANGE, EVENT_OBJECT_VALUECHANGE, nullptr,
+                                 WinEventProc, pid, 0, WINEVENT_OUTOFCONTEXT);
+}
+
+void CALLBACK WinScrollWatcher::WinEventProc(HWINEVENTHOOK, DWORD event, HWND hwnd,
+                                             LONG idObject, LONG, DWORD, DWORD) {
+    // Value changes come from every edit box and slider too: keep the
+    // window's own vertical scroll bar and scroll bar controls
+    if (event == EVENT_OBJECT_VALUECHANGE && idObject != OBJID_VSCROLL) {
+        if (idObject != OBJID_CLIENT || !hwnd) return;
+        wchar_t cls[16];
+        if (!GetClassNameW(hwnd, cls, 16) || lstrcmpiW(cls, L"ScrollBar") != 0) return;
+    }
+    auto& self = Instance();
+    if (self.callback_) self.callback_(hwnd, idObject);
+}
+
+} // namespace sn
@@ -0,0 +1,37 @@
+#pragma once
+#include <windows.h>
+#include <functional>
+
+namespace sn {
+
+// `hwnd` and `idObject` name what scrolled: OBJID_VSCROLL for a
+// window's own scroll bar, OBJID_CLIENT for a scroll bar control.
+using ScrollNotifyCallback = std::function<void(HWND hwnd, LONG idObject)>;
+
+// Reports scroll-position changes in one process through out-of-context
+// WinEvent hooks: EVENT_SYSTEM_SCROLLINGSTART/END and value changes of
+// standard vertical scroll bars. The hooks are filtered to the watched
+// process by the system, so other apps cost nothing. The callback runs
+// on the thread that called Watch(), from its message loop.
+class WinScrollWatcher {
+public:
+    static WinScrollWatcher& Instance();
+
+    void SetCallback(ScrollNotifyCallback cb) { callback_ = std::move(cb); }
+
+    // Watch `pid` (0: stop). Cheap when the pid is unchanged.
+    void Watch(DWORD pid);
+    void Uninstall() { Watch(0); }
+
+private:
+    WinScrollWatcher() = default;
+    static void CALLBACK WinEventProc(HWINEVENTHOOK hook, DWORD event, HWND hwnd,
+                                      LONG idObject, LONG idChild, DWORD thread, DWORD time);
+
+    HWINEVENTHOOK        scrollingHook_ = nullptr;
+    HWINEVENTHOOK        valueHook_     = nullptr;
+    DWORD                pid_ = 0;
+    ScrollNotifyCallback callback_;
+};
+
+} // namespace sn
@@ -1,4 +1,5 @@
 #include "WinSettings.h"
+#include "WinGdiPool.h"
 #include <commctrl.h>
 #include <sstream>
 
@@ -59,11 +60,12 @@ void WinSettings::Show(HINSTANCE hInst, HWND parent, AppConfig& cfg, SettingsCal
     onSave_    = onSave;
     hInst_     = hInst;
 
-    hBrushBg      = CreateSolidBrush(CLR_BG);
-    hBrushSurface = CreateSolidBrush(CLR_SURFACE);
+    hBrushBg      = GdiPool::Instance().AcquireBrush(CLR_BG);
+    hBrushSurface = GdiPool::Instance().AcquireBrush(CLR_SURFACE);
 
     // Get DPI for scaling
     UINT dpi = GetDpiForWindow(parent ? parent : GetDesktopWindow());
+    dpi_ = dpi;
     int scale = (dpi == 0) ? 100 : dpi;
     float scaleFactor = scale / 96.0f;
 
@@ -111,9 +113,11 @@ void WinSettings::Show(HINSTANCE hInst, HWND parent, AppConfig& cfg, SettingsCal
     SetForegroundWindow(parent);
     (void)threadId; // used in lambda captures below via PostThreadMessage
 
-    if (hBrushBg)      { DeleteObject(hBrushBg);      hBrushBg      = nullptr; }
-    if (hBrushSurface) { DeleteObject(hBrushSurface); hBrushSurface = nullptr; }
-    if (hFont_)        { DeleteObject(hFont_);        hFont_        = nullptr; }
+    GdiPool& gdi = GdiPool::Instance();
+    gdi.Release(hBrushBg);      hBrushBg      = nullptr;
+    gdi.Release(hBrushSurface); hBrushSurface = nullptr;
+    gdi.Release(hFont_);        hFont_        = nullptr;
+    gdi.Trim();   // the dialog is closed; nothing else uses its palette
 }
 
 // ─── InitControls ───
@@ -129,12 +133,7 @@ void WinSettings::InitControls(HWND dlg) {
     InvalidateRect(dlg, nullptr, TRUE);
 
     // Bold font for the dialog (scaled by DPI)
-    if (!hFont_) {
-        int fontSize = (int)(14 * scaleFactor_);
-        hFont_ = CreateFontW(fontSize, 0, 0, 0, FW_NORMAL, 0, 0, 0,
-                               DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-                               CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Segoe UI");
-    }
+    if (!hFont_) hFont_ = GdiPool::Instance().AcquireFont({L"Segoe UI", 14, FW_NORMAL}, dpi_);
     SendMessage(dlg, WM_SETFONT, (WPARAM)hFont_, TRUE);
 
     int y = 10, PW = 364;
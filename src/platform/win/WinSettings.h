@@ -23,7 +23,8 @@ private:
     HWND             dlg_    = nullptr;
     HINSTANCE        hInst_  = nullptr;  // needed for child control creation
     bool             done_   = false;    // modal loop exit flag
-    HFONT            hFont_  = nullptr;  // dialog font (owned)
+    HFONT            hFont_  = nullptr;  // dialog font (pooled)
+    UINT             dpi_    = USER_DEFAULT_SCREEN_DPI;
     float            scaleFactor_ = 1.0f;  // DPI scaling factor
 };
 
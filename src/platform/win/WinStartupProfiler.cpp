@@ -0,0 +1,58 @@
+#include "WinStartupProfiler.h"
+#include <psapi.h>
+#include <cwchar>
+
+namespace sn {
+
+StartupProfiler::StartupProfiler() {
+    QueryPerformanceFrequency(&freq_);
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    origin_ = now.QuadPart;
+
+    // Back-date the origin to process creation using the wall clock.
+    FILETIME created, exited, kernel, user, nowFt;
+    if (GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+        GetSystemTimePreciseAsFileTime(&nowFt);
+        ULARGE_INTEGER c = {{created.dwLowDateTime, created.dwHighDateTime}};
+        ULARGE_INTEGER n = {{nowFt.dwLowDateTime, nowFt.dwHighDateTime}};
+        if (n.QuadPart > c.QuadPart)   // 100 ns units
+            origin_ -= (LONGLONG)((n.QuadPart - c.QuadPart) * freq_.QuadPart / 10000000ULL);
+    }
+    Mark(L"process start -> WinMain");
+}
+
+SIZE_T StartupProfiler::WorkingSet() {
+    PROCESS_MEMORY_COUNTERS pmc = {};
+    pmc.cb = sizeof(pmc);
+    return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? pmc.WorkingSetSize : 0;
+}
+
+void StartupProfiler::Mark(const wchar_t* phase) {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    phases_.push_back({phase, now.QuadPart, WorkingSet(),
+                       GetGuiResources(GetCurrentProcess(), GR_GDIOBJECTS)});
+}
+
+void StartupProfiler::Report() const {
+    auto ms = [this](LONGLONG ticks) { return ticks * 1000.0 / (double)freq_.QuadPart; };
+    wchar_t buf[256];
+    OutputDebugStringW(L"ScrollNice startup:\n");
+    LONGLONG prev = origin_;
+    for (const auto& p : phases_) {
+        swprintf_s(buf, L"  %-32ls %8.2f ms  (+%7.2f)  ws %6zu KB  gdi %zu\n",
+                   p.name, ms(p.qpc - origin_), ms(p.qpc - prev), p.workingSet / 1024, p.gdiObjects);
+        OutputDebugStringW(buf);
+        prev = p.qpc;
+    }
+    if (!phases_.empty()) {
+        const Phase& first = phases_.front();
+        const Phase& last  = phases_.back();
+        swprintf_s(buf, L"  cold start %.2f ms, working set %zu KB -> %zu KB\n",
+                   ms(last.qpc - origin_), first.workingSet / 1024, last.workingSet / 1024);
+        OutputDebugStringW(buf);
+    }
+}
+
+} // namespace sn
@@ -0,0 +1,37 @@
+#pragma once
+#include <windows.h>
+#include <vector>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// StartupProfiler — timing and memory of each startup phase
+//
+// Mark() records a QueryPerformanceCounter timestamp and the working
+// set at the end of a phase. Report() writes the table to the debug
+// output, measuring from process creation (so loader/CRT time is
+// included in the cold-start figure), not from WinMain.
+// ─────────────────────────────────────────────────────────
+class StartupProfiler {
+public:
+    StartupProfiler();
+
+    void Mark(const wchar_t* phase);   // phase names must be string literals
+    void Report() const;
+
+private:
+    struct Phase {
+        const wchar_t* name;
+        LONGLONG       qpc;
+        SIZE_T         workingSet;
+        SIZE_T         gdiObjects;
+    };
+
+    static SIZE_T WorkingSet();
+
+    LARGE_INTEGER      freq_   = {};
+    LONGLONG           origin_ = 0;   // process creation, in QPC ticks
+    std::vector<Phase> phases_;
+};
+
+} // namespace sn
@@ -0,0 +1,31 @@
+#include "WinStrings.h"
+#include "../../core/StringCatalog.h"
+#include <windows.h>
+#include <filesystem>
+
+namespace sn {
+
+static_assert(sizeof(wchar_t) == sizeof(char16_t), "catalog values are used as UTF-16 LPCWSTR");
+
+static StringCatalog g_catalog;
+
+bool SetLanguage(const std::string& lang) {
+    wchar_t exe[MAX_PATH];
+    GetModuleFileNameW(nullptr, exe, MAX_PATH);
+    std::filesystem::path path = std::filesystem::path(exe).parent_path() / L"locales" /
+                                 (std::filesystem::u8path(lang).wstring() + L".catalog");
+    // UTF-8, not path.string(): that converts to the ANSI code page and
+    // throws for an exe folder outside it (e.g. a Vietnamese user name)
+    if (g_catalog.Open(path.u8string())) return true;
+
+    std::string line = "ScrollNice: no string catalog for language \"" + lang + "\"; using English\n";
+    OutputDebugStringA(line.c_str());
+    return false;
+}
+
+const wchar_t* Tr(const char* key, const wchar_t* english) {
+    const char16_t* s = g_catalog.Find(key);
+    return s ? reinterpret_cast<const wchar_t*>(s) : english;
+}
+
+} // namespace sn
@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// UI strings — the current language's catalog (StringCatalog.h),
+// mapped from locales/<lang>.catalog next to the exe.
+//
+// Tr() returns the catalog's string or, if the key or the whole
+// catalog is missing, the English literal passed in, so the UI always
+// has text. Returned pointers are valid until the next SetLanguage():
+// use them right away (SetWindowTextW, menus, tooltips all copy).
+// ─────────────────────────────────────────────────────────
+
+// Map the catalog for `lang` (e.g. "vi"); false if it isn't there, in
+// which case Tr() falls back to English. Switching only remaps a file.
+bool SetLanguage(const std::string& lang);
+
+const wchar_t* Tr(const char* key, const wchar_t* english);
+
+} // namespace sn
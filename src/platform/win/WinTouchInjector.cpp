@@ -0,0 +1,51 @@
+#include "WinTouchInjector.h"
+
+namespace sn {
+
+bool WinTouchInjector::Start() {
+    if (started_) return device_ != nullptr;
+    started_ = true;
+    HMODULE user32 = GetModuleHandleW(L"user32.dll");
+    auto create = reinterpret_cast<CreateFn>(GetProcAddress(user32, "CreateSyntheticPointerDevice"));
+    inject_  = reinterpret_cast<InjectFn>(GetProcAddress(user32, "InjectSyntheticPointerInput"));
+    destroy_ = reinterpret_cast<DestroyFn>(GetProcAddress(user32, "DestroySyntheticPointerDevice"));
+    if (!create || !inject_ || !destroy_) return false;
+    device_ = create(PT_TOUCH, 1, POINTER_FEEDBACK_NONE);
+    if (!device_) OutputDebugStringA("ScrollNice: touch injection unavailable\n");
+    return device_ != nullptr;
+}
+
+void WinTouchInjector::Shutdown() {
+    if (device_) destroy_(device_);
+    device_  = nullptr;
+    started_ = false;
+}
+
+bool WinTouchInjector::Inject(const PanContact& contact) {
+    if (!Start()) return false;
+
+    POINTER_TYPE_INFO info = {};
+    info.type = PT_TOUCH;
+    POINTER_TOUCH_INFO& touch = info.touchInfo;
+    touch.pointerInfo.pointerType     = PT_TOUCH;
+    touch.pointerInfo.pointerId       = 0;
+    touch.pointerInfo.ptPixelLocation = {contact.x, contact.y};
+    switch (contact.phase) {
+    case PanPhase::Down:
+        touch.pointerInfo.pointerFlags = POINTER_FLAG_DOWN | POINTER_FLAG_INRANGE | POINTER_FLAG_INCONTACT;
+        break;
+    case PanPhase::Move:
+        touch.pointerInfo.pointerFlags = POINTER_FLAG_UPDATE | POINTER_FLAG_INRANGE | POINTER_FLAG_INCONTACT;
+        break;
+    case PanPhase::Up:
+        touch.pointerInfo.pointerFlags = POINTER_FLAG_UP;
+        break;
+    }
+    // A fingertip-sized contact; some surfaces ignore zero-area touches
+    touch.touchFlags   = TOUCH_FLAG_NONE;
+    touch.touchMask    = TOUCH_MASK_CONTACTAREA;
+    touch.rcContact    = {contact.x - 2, contact.y - 2, contact.x + 2, contact.y + 2};
+    return inject_(device_, &info, 1) != FALSE;
+}
+
+} // namespace sn
@@ -0,0 +1,31 @@
+#pragma once
+#include <windows.h>
+#include "../../core/PanGesture.h"
+
+namespace sn {
+
+// One synthetic touch contact through the pointer injection API
+// (CreateSyntheticPointerDevice, Windows 10 1809+). The functions are
+// looked up at first use, so older systems just report failure and
+// the scroll falls back to wheel events. No visual feedback is drawn.
+class WinTouchInjector {
+public:
+    ~WinTouchInjector() { Shutdown(); }
+
+    bool Inject(const PanContact& contact);
+    void Shutdown();
+
+private:
+    bool Start();
+
+    using CreateFn  = HSYNTHETICPOINTERDEVICE(WINAPI*)(POINTER_INPUT_TYPE, ULONG, POINTER_FEEDBACK_MODE);
+    using InjectFn  = BOOL(WINAPI*)(HSYNTHETICPOINTERDEVICE, const POINTER_TYPE_INFO*, UINT32);
+    using DestroyFn = void(WINAPI*)(HSYNTHETICPOINTERDEVICE);
+
+    bool                    started_ = false;
+    HSYNTHETICPOINTERDEVICE device_  = nullptr;
+    InjectFn                inject_  = nullptr;
+    DestroyFn               destroy_ = nullptr;
+};
+
+} // namespace sn
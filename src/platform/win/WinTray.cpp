@@ -1,4 +1,5 @@
 #include "WinTray.h"
+#include "WinStrings.h"
 
 namespace sn {
 
@@ -17,17 +18,19 @@ bool WinTray::Create(HWND parentHwnd, HINSTANCE hInst, MenuCallback cb) {
     // Passing app hInst here returns nullptr -> Shell_NotifyIconW fails silently.
     nid_.hIcon = LoadIcon(nullptr, IDI_APPLICATION);
 
-    wcscpy_s(nid_.szTip, L"ScrollNice - Disabled (Ctrl+Alt+S)");
+    wcsncpy_s(nid_.szTip, Tr("tray.tip_disabled", L"ScrollNice - Disabled (Ctrl+Alt+S)"),
+              ARRAYSIZE(nid_.szTip) - 1);
 
     bool ok = Shell_NotifyIconW(NIM_ADD, &nid_) == TRUE;
 
     if (ok) {
         // Show startup balloon to guide first-time users
         ShowBalloon(
-            L"🖱️ ScrollNice is running",
-            L"Press Ctrl+Alt+S to toggle the scroll zone.\n"
-            L"Double-click this icon for settings.\n"
-            L"Right-click for quick options.",
+            Tr("tray.balloon_title", L"🖱️ ScrollNice is running"),
+            Tr("tray.balloon_text",
+               L"Press Ctrl+Alt+S to toggle the scroll zone.\n"
+               L"Double-click this icon for settings.\n"
+               L"Right-click for quick options."),
             NIIF_INFO
         );
     }
@@ -51,14 +54,16 @@ void WinTray::SetModeName(const std::string& mode) {
 void WinTray::UpdateTooltip() {
     std::wstring tip = L"🖱️ ScrollNice";
 
-    if (!modeName_.empty()) {
-        if      (modeName_ == "click_hold") tip += L" - Mode 1: Click/Hold";
-        else if (modeName_ == "split_hold") tip += L" - Mode 2: Top/Bottom";
-        else if (modeName_ == "hover_auto") tip += L" - Mode 3: Hover Auto";
-    }
+    const wchar_t* mode = nullptr;
+    if      (modeName_ == "click_hold") mode = Tr("tray.mode_click_hold", L"Mode 1: Click/Hold");
+    else if (modeName_ == "split_hold") mode = Tr("tray.mode_split_hold", L"Mode 2: Top/Bottom");
+    else if (modeName_ == "hover_auto") mode = Tr("tray.mode_hover_auto", L"Mode 3: Hover Auto");
+    if (mode) { tip += L" - "; tip += mode; }
 
-    tip += enabled_ ? L" | ✓ ON" : L" | ✗ OFF";
-    tip += L"\nDouble-click: Settings | Right-click: Menu";
+    tip += L" | ";
+    tip += enabled_ ? Tr("tray.on", L"✓ ON") : Tr("tray.off", L"✗ OFF");
+    tip += L"\n";
+    tip += Tr("tray.tip_hint", L"Double-click: Settings | Right-click: Menu");
 
     wcsncpy_s(nid_.szTip, tip.c_str(), 127);
     nid_.uFlags = NIF_TIP;
@@ -104,11 +109,12 @@ void WinTray::ShowContextMenu() {
     HMENU hMenu = CreatePopupMenu();
 
     // Add menu items with better styling
-    AppendMenuW(hMenu, MF_STRING,    ID_TOGGLE,   enabled_ ? L"✓ Disable Zone" : L"✗ Enable Zone");
-    AppendMenuW(hMenu, MF_STRING,    ID_EDIT,     L"✏️ Edit Mode (move/resize)");
-    AppendMenuW(hMenu, MF_STRING,    ID_SETTINGS, L"⚙️ Settings...");
+    AppendMenuW(hMenu, MF_STRING,    ID_TOGGLE,   enabled_ ? Tr("tray.disable_zone", L"✓ Disable Zone")
+                                                          : Tr("tray.enable_zone", L"✗ Enable Zone"));
+    AppendMenuW(hMenu, MF_STRING,    ID_EDIT,     Tr("tray.edit_mode", L"✏️ Edit Mode (move/resize)"));
+    AppendMenuW(hMenu, MF_STRING,    ID_SETTINGS, Tr("tray.settings", L"⚙️ Settings..."));
     AppendMenuW(hMenu, MF_SEPARATOR, 0, nullptr);
-    AppendMenuW(hMenu, MF_STRING,    ID_QUIT,     L"❌ Quit ScrollNice");
+    AppendMenuW(hMenu, MF_STRING,    ID_QUIT,     Tr("tray.quit", L"❌ Quit ScrollNice"));
 
     POINT pt;
     GetCursorPos(&pt);
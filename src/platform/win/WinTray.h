@@ -34,6 +34,10 @@ public:
     // Update tooltip with current scroll mode name (e.g. "click_hold")
     void SetModeName(const std::string& mode);
 
+    // Re-read the tooltip text after a language change (the menu is
+    // built fresh each time it opens)
+    void RefreshStrings() { UpdateTooltip(); }
+
     // Show a balloon notification (shown on startup to guide first-time users)
     void ShowBalloon(const wchar_t* title, const wchar_t* text,
                      DWORD icon = NIIF_INFO, UINT timeoutMs = 4000);
@@ -0,0 +1,118 @@
+#include "WinUiaScroll.h"
+
+using Microsoft::WRL::ComPtr;
+
+namespace sn {
+
+namespace {
+
+class UiaScrollSurface : public ScrollSurface {
+public:
+    UiaScrollSurface(ComPtr<IUIAutomationElement> element, ComPtr<IUIAutomationScrollPattern> pattern)
+        : element_(std::move(element)), pattern_(std::move(pattern)) {}
+
+    bool Query(ScrollMetrics& m) override {
+        BOOL   scrollable = FALSE;
+        double percent = 0.0, view = 100.0;
+        RECT   r{};
+        if (FAILED(pattern_->get_CurrentVerticallyScrollable(&scrollable)) ||
+            FAILED(pattern_->get_CurrentVerticalScrollPercent(&percent)) ||
+            FAILED(pattern_->get_CurrentVerticalViewSize(&view)) ||
+            FAILED(element_->get_CurrentBoundingRectangle(&r)))
+            return false;
+        // UIA_ScrollPatternNoScroll (-1) when it can't scroll right now
+        m.percent    = percent;
+        m.viewSize   = scrollable ? view : 100.0;
+        m.viewportPx = (double)(r.bottom - r.top);
+        return true;
+    }
+
+    bool SetPercent(double percent) override {
+        return SUCCEEDED(pattern_->SetScrollPercent(UIA_ScrollPatternNoScroll, percent));
+    }
+
+private:
+    ComPtr<IUIAutomationElement>       element_;
+    ComPtr<IUIAutomationScrollPattern> pattern_;
+};
+
+ComPtr<IUIAutomationScrollPattern> VerticalScrollPattern(IUIAutomationElement* element) {
+    ComPtr<IUIAutomationScrollPattern> pattern;
+    BOOL scrollable = FALSE;
+    if (FAILED(element->GetCurrentPatternAs(UIA_ScrollPatternId, IID_PPV_ARGS(&pattern))) || !pattern ||
+        FAILED(pattern->get_CurrentVerticallyScrollable(&scrollable)) || !scrollable)
+        return nullptr;
+    return pattern;
+}
+
+VARIANT BoolVariant(bool value) {
+    VARIANT v;
+    VariantInit(&v);
+    v.vt      = VT_BOOL;
+    v.boolVal = value ? VARIANT_TRUE : VARIANT_FALSE;
+    return v;
+}
+
+} // namespace
+
+bool WinUiaScrollProvider::Start() {
+    if (started_) return uia_ != nullptr;
+    started_ = true;
+    const HRESULT init = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+    comInit_ = SUCCEEDED(init);
+    if (FAILED(init) && init != RPC_E_CHANGED_MODE) return false;
+    if (FAILED(CoCreateInstance(__uuidof(CUIAutomation), nullptr, CLSCTX_INPROC_SERVER,
+                                IID_PPV_ARGS(&uia_)))) {
+        Shutdown();
+        return false;
+    }
+    // Windows 8+: don't let a hung target stall the UI thread for the
+    // default 20 s
+    ComPtr<IUIAutomation2> uia2;
+    if (SUCCEEDED(uia_.As(&uia2))) {
+        uia2->put_ConnectionTimeout(500);
+        uia2->put_TransactionTimeout(200);
+    }
+
+    ComPtr<IUIAutomationCondition> hasPattern, vertical;
+    if (FAILED(uia_->CreatePropertyCondition(UIA_IsScrollPatternAvailablePropertyId, BoolVariant(true),
+                                             &hasPattern)) ||
+        FAILED(uia_->CreatePropertyCondition(UIA_ScrollVerticallyScrollablePropertyId, BoolVariant(true),
+                                             &vertical)) ||
+        FAILED(uia_->CreateAndCondition(hasPattern.Get(), vertical.Get(), &scrollable_))) {
+        Shutdown();
+        return false;
+    }
+    return true;
+}
+
+void WinUiaScrollProvider::Shutdown() {
+    scrollable_.Reset();
+    uia_.Reset();
+    if (comInit_) {
+        CoUninitialize();
+        comInit_ = false;
+    }
+}
+
+std::unique_ptr<ScrollSurface> WinUiaScrollProvider::Resolve(ScrollTarget target) {
+    if (!Start()) return nullptr;
+    ComPtr<IUIAutomationElement> element;
+    if (FAILED(uia_->ElementFromHandle(reinterpret_cast<UIA_HWND>(target), &element)) || !element)
+        return nullptr;
+
+    ComPtr<IUIAutomationScrollPattern> pattern = VerticalScrollPattern(element.Get());
+    if (!pattern) {
+        // Frameworks that draw their own controls (WPF, Chromium, Office)
+        // put the scroller further down the tree
+        ComPtr<IUIAutomationElement> inner;
+        if (FAILED(element->FindFirst(TreeScope_Descendants, scrollable_.Get(), &inner)) || !inner)
+            return nullptr;
+        pattern = VerticalScrollPattern(inner.Get());
+        if (!pattern) return nullptr;
+        element = inner;
+    }
+    return std::make_unique<UiaScrollSurface>(std::move(element), std::move(pattern));
+}
+
+} // namespace sn
@@ -0,0 +1,35 @@
+#pragma once
+#include "../../core/ScrollBackend.h"
+#include <windows.h>
+#include <UIAutomation.h>
+#include <wrl/client.h>
+
+namespace sn {
+
+// ─────────────────────────────────────────────────────────
+// WinUiaScrollProvider — ScrollPattern surfaces through UI Automation
+//
+// Resolve() takes the target window's element, or the first descendant
+// that is vertically scrollable, and wraps its ScrollPattern. UIA is
+// started on first use on the calling (UI) thread, with short timeouts
+// so an unresponsive target costs a fraction of a second, not a hang.
+// ─────────────────────────────────────────────────────────
+class WinUiaScrollProvider : public ScrollSurfaceProvider {
+public:
+    ~WinUiaScrollProvider() override { Shutdown(); }
+
+    std::unique_ptr<ScrollSurface> Resolve(ScrollTarget target) override;
+
+    // Release UIA (and COM) — after every surface has been dropped.
+    void Shutdown();
+
+private:
+    bool Start();
+
+    Microsoft::WRL::ComPtr<IUIAutomation>          uia_;
+    Microsoft::WRL::ComPtr<IUIAutomationCondition> scrollable_;
+    bool started_ = false;
+    bool comInit_ = false;
+};
+
+} // namespace sn
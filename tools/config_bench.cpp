@@ -0,0 +1,156 @@
+// config_bench — the config loader against the DOM read it replaced
+//
+//   config_bench <config.json> [loads]
+//
+// Times LoadConfig() (nlohmann SAX, field by field) and a DOM load
+// (json::parse, then every field read out of the tree inside one try,
+// as ConfigStore::Load used to) on the file as given and on a v1-shaped
+// copy (continuous_accel an int, wheel_block a bool); the DOM read
+// throws on v2's "wheel_block": "off". Reports time, allocations and
+// bytes allocated per load. Run through the `bench_config` target; use
+// an optimized build (-DCMAKE_BUILD_TYPE=Release) for real numbers.
+//
+// The loader is not faster to start up: on the shipped config.json a
+// Release build takes about 10 us against the DOM's 8-9 us. What it
+// buys is tolerance of v2 files and a third of the allocations (26
+// against 63, 1.5 KB against 3.9 KB).
+#include "core/ConfigLoader.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+using namespace sn;
+
+// Allocation counting: every replaceable operator new and delete form
+// goes through these two, so nothing is freed by a function that
+// didn't allocate it.
+static size_t g_allocs = 0;
+static size_t g_bytes  = 0;
+
+static void* Allocate(size_t n, size_t align) {
+    g_allocs++;
+    g_bytes += n;
+    if (n == 0) n = 1;
+    void* p = nullptr;
+#if defined(_WIN32)
+    p = _aligned_malloc(n, align);
+#else
+    if (posix_memalign(&p, align < sizeof(void*) ? sizeof(void*) : align, n) != 0) p = nullptr;
+#endif
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+static void Release(void* p) noexcept {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+static const size_t kDefaultAlign = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+void* operator new(size_t n) { return Allocate(n, kDefaultAlign); }
+void* operator new[](size_t n) { return Allocate(n, kDefaultAlign); }
+void* operator new(size_t n, std::align_val_t a) { return Allocate(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a) { return Allocate(n, (size_t)a); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept {
+    try { return Allocate(n, kDefaultAlign); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t n, const std::nothrow_t&) noexcept {
+    try { return Allocate(n, kDefaultAlign); } catch (...) { return nullptr; }
+}
+void operator delete(void* p) noexcept { Release(p); }
+void operator delete[](void* p) noexcept { Release(p); }
+void operator delete(void* p, size_t) noexcept { Release(p); }
+void operator delete[](void* p, size_t) noexcept { Release(p); }
+void operator delete(void* p, std::align_val_t) noexcept { Release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { Release(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { Release(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { Release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { Release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { Release(p); }
+
+// The DOM read: a type error anywhere throws and leaves every default.
+static bool DomLoad(const std::string& text, AppConfig& cfg) {
+    try {
+        const nlohmann::json j = nlohmann::json::parse(text);
+        AppConfig c;
+        c.version            = j.value("version", c.version);
+        c.enabled            = j.value("enabled", c.enabled);
+        c.start_with_windows = j.value("start_with_windows", c.start_with_windows);
+        c.wheel_block        = j.value("wheel_block", c.wheel_block);
+        c.language           = j.value("language", c.language);
+        if (j.contains("scroll")) {
+            const auto& s = j.at("scroll");
+            c.scroll.mode             = s.value("mode", c.scroll.mode);
+            c.scroll.scroll_amount    = s.value("scroll_amount", c.scroll.scroll_amount);
+            c.scroll.continuous_speed = s.value("continuous_speed", c.scroll.continuous_speed);
+            c.scroll.continuous_accel = s.value("continuous_accel", c.scroll.continuous_accel);
+            c.scroll.hover_speed      = s.value("hover_speed", c.scroll.hover_speed);
+        }
+        if (j.contains("zone")) {
+            const auto& z = j.at("zone");
+            c.zone.x       = z.value("x", c.zone.x);
+            c.zone.y       = z.value("y", c.zone.y);
+            c.zone.width   = z.value("width", c.zone.width);
+            c.zone.height  = z.value("height", c.zone.height);
+            c.zone.opacity = z.value("opacity", c.zone.opacity);
+            c.zone.locked  = z.value("locked", c.zone.locked);
+        }
+        if (j.contains("sound")) c.sound.enabled = j.at("sound").value("enabled", c.sound.enabled);
+        cfg = c;
+        return true;
+    } catch (const nlohmann::json::exception&) {
+        cfg = AppConfig();
+        return false;
+    }
+}
+
+template <class Load>
+static void Run(const char* name, int loads, Load load) {
+    const size_t allocs = g_allocs, bytes = g_bytes;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < loads; i++) load();
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("%-24s %8.2f us %7.1f allocs %8.0f B\n", name, us / loads,
+                double(g_allocs - allocs) / loads, double(g_bytes - bytes) / loads);
+}
+
+static void Replace(std::string& text, const std::string& from, const std::string& to) {
+    const size_t at = text.find(from);
+    if (at != std::string::npos) text.replace(at, from.size(), to);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: config_bench <config.json> [loads]\n");
+        return 2;
+    }
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "%s: cannot be read\n", argv[1]);
+        return 1;
+    }
+    std::stringstream in;
+    in << file.rdbuf();
+    const std::string v2 = in.str();
+    std::string v1 = v2;
+    Replace(v1, "\"continuous_accel\": 1.2", "\"continuous_accel\": 1");
+    Replace(v1, "\"wheel_block\": \"off\"", "\"wheel_block\": false");
+    const int loads = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+    AppConfig cfg;
+    std::printf("DOM read of the file: %s\n", DomLoad(v2, cfg) ? "ok" : "threw, all defaults");
+    std::printf("SAX read of the file: %d fields applied\n", LoadConfig(v2, cfg).applied);
+
+    Run("DOM, v1-shaped", loads, [&] { AppConfig c; DomLoad(v1, c); });
+    Run("DOM, as given", loads, [&] { AppConfig c; DomLoad(v2, c); });
+    Run("SAX, v1-shaped", loads, [&] { AppConfig c; LoadConfig(v1, c); });
+    Run("SAX, as given", loads, [&] { AppConfig c; LoadConfig(v2, c); });
+    return 0;
+}
@@ -0,0 +1,115 @@
+// config_check — does the shipped config.json load the way the app
+// reads it (src/core/ConfigLoader.h)? v2 writes "continuous_accel": 1.2
+// and "wheel_block": "off"; both must come through coerced, with the
+// rest of the file applied around them.
+//
+//   config_check <config.json>
+//
+// Run through the `check_config` target. Exit code 0 = pass.
+#include "core/ConfigLoader.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace sn;
+
+static int g_failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "line %d: %s\n", __LINE__, #cond);        \
+            g_failures++;                                                  \
+        }                                                                  \
+    } while (0)
+
+// The diagnostic reported for `path`, or nullptr.
+static const ConfigDiagnostic* Find(const ConfigLoadResult& res, const char* path) {
+    for (const auto& d : res.diagnostics)
+        if (d.path == path) return &d;
+    return nullptr;
+}
+
+static bool IsInfo(const ConfigLoadResult& res, const char* path) {
+    const ConfigDiagnostic* d = Find(res, path);
+    return d && d->severity == ConfigDiagnostic::Severity::Info;
+}
+
+static bool WheelBlock(const char* value) {
+    AppConfig cfg;
+    LoadConfig(std::string("{\"wheel_block\": ") + value + "}", cfg);
+    return cfg.wheel_block;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: config_check <config.json>\n");
+        return 2;
+    }
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "%s: cannot be read\n", argv[1]);
+        return 1;
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+
+    // The shipped file: read to the end, nothing worse than a note
+    AppConfig cfg;
+    ConfigLoadResult res = LoadConfig(text.str(), cfg);
+    CHECK(res.complete);
+    for (const auto& d : res.diagnostics) {
+        if (d.severity == ConfigDiagnostic::Severity::Info) continue;
+        std::fprintf(stderr, "%s: %s\n", d.path.c_str(), d.message.c_str());
+        g_failures++;
+    }
+
+    // 1.2 is rounded into the int field, "off" is false; both noted
+    CHECK(cfg.scroll.continuous_accel == 1);
+    CHECK(IsInfo(res, "scroll.continuous_accel"));
+    CHECK(!cfg.wheel_block);
+    CHECK(IsInfo(res, "wheel_block"));
+
+    // The fields around them still apply
+    CHECK(cfg.enabled);
+    CHECK(cfg.scroll.mode == "hover_auto");
+    CHECK(cfg.scroll.scroll_amount == 3);
+    CHECK(cfg.scroll.continuous_speed == 5);
+    CHECK(cfg.scroll.hover_speed == 3);
+    CHECK(cfg.zone.x == 0 && cfg.zone.y == 100);
+    CHECK(cfg.zone.width == 60 && cfg.zone.height == 400);
+    CHECK(std::fabs(cfg.zone.opacity - 0.3) < 1e-9);
+    CHECK(!cfg.zone.locked);
+    CHECK(!cfg.sound.enabled);
+    CHECK(cfg.language == "en");
+    CHECK(IsInfo(res, "theme"));   // v2-only, skipped
+
+    // The other v2 wheel-block modes all block
+    CHECK(WheelBlock("\"global\""));
+    CHECK(WheelBlock("\"outside_zone_only\""));
+    CHECK(WheelBlock("\"inside_zone_only\""));
+    CHECK(!WheelBlock("\"off\""));
+
+    // Rounding goes to the nearest int; a numeric string is parsed
+    AppConfig coerced;
+    res = LoadConfig(R"({"scroll": {"continuous_accel": 2.6, "hover_speed": "7"}})", coerced);
+    CHECK(coerced.scroll.continuous_accel == 3);
+    CHECK(coerced.scroll.hover_speed == 7);
+
+    // A value of the wrong type keeps only that field's default
+    AppConfig mixed;
+    const int speed = mixed.scroll.continuous_speed;
+    res = LoadConfig(R"({"scroll": {"continuous_speed": [1], "hover_speed": 9}})", mixed);
+    CHECK(mixed.scroll.continuous_speed == speed);
+    CHECK(mixed.scroll.hover_speed == 9);
+    CHECK(Find(res, "scroll.continuous_speed") &&
+          Find(res, "scroll.continuous_speed")->severity == ConfigDiagnostic::Severity::Warning);
+
+    if (g_failures) {
+        std::fprintf(stderr, "config_check: %d FAILED\n", g_failures);
+        return 1;
+    }
+    std::puts("config_check: ok");
+    return 0;
+}
@@ -0,0 +1,130 @@
+// file_watcher_check — the inotify FileWatcher and the DiffConfig bits
+// a config reload acts on. In a scratch directory: a save renamed over
+// the file and an in-place write call back, a sibling file does not,
+// nothing calls back after Stop(), and a stopped watcher starts again.
+// Run through the `check_file_watcher` target. Exit code 0 = pass.
+#include "core/ConfigLoader.h"
+#include "core/ConfigPersister.h"
+#include "core/ConfigSchema.h"
+#include "core/FileWatcher.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace sn;
+
+static int g_failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "line %d: %s\n", __LINE__, #cond);        \
+            g_failures++;                                                  \
+        }                                                                  \
+    } while (0)
+
+static std::atomic<int> g_calls{0};
+
+// Callbacks seen since the last call: waits up to `wait` for the first
+// one, then a little longer for the rest of the burst.
+static int Calls(std::chrono::milliseconds wait) {
+    const auto until = std::chrono::steady_clock::now() + wait;
+    while (g_calls.load() == 0 && std::chrono::steady_clock::now() < until)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return g_calls.exchange(0);
+}
+
+static const std::chrono::milliseconds kEvent(2000);   // expected: generous
+static const std::chrono::milliseconds kQuiet(200);    // not expected
+
+static void WriteInPlace(const std::string& path, const char* text) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text;
+}
+
+static uint32_t DiffAfter(void (*edit)(AppConfig&)) {
+    AppConfig from, to;
+    edit(to);
+    return DiffConfig(from, to);
+}
+
+int main() {
+    char dirTemplate[] = "/tmp/file_watcher_check.XXXXXX";
+    const char* dir = mkdtemp(dirTemplate);
+    if (!dir) {
+        std::perror("mkdtemp");
+        return 1;
+    }
+    const std::string path    = std::string(dir) + "/config.json";
+    const std::string sibling = std::string(dir) + "/other.json";
+    WriteInPlace(path, "{}");
+
+    auto watcher = CreateFileWatcher();
+    CHECK(watcher->Start(path, [] { g_calls++; }));
+
+    // A save renamed over the file (the persister, most editors)
+    CHECK(WriteFileAtomic(path, "{\"enabled\": false}"));
+    CHECK(Calls(kEvent) >= 1);
+
+    // Written in place
+    WriteInPlace(path, "{\"enabled\": true}");
+    CHECK(Calls(kEvent) >= 1);
+
+    // Another file in the same directory, either way
+    WriteInPlace(sibling, "{}");
+    CHECK(WriteFileAtomic(sibling, "{}"));
+    CHECK(Calls(kQuiet) == 0);
+
+    // Stopped: nothing more, even for the watched file
+    watcher->Stop();
+    WriteInPlace(path, "{}");
+    CHECK(WriteFileAtomic(path, "{}"));
+    CHECK(Calls(kQuiet) == 0);
+
+    // Started again on the same object
+    CHECK(watcher->Start(path, [] { g_calls++; }));
+    CHECK(WriteFileAtomic(path, "{\"zone\": {\"x\": 5}}"));
+    CHECK(Calls(kEvent) >= 1);
+    watcher.reset();
+
+    // A directory that does not exist cannot be watched
+    CHECK(!CreateFileWatcher()->Start(std::string(dir) + "/missing/config.json", [] {}));
+
+    // The change bits a reload acts on: one per subsystem touched
+    CHECK(DiffAfter([](AppConfig&) {}) == CHG_NONE);
+    CHECK(DiffAfter([](AppConfig& c) { c.version = 9; }) == CHG_NONE);
+    CHECK(DiffAfter([](AppConfig& c) { c.zone.opacity = 0.9; }) == CHG_ZONE_OPACITY);
+    CHECK(DiffAfter([](AppConfig& c) { c.zone.x += 1; c.zone.y += 1; }) == CHG_ZONE_POSITION);
+    CHECK(DiffAfter([](AppConfig& c) { c.scroll.mode = "hover_auto"; }) == CHG_MODE);
+    CHECK(DiffAfter([](AppConfig& c) { c.wheel_block = !c.wheel_block; }) == CHG_WHEEL_BLOCK);
+    CHECK(DiffAfter([](AppConfig& c) { c.profiles.push_back(ProfileConfig{}); }) == CHG_PROFILES);
+    CHECK(DiffAfter([](AppConfig& c) {
+              c.zone.width += 1;
+              c.hotkeys.toggle_edit = "Ctrl+Alt+X";
+              c.scroll.hover_speed += 1;
+              c.sound.enabled = !c.sound.enabled;
+          }) == (CHG_ZONE_SIZE | CHG_HOTKEYS | CHG_SCROLL_TUNING | CHG_SOUND));
+
+    // A reload diffs what was on disk against what is there now
+    AppConfig before, after;
+    LoadConfig(std::string("{\"zone\": {\"x\": 5}}"), before);
+    LoadConfig(std::string("{\"zone\": {\"x\": 6}, \"language\": \"vi\"}"), after);
+    CHECK(DiffConfig(before, after) == (CHG_ZONE_POSITION | CHG_LANGUAGE));
+
+    std::remove(path.c_str());
+    std::remove(sibling.c_str());
+    rmdir(dir);
+
+    if (g_failures) {
+        std::fprintf(stderr, "file_watcher_check: %d FAILED\n", g_failures);
+        return 1;
+    }
+    std::puts("file_watcher_check: ok");
+    return 0;
+}
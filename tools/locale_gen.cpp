@@ -0,0 +1,106 @@
+// locale_gen — compiles locales/<lang>.json into a string catalog
+//
+//   locale_gen <out.catalog> <lang.json>
+//
+// Nested objects are flattened to dotted keys ("menu.quit"), as the
+// Rust lane does; non-string leaves are ignored. The written catalog is
+// read back and every key looked up before the tool reports success.
+#include "core/StringCatalog.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using namespace sn;
+
+using Entries = std::vector<std::pair<std::string, std::u16string>>;
+
+static bool ToUtf16(const std::string& s, std::u16string& out) {
+    out.clear();
+    for (size_t i = 0; i < s.size();) {
+        unsigned char c = (unsigned char)s[i];
+        int extra = c < 0x80 ? 0 : (c >> 5) == 0x6 ? 1 : (c >> 4) == 0xE ? 2 : (c >> 3) == 0x1E ? 3 : -1;
+        if (extra < 0 || i + extra >= s.size()) return false;
+        uint32_t cp = extra == 0 ? c : c & (0x3F >> extra);
+        for (int k = 1; k <= extra; k++) {
+            unsigned char cc = (unsigned char)s[i + k];
+            if ((cc >> 6) != 0x2) return false;
+            cp = (cp << 6) | (cc & 0x3F);
+        }
+        i += 1 + extra;
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            out += (char16_t)(0xD800 + (cp >> 10));
+            out += (char16_t)(0xDC00 + (cp & 0x3FF));
+        } else {
+            out += (char16_t)cp;
+        }
+    }
+    return true;
+}
+
+static bool Flatten(const std::string& prefix, const nlohmann::json& v, Entries& out) {
+    if (v.is_object()) {
+        for (auto it = v.begin(); it != v.end(); ++it)
+            if (!Flatten(prefix.empty() ? it.key() : prefix + "." + it.key(), it.value(), out)) return false;
+    } else if (v.is_string()) {
+        std::u16string text;
+        if (!ToUtf16(v.get<std::string>(), text)) {
+            std::fprintf(stderr, "%s: invalid UTF-8\n", prefix.c_str());
+            return false;
+        }
+        out.emplace_back(prefix, std::move(text));
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: locale_gen <out.catalog> <lang.json>\n");
+        return 2;
+    }
+
+    Entries entries;
+    try {
+        std::ifstream in(argv[2], std::ios::binary);
+        if (!in.is_open()) { std::fprintf(stderr, "%s: cannot open\n", argv[2]); return 1; }
+        if (!Flatten("", nlohmann::json::parse(in), entries)) return 1;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s: %s\n", argv[2], e.what());
+        return 1;
+    }
+
+    std::string bytes, error;
+    if (!BuildStringCatalog(entries, bytes, error)) {
+        std::fprintf(stderr, "%s: %s\n", argv[2], error.c_str());
+        return 1;
+    }
+
+    // Read it back exactly as the app will
+    std::vector<uint32_t> aligned((bytes.size() + 3) / 4);
+    std::memcpy(aligned.data(), bytes.data(), bytes.size());
+    StringCatalog check;
+    if (!check.Attach(aligned.data(), bytes.size()) || check.Count() != entries.size()) {
+        std::fprintf(stderr, "%s: catalog does not read back\n", argv[2]);
+        return 1;
+    }
+    for (const auto& e : entries) {
+        const char16_t* v = check.Find(e.first);
+        if (!v || e.second != v) {
+            std::fprintf(stderr, "%s: lookup of \"%s\" failed\n", argv[2], e.first.c_str());
+            return 1;
+        }
+    }
+
+    // Leave the file (and its timestamp) alone when nothing changed
+    {
+        std::ifstream old(argv[1], std::ios::binary);
+        std::ostringstream current;
+        current << old.rdbuf();
+        if (old.is_open() && current.str() == bytes) return 0;
+    }
+    std::ofstream f(argv[1], std::ios::binary | std::ios::trunc);
+    f << bytes;
+    return f.good() ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// pan_check — PanPlanner through a RecordingPanSink: the finger goes
+// down at the anchor, drags in whole pixels, holds still at the edge of
+// the area and lifts to re-grip, and lifts at once for another target.
+// Run through the `check_pan` target. Exit code 0 = pass.
+#include "core/RecordingPanSink.h"
+#include <cmath>
+#include <cstdio>
+
+using namespace sn;
+
+static int g_failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "line %d: %s\n", __LINE__, #cond);        \
+            g_failures++;                                                  \
+        }                                                                  \
+    } while (0)
+
+static PanArea Area(uintptr_t target, int x, int y, int top, int bottom) {
+    PanArea a;
+    a.target = target;
+    a.x      = x;
+    a.y      = y;
+    a.top    = top;
+    a.bottom = bottom;
+    return a;
+}
+
+int main() {
+    RecordingPanSink sink;
+    PanPlanner planner(sink);
+    CHECK(!planner.Move(10));   // no area yet
+
+    // One 100 px step up: down at the anchor, one 100 px drag, still
+    // frames until idle, lift where it stopped
+    planner.SetArea(Area(1, 500, 300, 100, 700));
+    CHECK(planner.Move(100));
+    CHECK(sink.Framing());
+    sink.Run(planner);
+    const auto& click = sink.Contacts();
+    CHECK(click.size() == 2 + PanPlanner::kIdleFrames + 1);
+    CHECK(click.front().phase == PanPhase::Down && click.front().x == 500 && click.front().y == 300);
+    CHECK(click[1].phase == PanPhase::Move && click[1].y == 400);
+    for (size_t i = 2; i + 1 < click.size(); i++) CHECK(click[i].phase == PanPhase::Move && click[i].y == 400);
+    CHECK(click.back().phase == PanPhase::Up && click.back().y == 400);
+    CHECK(!sink.Framing() && !planner.InContact());
+
+    // A long scroll down, 7.3 px a frame: it re-grips at the edge of the
+    // area, stays inside the margins and travels the whole distance
+    sink.Clear();
+    double queued = 0.0;
+    for (int f = 0; f < 2000; f++) {
+        planner.Move(-7.3);
+        queued += 7.3;
+        planner.Frame();
+    }
+    sink.Run(planner);
+    int grips = 0, lastY = 0;
+    double travel = 0.0;
+    for (const auto& c : sink.Contacts()) {
+        if (c.phase == PanPhase::Down) grips++;
+        else travel += lastY - c.y;
+        lastY = c.y;
+        CHECK(c.y >= 100 + PanPlanner::kMargin && c.y <= 700 - PanPlanner::kMargin);
+    }
+    CHECK(grips > 1);
+    CHECK(std::fabs(travel - queued) < 1.0);
+
+    // Every lift comes after kSettleFrames frames held still (no fling)
+    const auto& hold = sink.Contacts();
+    for (size_t i = PanPlanner::kSettleFrames; i < hold.size(); i++) {
+        if (hold[i].phase != PanPhase::Up) continue;
+        for (int k = 1; k <= PanPlanner::kSettleFrames; k++) CHECK(hold[i - k].y == hold[i].y);
+    }
+
+    // Another target mid-gesture lifts the finger right away
+    sink.Clear();
+    planner.Move(50);
+    planner.Frame();
+    planner.Frame();
+    CHECK(planner.InContact());
+    planner.SetArea(Area(2, 10, 10, 0, 400));
+    CHECK(!planner.InContact());
+    CHECK(!sink.Contacts().empty() && sink.Contacts().back().phase == PanPhase::Up);
+
+    // Injection fails: Move() refuses until the next SetArea()
+    sink.Run(planner);
+    sink.SetFailing(true);
+    planner.Move(20);
+    planner.Frame();
+    CHECK(!planner.Move(5));
+    sink.Run(planner);
+    CHECK(!sink.Framing());
+    sink.SetFailing(false);
+    planner.SetArea(Area(2, 10, 10, 0, 400));
+    CHECK(planner.Move(5));
+
+    // An area too small to drag in is refused
+    RecordingPanSink small;
+    PanPlanner tiny(small);
+    tiny.SetArea(Area(3, 0, 0, 0, 40));
+    CHECK(!tiny.Move(1));
+
+    if (g_failures) {
+        std::fprintf(stderr, "pan_check: %d FAILED\n", g_failures);
+        return 1;
+    }
+    std::puts("pan_check: ok");
+    return 0;
+}
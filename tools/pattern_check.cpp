@@ -0,0 +1,109 @@
+// pattern_check — PatternScroller against simulated ScrollPattern
+// documents (src/core/MockScrollBackend.h): resolve caching, the
+// negative cache and its expiry, whole-pixel writes, the ends, and
+// elements that go away. Run through the `check_pattern` target.
+// Exit code 0 = pass.
+#include "core/MockScrollBackend.h"
+#include <cmath>
+#include <cstdio>
+
+using namespace sn;
+
+static int g_failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "line %d: %s\n", __LINE__, #cond);        \
+            g_failures++;                                                  \
+        }                                                                  \
+    } while (0)
+
+static bool Near(double a, double b) { return std::fabs(a - b) < 0.01; }
+
+int main() {
+    MockScrollSurfaceProvider provider;
+    PatternScroller scroller(provider);
+    const double frame = 0.016;
+    double t = 0.0;
+
+    // 10000 px of content in a 1000 px view: 100 ticks of 3 px down are
+    // one resolve, one read at the start of the gesture, a write a tick
+    auto& doc = provider.AddDocument(1, 10000, 1000);
+    for (int i = 0; i < 100; i++, t += frame) CHECK(scroller.Scroll(1, -3, t));
+    CHECK(provider.Resolves() == 1);
+    CHECK(doc.queries == 1);
+    CHECK(doc.writes == 100);
+    CHECK(Near(doc.top, 300));
+
+    // 0.4 px a tick: written only when the position reaches another
+    // whole pixel (40 of 100 ticks)
+    const int slowFrom = doc.writes;
+    for (int i = 0; i < 100; i++, t += frame) scroller.Scroll(1, -0.4, t);
+    CHECK(doc.writes - slowFrom == 40);
+
+    // Scrolled some other way between gestures: the next one starts
+    // from where the document is
+    doc.top = 5000;
+    t += 1.0;
+    scroller.Scroll(1, -10, t);
+    CHECK(doc.queries == 2);
+    CHECK(Near(doc.top, 5010));
+
+    // At the bottom: still handled, nothing written; the ends read back
+    for (int i = 0; i < 200; i++, t += frame) CHECK(scroller.Scroll(1, -100, t));
+    const int atEnd = doc.writes;
+    for (int i = 0; i < 50; i++, t += frame) CHECK(scroller.Scroll(1, -100, t));
+    CHECK(doc.writes == atEnd);
+    CHECK(Near(doc.top, 9000));
+    bool atTop = true, atBottom = false;
+    CHECK(scroller.Ends(1, t, atTop, atBottom));
+    CHECK(!atTop && atBottom);
+    t += 1.0;
+    scroller.Scroll(1, 50, t);
+    CHECK(Near(doc.top, 8950));
+
+    // No surface: resolved once, then "none" is cached until
+    // kRetryNoSurface has passed
+    const int resolves = provider.Resolves();
+    for (int i = 0; i < 100; i++, t += frame) CHECK(!scroller.Scroll(2, -3, t));
+    CHECK(provider.Resolves() == resolves + 1);
+    t += PatternScroller::kRetryNoSurface;
+    scroller.Scroll(2, -3, t);
+    CHECK(provider.Resolves() == resolves + 2);
+
+    // Content that fits in view: wheel events instead, surface kept
+    auto& small = provider.AddDocument(3, 500, 1000);
+    CHECK(!scroller.Scroll(3, -3, t));
+    CHECK(!scroller.Scroll(3, -3, t + frame));
+    CHECK(small.queries == 1);
+
+    // The element goes away: refused once, resolved again on the next call
+    provider.Remove(1);
+    t += 1.0;
+    CHECK(!scroller.Scroll(1, -3, t));
+    const int beforeReturn = provider.Resolves();
+    provider.AddDocument(1, 2000, 1000);
+    CHECK(scroller.Scroll(1, -3, t + frame));
+    CHECK(provider.Resolves() == beforeReturn + 1);
+
+    // kCacheSize targets are kept; the least recently used goes first
+    for (ScrollTarget target = 10; target < 30; target++) {
+        provider.AddDocument(target, 5000, 500);
+        scroller.Scroll(target, -1, t += 0.3);
+    }
+    const int cached = provider.Resolves();
+    scroller.Scroll(29, -1, t += 0.3);
+    CHECK(provider.Resolves() == cached);
+    scroller.Scroll(10, -1, t += 0.3);
+    CHECK(provider.Resolves() == cached + 1);
+
+    CHECK(!scroller.Scroll(0, -1, t));   // no target
+
+    if (g_failures) {
+        std::fprintf(stderr, "pattern_check: %d FAILED\n", g_failures);
+        return 1;
+    }
+    std::puts("pattern_check: ok");
+    return 0;
+}
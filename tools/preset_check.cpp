@@ -0,0 +1,51 @@
+// preset_check — do the embedded preset tables match presets/*.json?
+//
+//   preset_check <preset.json>...
+//
+// Loads every source file the way the app would and compares it with
+// the table compiled into this binary (the same ScrollNiceCore the app
+// links). Run through the `check_presets` target.
+#include "core/BuiltinPresets.h"
+#include "core/ConfigLoader.h"
+#include <cstdio>
+#include <set>
+#include <string>
+
+using namespace sn;
+
+int main(int argc, char** argv) {
+    const BuiltinPresetTable tables = BuiltinPresetTables();
+    std::set<std::string> seen;
+    int failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        ProfileConfig source;
+        ConfigLoadResult res = LoadPresetFile(argv[i], source);
+        if (!res.complete) {
+            std::fprintf(stderr, "%s: cannot be read\n", argv[i]);
+            failures++;
+            continue;
+        }
+        seen.insert(source.id);
+
+        const BuiltinPreset* embedded = nullptr;
+        for (const auto& preset : tables)
+            if (source.id == preset.id) embedded = &preset;
+        if (!embedded) {
+            std::fprintf(stderr, "%s: preset \"%s\" is not embedded\n", argv[i], source.id.c_str());
+            failures++;
+        } else if (ToProfile(*embedded) != source) {
+            std::fprintf(stderr, "%s: embedded preset \"%s\" is out of date\n", argv[i], source.id.c_str());
+            failures++;
+        }
+    }
+    for (const auto& preset : tables) {
+        if (seen.count(preset.id)) continue;
+        std::fprintf(stderr, "embedded preset \"%s\" has no source file\n", preset.id);
+        failures++;
+    }
+
+    if (failures) return 1;
+    std::printf("preset_check: %zu embedded presets match their sources\n", tables.count);
+    return 0;
+}
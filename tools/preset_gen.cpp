@@ -0,0 +1,135 @@
+// preset_gen — compiles presets/*.json into constexpr tables
+//
+//   preset_gen <out PresetTables.h> <preset.json>...
+//
+// Each file goes through the app's own loader (LoadPresetFile), so the
+// tables hold exactly what reading the file at runtime would produce.
+// Anything the loader only tolerates (a warning or an error) fails the
+// build instead: a built-in preset should be clean.
+#include "core/ConfigLoader.h"
+#include "core/ConfigSchema.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sn;
+
+static std::string Quote(const std::string& s) {
+    std::string out = "\"";
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') { out += '\\'; out += (char)c; }
+        else if (c < 0x20 || c >= 0x7f) {
+            char esc[8];
+            std::snprintf(esc, sizeof(esc), "\\%03o", c);   // octal: never swallows the next char
+            out += esc;
+        } else out += (char)c;
+    }
+    return out + "\"";
+}
+
+// Shortest decimal form that reads back as the same double.
+static std::string Number(double v) {
+    char buf[32];
+    for (int precision = 15; precision <= 17; precision++) {
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, v);
+        if (std::strtod(buf, nullptr) == v) break;
+    }
+    return buf;
+}
+
+static void EmitStrings(std::ostream& out, const std::string& name, const std::vector<std::string>& list) {
+    if (list.empty()) return;
+    out << "static constexpr const char* " << name << "[] = {";
+    for (size_t i = 0; i < list.size(); i++) out << (i ? ", " : "") << Quote(list[i]);
+    out << "};\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: preset_gen <out.h> <preset.json>...\n");
+        return 2;
+    }
+
+    std::vector<ProfileConfig> presets;
+    std::set<std::string> ids;
+    bool ok = true;
+    for (int i = 2; i < argc; i++) {
+        ProfileConfig p;
+        ConfigLoadResult res = LoadPresetFile(argv[i], p);
+        for (const auto& d : res.diagnostics) {
+            if (d.severity == ConfigDiagnostic::Severity::Info) continue;
+            std::fprintf(stderr, "%s: %s: %s\n", argv[i], d.path.empty() ? "file" : d.path.c_str(),
+                         d.message.c_str());
+            ok = false;
+        }
+        if (!ids.insert(p.id).second) {
+            std::fprintf(stderr, "%s: duplicate preset id \"%s\"\n", argv[i], p.id.c_str());
+            ok = false;
+        }
+        presets.push_back(std::move(p));
+    }
+    if (!ok) return 1;
+
+    const FieldTable fields = ConfigFields();
+    std::ostringstream out;
+    out << "// Generated by tools/preset_gen from presets/*.json — do not edit.\n"
+           "#pragma once\n"
+           "#include \"core/BuiltinPresets.h\"\n\n"
+           "namespace sn {\n";
+
+    for (size_t i = 0; i < presets.size(); i++) {
+        const ProfileConfig& p = presets[i];
+        const std::string prefix = "kPreset" + std::to_string(i);
+        out << "\n// " << p.id << "\n";
+        EmitStrings(out, prefix + "Apps", p.apps);
+        EmitStrings(out, prefix + "Classes", p.window_classes);
+        if (p.settings.empty()) continue;
+        out << "static constexpr BuiltinSetting " << prefix << "Settings[] = {\n";
+        for (const auto& s : p.settings) {
+            const FieldDesc& f = fields.first[s.field];
+            out << "    {" << s.field << ", " << Number(s.number) << ", "
+                << (f.type == FieldType::String ? Quote(s.text) : "nullptr") << "},   // "
+                << f.path << "\n";
+        }
+        out << "};\n";
+    }
+
+    out << "\n";
+    if (presets.empty()) {
+        out << "static constexpr const BuiltinPreset* kBuiltinPresets = nullptr;\n"
+               "static constexpr size_t kBuiltinPresetCount = 0;\n";
+    } else {
+        out << "static constexpr BuiltinPreset kBuiltinPresets[] = {\n";
+        for (size_t i = 0; i < presets.size(); i++) {
+            const ProfileConfig& p = presets[i];
+            const std::string prefix = "kPreset" + std::to_string(i);
+            auto list = [&](const char* suffix, size_t n) {
+                return n ? prefix + suffix + ", " + std::to_string(n) : std::string("nullptr, 0");
+            };
+            out << "    {" << Quote(p.id) << ", " << Quote(p.name) << ", "
+                << list("Apps", p.apps.size()) << ", "
+                << list("Classes", p.window_classes.size()) << ", "
+                << list("Settings", p.settings.size()) << "},\n";
+        }
+        out << "};\n"
+               "static constexpr size_t kBuiltinPresetCount = sizeof(kBuiltinPresets) / sizeof(kBuiltinPresets[0]);\n";
+    }
+    out << "\n} // namespace sn\n";
+
+    // Leave the file (and its timestamp) alone when nothing changed
+    const std::string text = out.str();
+    {
+        std::ifstream old(argv[1], std::ios::binary);
+        std::ostringstream current;
+        current << old.rdbuf();
+        if (old.is_open() && current.str() == text) return 0;
+    }
+    std::ofstream f(argv[1], std::ios::binary | std::ios::trunc);
+    f << text;
+    return f.good() ? 0 : 1;
+}
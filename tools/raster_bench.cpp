@@ -0,0 +1,62 @@
+// raster_bench — time one RenderZone frame under each kernel set
+//
+//   raster_bench [width height [frames]]
+//
+// Renders the hover-mode zone with a cover image and labels (the most
+// drawing a frame does) at the given size, 3840x2160 by default, and
+// prints ms per frame for scalar, SSE2 and AVX2 as far as the CPU
+// allows. Run through the `bench_raster` target; use an optimized
+// build (-DCMAKE_BUILD_TYPE=Release) for real numbers.
+#include "core/ZoneRenderer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace sn;
+
+class SolidLabels : public ZoneLabelSource {
+public:
+    SolidLabels() : data_(48 * 14, 200) { mask_ = CoverageMask{data_.data(), 48, 14, 48}; }
+    const CoverageMask* Label(ZoneLabel) override { return &mask_; }
+
+private:
+    std::vector<uint8_t> data_;
+    CoverageMask         mask_;
+};
+
+int main(int argc, char** argv) {
+    const int width  = argc > 2 ? std::atoi(argv[1]) : 3840;
+    const int height = argc > 2 ? std::atoi(argv[2]) : 2160;
+    const int frames = argc > 3 ? std::atoi(argv[3]) : 20;
+    if (width <= 0 || height <= 0 || frames <= 0) {
+        std::fprintf(stderr, "usage: raster_bench [width height [frames]]\n");
+        return 2;
+    }
+
+    std::vector<Pixel> pixels((size_t)width * height), coverPixels((size_t)width * height);
+    const Surface dst{pixels.data(), width, height, width};
+    const Surface cover{coverPixels.data(), width, height, width};
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++) cover.Row(y)[x] = MakePixel(x & 0xFF, y & 0xFF, 128, 160);
+
+    SolidLabels labels;
+    ZoneVisualState st;
+    st.mode       = ScrollMode::HoverAuto;
+    st.editMode   = true;
+    st.locked     = true;
+
+    const raster::Isa best = raster::BestIsa();
+    std::printf("%dx%d, %d frames\n", width, height, frames);
+    for (raster::Isa isa : {raster::Isa::Scalar, raster::Isa::SSE2, raster::Isa::AVX2}) {
+        if (isa > best) break;
+        raster::SetIsa(isa);
+        RenderZone(dst, st, &labels, &cover);   // warm-up
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; i++) RenderZone(dst, st, &labels, &cover);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        std::printf("%-6s %8.2f ms/frame\n", raster::IsaName(isa), ms / frames);
+    }
+    raster::SetIsa(best);
+    return 0;
+}
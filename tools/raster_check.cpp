@@ -0,0 +1,201 @@
+// raster_check — golden frames for RenderZone, and every kernel set
+// this CPU can run against the scalar one.
+//
+//   raster_check [--print-golden]
+//
+// The scalar frames of a fixed set of zone states must match the CRC-32s
+// in kGolden below. These CRCs catch changes to the shared geometry,
+// which move every kernel set together. When a visual change is
+// intended, regenerate the table with --print-golden, look at the new
+// frames, and commit the table alongside the change. Then each SIMD
+// kernel set must reproduce the scalar frame bit for bit, for each mode
+// and state, with a cover image and labels, at sizes that leave a
+// partial vector at the end of each row. Run through the `check_raster`
+// target. Exit code 0 = pass.
+#include "core/ZoneRenderer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace sn;
+
+static int g_failures = 0;
+
+// A surface that owns its pixels.
+struct Image {
+    std::vector<Pixel> pixels;
+    Surface            surface;
+
+    Image(int width, int height) : pixels((size_t)width * height) {
+        surface = Surface{pixels.data(), width, height, width};
+    }
+};
+
+// Labels as diagonal coverage ramps, so partial coverage is blended too.
+class RampLabels : public ZoneLabelSource {
+public:
+    RampLabels() : data_(kWidth * kHeight) {
+        for (int y = 0; y < kHeight; y++)
+            for (int x = 0; x < kWidth; x++) data_[y * kWidth + x] = (uint8_t)((x * 7 + y * 13) & 0xFF);
+        mask_ = CoverageMask{data_.data(), kWidth, kHeight, kWidth};
+    }
+    const CoverageMask* Label(ZoneLabel) override { return &mask_; }
+
+private:
+    static constexpr int kWidth = 37, kHeight = 11;
+    std::vector<uint8_t> data_;
+    CoverageMask         mask_;
+};
+
+// A translucent cover image with every channel varying.
+static Image MakeCover(int width, int height) {
+    Image cover(width, height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            cover.surface.Row(y)[x] = MakePixel(x * 255 / width, y * 255 / height, (x ^ y) & 0xFF, 96 + (x + y) % 160);
+    return cover;
+}
+
+// CRC-32 (IEEE) of the pixels as little-endian BGRA bytes.
+static uint32_t Crc32(const Image& img) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (Pixel p : img.pixels) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            crc ^= (p >> shift) & 0xFF;
+            for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static ZoneVisualState State(int mode, int flags) {
+    ZoneVisualState st;
+    st.mode       = (ScrollMode)mode;
+    st.editMode   = flags & 1;
+    st.enabled    = !(flags & 2);
+    st.locked     = flags & 4;
+    st.color      = 0x3498DB ^ (unsigned)(flags * 0x1F2F3F);
+    return st;
+}
+
+// Scalar reference frames: flags are 1 = edit, 2 = disabled, 4 = locked.
+// They assume the default floating-point model (no fast-math).
+struct Golden {
+    int      width, height;
+    int      mode, flags;
+    bool     cover;
+    uint32_t crc;
+};
+
+static const Golden kGolden[] = {
+    {120, 180, 0, 0, false, 0xC1EBE653u},
+    {120, 180, 0, 4, true , 0xFECF6134u},
+    {120, 180, 1, 0, false, 0xFBAB1B20u},
+    {120, 180, 1, 1, false, 0x32A2388Fu},
+    {120, 180, 2, 0, false, 0x1825297Eu},
+    {120, 180, 2, 0, true , 0x4F57D872u},
+    {120, 180, 2, 2, false, 0x70FBBBBCu},
+    {120, 180, 0, 7, true , 0x4BC5BC00u},
+    { 61, 203, 2, 0, true , 0x08435AFDu},
+    { 61, 203, 1, 4, false, 0x453F6D1Fu},
+    { 13,   9, 0, 1, false, 0x37835A80u},
+    {256,  64, 1, 0, true , 0x29C0398Cu},
+    {256,  64, 2, 5, false, 0x95C4BBAAu},
+};
+
+static void Render(raster::Isa isa, Image& out, const ZoneVisualState& st, ZoneLabelSource* labels,
+                   const Surface* cover) {
+    raster::SetIsa(isa);
+    raster::Clear(out.surface);
+    RenderZone(out.surface, st, labels, cover);
+}
+
+static void Compare(const char* what, raster::Isa isa, const Image& got, const Image& want) {
+    int differing = 0, worst = 0;
+    for (size_t i = 0; i < want.pixels.size(); i++) {
+        if (got.pixels[i] == want.pixels[i]) continue;
+        differing++;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const int d = std::abs((int)((got.pixels[i] >> shift) & 0xFF) - (int)((want.pixels[i] >> shift) & 0xFF));
+            if (d > worst) worst = d;
+        }
+    }
+    if (!differing) return;
+    std::fprintf(stderr, "%s, %s: %d pixels differ from scalar (up to %d)\n", what, raster::IsaName(isa),
+                 differing, worst);
+    g_failures++;
+}
+
+// Renders the golden states with the scalar kernels; with `print`, writes
+// the table instead of checking it.
+static int CheckGolden(RampLabels& labels, bool print) {
+    int checked = 0;
+    for (const Golden& g : kGolden) {
+        Image frame(g.width, g.height);
+        Image cover = MakeCover(g.width, g.height);
+        Render(raster::Isa::Scalar, frame, State(g.mode, g.flags), &labels,
+               g.cover ? &cover.surface : nullptr);
+        const uint32_t crc = Crc32(frame);
+        if (print) {
+            std::printf("    {%3d, %3d, %d, %d, %-5s, 0x%08Xu},\n", g.width, g.height, g.mode, g.flags,
+                        g.cover ? "true" : "false", crc);
+        } else if (crc != g.crc) {
+            std::fprintf(stderr, "golden %dx%d mode %d flags %d cover %d: CRC %08X, expected %08X\n",
+                         g.width, g.height, g.mode, g.flags, (int)g.cover, crc, g.crc);
+            g_failures++;
+        }
+        checked++;
+    }
+    return checked;
+}
+
+int main(int argc, char** argv) {
+    RampLabels labels;
+    if (argc > 1 && std::strcmp(argv[1], "--print-golden") == 0) {
+        CheckGolden(labels, true);
+        return 0;
+    }
+    const int golden = CheckGolden(labels, false);
+
+    const raster::Isa best = raster::BestIsa();
+    std::vector<raster::Isa> isas;
+    for (raster::Isa isa : {raster::Isa::SSE2, raster::Isa::AVX2})
+        if (isa <= best) isas.push_back(isa);
+    if (isas.empty()) std::puts("raster_check: only scalar kernels on this CPU");
+
+    static const int kSizes[][2] = {{120, 180}, {61, 203}, {13, 9}, {256, 64}};
+    int frames = 0;
+
+    for (const auto& size : kSizes) {
+        const int width = size[0], height = size[1];
+        Image cover = MakeCover(width, height);
+        Image want(width, height), got(width, height);
+
+        for (ScrollMode mode : {ScrollMode::ClickHold, ScrollMode::SplitHold, ScrollMode::HoverAuto})
+        for (int flags = 0; flags < 8; flags++)
+        for (int withCover = 0; withCover < 2; withCover++) {
+            const ZoneVisualState st = State((int)mode, flags);
+            const Surface* c = withCover ? &cover.surface : nullptr;
+
+            Render(raster::Isa::Scalar, want, st, &labels, c);
+            for (raster::Isa isa : isas) {
+                Render(isa, got, st, &labels, c);
+                char what[96];
+                std::snprintf(what, sizeof(what), "%dx%d mode %d flags %d cover %d", width, height, (int)mode,
+                              flags, withCover);
+                Compare(what, isa, got, want);
+            }
+            frames++;
+        }
+    }
+    raster::SetIsa(best);
+
+    if (g_failures) {
+        std::fprintf(stderr, "raster_check: %d FAILED\n", g_failures);
+        return 1;
+    }
+    std::printf("raster_check: ok (%d golden frames; %d frames, scalar vs %zu kernel sets)\n", golden, frames,
+                isas.size());
+    return 0;
+}
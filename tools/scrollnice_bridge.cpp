@@ -0,0 +1,181 @@
+// scrollnice_bridge — native messaging host for the FeelClick extension
+//
+//   scrollnice_bridge --install <extension-id>   register with Chrome/Edge
+//                                                 (Chromium on Linux) for
+//                                                 this user
+//   scrollnice_bridge --uninstall
+//
+// Otherwise it is being run by the browser: relay the running app's
+// scroll feed over stdin/stdout until the browser closes the port (see
+// src/core/NativeHost.h). Can be driven by hand over pipes too; the
+// browser pid then falls back to the parent process.
+#include "core/NativeHost.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <tlhelp32.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <climits>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace sn;
+
+static const char* kHostName = "com.scrollnice.bridge";
+
+static std::string Manifest(const std::string& exePath, const std::string& extensionId) {
+    nlohmann::json j = {{"name", kHostName},
+                        {"description", "ScrollNice desktop scroll feed"},
+                        {"path", exePath},
+                        {"type", "stdio"},
+                        {"allowed_origins", {"chrome-extension://" + extensionId + "/"}}};
+    return j.dump(2) + "\n";
+}
+
+#ifdef _WIN32
+// ───── Windows ─────
+static const wchar_t* kRegistryKeys[] = {
+    L"Software\\Google\\Chrome\\NativeMessagingHosts\\com.scrollnice.bridge",
+    L"Software\\Microsoft\\Edge\\NativeMessagingHosts\\com.scrollnice.bridge",
+};
+
+static std::wstring ExePathW() {
+    wchar_t path[MAX_PATH];
+    const DWORD n = GetModuleFileNameW(nullptr, path, MAX_PATH);
+    return std::wstring(path, n);
+}
+
+static std::string Utf8(const std::wstring& w) {
+    const int n = WideCharToMultiByte(CP_UTF8, 0, w.c_str(), (int)w.size(), nullptr, 0, nullptr, nullptr);
+    std::string s(n, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, w.c_str(), (int)w.size(), &s[0], n, nullptr, nullptr);
+    return s;
+}
+
+// The manifest sits next to the exe; each browser's registry key
+// points at it
+static bool Install(const std::string& extensionId) {
+    const std::wstring exe = ExePathW();
+    const std::wstring manifest = exe.substr(0, exe.find_last_of(L'\\') + 1) + L"com.scrollnice.bridge.json";
+    std::ofstream f(std::filesystem::path(manifest), std::ios::binary | std::ios::trunc);
+    if (!(f << Manifest(Utf8(exe), extensionId)) || !f.flush()) return false;
+    for (const wchar_t* key : kRegistryKeys) {
+        if (RegSetKeyValueW(HKEY_CURRENT_USER, key, nullptr, REG_SZ, manifest.c_str(),
+                            (DWORD)((manifest.size() + 1) * sizeof(wchar_t))) != ERROR_SUCCESS)
+            return false;
+    }
+    return true;
+}
+
+static bool Uninstall() {
+    for (const wchar_t* key : kRegistryKeys) RegDeleteTreeW(HKEY_CURRENT_USER, key);
+    return true;
+}
+
+static DWORD ParentPid(DWORD pid, std::wstring& exe) {
+    HANDLE snap = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+    if (snap == INVALID_HANDLE_VALUE) return 0;
+    PROCESSENTRY32W e{sizeof(e)};
+    DWORD parent = 0;
+    for (BOOL ok = Process32FirstW(snap, &e); ok; ok = Process32NextW(snap, &e))
+        if (e.th32ProcessID == pid) { parent = e.th32ParentProcessID; break; }
+    exe.clear();
+    if (parent) {
+        for (BOOL ok = Process32FirstW(snap, &e); ok; ok = Process32NextW(snap, &e))
+            if (e.th32ProcessID == parent) { exe = e.szExeFile; break; }
+    }
+    CloseHandle(snap);
+    return parent;
+}
+
+// The pid that owns the browser's windows. Chrome passes its window as
+// --parent-window=<hwnd> (0 when the caller is a service worker, as
+// ours is); otherwise climb past the cmd.exe it launches hosts through.
+static uint32_t BrowserPid(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--parent-window=", 16) != 0) continue;
+        DWORD pid = 0;
+        HWND parent = (HWND)(intptr_t)std::strtoll(argv[i] + 16, nullptr, 10);
+        if (parent && GetWindowThreadProcessId(parent, &pid)) return pid;
+    }
+    std::wstring exe;
+    DWORD pid = ParentPid(GetCurrentProcessId(), exe);
+    while (pid && _wcsicmp(exe.c_str(), L"cmd.exe") == 0) pid = ParentPid(pid, exe);
+    return pid;
+}
+
+static void BinaryStdio() {
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+}
+#else
+// ───── Linux ─────
+static bool WriteText(const std::string& path, const std::string& text) {
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    return f && (f << text) && f.flush();
+}
+
+static std::vector<std::string> ManifestDirs() {
+    const char* home = std::getenv("HOME");
+    const std::string base = std::string(home ? home : "") + "/.config/";
+    return {base + "google-chrome/NativeMessagingHosts", base + "chromium/NativeMessagingHosts"};
+}
+
+static bool Install(const std::string& extensionId) {
+    char exe[PATH_MAX];
+    const ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+    if (n <= 0) return false;
+    exe[n] = '\0';
+    bool any = false;
+    for (const auto& dir : ManifestDirs()) {
+        mkdir(dir.c_str(), 0700);   // the browser's config dir must already exist
+        any |= WriteText(dir + "/" + kHostName + ".json", Manifest(exe, extensionId));
+    }
+    return any;
+}
+
+static bool Uninstall() {
+    for (const auto& dir : ManifestDirs()) std::remove((dir + "/" + kHostName + ".json").c_str());
+    return true;
+}
+
+// Chrome runs hosts directly
+static uint32_t BrowserPid(int, char**) { return (uint32_t)getppid(); }
+
+static void BinaryStdio() {}
+#endif
+
+int main(int argc, char** argv) {
+    if (argc >= 2 && std::strcmp(argv[1], "--install") == 0) {
+        if (argc != 3 || !*argv[2]) {
+            std::fprintf(stderr, "usage: scrollnice_bridge --install <extension-id>\n");
+            return 2;
+        }
+        if (!Install(argv[2])) {
+            std::fprintf(stderr, "scrollnice_bridge: could not register the host\n");
+            return 1;
+        }
+        return 0;
+    }
+    if (argc >= 2 && std::strcmp(argv[1], "--uninstall") == 0) return Uninstall() ? 0 : 1;
+
+    BinaryStdio();
+    NativeHost host(stdin, stdout, BrowserPid(argc, argv), []() -> std::unique_ptr<CommandClient> {
+        auto client = CreateCommandClient();
+        if (!client->Connect()) return nullptr;
+        return client;
+    });
+    host.Run();
+    return 0;
+}
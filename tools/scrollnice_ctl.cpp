@@ -0,0 +1,129 @@
+// scrollnice_ctl — drive a running ScrollNice over its command channel
+//
+//   scrollnice_ctl <command> [args]
+//   scrollnice_ctl -                  one command per line from stdin,
+//                                     over a single connection
+//
+// Commands:
+//   scroll <px>                       one step; + up, - down
+//   start up|down [speed]             continuous scroll (speed 0 = hover speed)
+//   stop
+//   profile <id>|auto                 pin a profile / follow the foreground app
+//   enabled|edit|wheel-block on|off|toggle
+//   state
+//
+// Exit status: 0 if every command was accepted, 1 if one was refused,
+// 2 on usage errors or if ScrollNice isn't running.
+#include "core/CommandChannel.h"
+#include "core/StateMachine.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sn;
+
+static bool ParseSwitchValue(const std::string& s, uint8_t& value) {
+    if (s == "off")    { value = 0; return true; }
+    if (s == "on")     { value = 1; return true; }
+    if (s == "toggle") { value = 2; return true; }
+    return false;
+}
+
+static bool ParseCommand(const std::vector<std::string>& args, Command& cmd) {
+    if (args.empty()) return false;
+    const std::string& verb = args[0];
+    if (verb == "scroll" && args.size() == 2) {
+        cmd.op     = CommandOp::ScrollBy;
+        cmd.pixels = (int32_t)std::strtol(args[1].c_str(), nullptr, 10);
+        return cmd.pixels != 0;
+    }
+    if (verb == "start" && (args.size() == 2 || args.size() == 3) &&
+        (args[1] == "up" || args[1] == "down")) {
+        cmd.op        = CommandOp::StartScroll;
+        cmd.direction = args[1] == "up" ? 1 : -1;
+        cmd.speed     = args.size() == 3 ? (uint16_t)std::strtoul(args[2].c_str(), nullptr, 10) : 0;
+        return true;
+    }
+    if (verb == "stop" && args.size() == 1) {
+        cmd.op = CommandOp::StopScroll;
+        return true;
+    }
+    if (verb == "profile" && args.size() == 2) {
+        cmd.op      = CommandOp::SetProfile;
+        cmd.profile = args[1] == "auto" ? "" : args[1];
+        return true;
+    }
+    if ((verb == "enabled" || verb == "edit" || verb == "wheel-block") && args.size() == 2) {
+        cmd.op     = CommandOp::Set;
+        cmd.target = verb == "enabled" ? CommandSwitch::Enabled
+                   : verb == "edit"    ? CommandSwitch::Edit
+                                       : CommandSwitch::WheelBlock;
+        return ParseSwitchValue(args[1], cmd.value);
+    }
+    if (verb == "state" && args.size() == 1) {
+        cmd.op = CommandOp::QueryState;
+        return true;
+    }
+    return false;
+}
+
+static void PrintState(const CommandReply& r) {
+    std::printf("enabled %s\nediting %s\nwheel_block %s\nauto_profile %s\nstate %s\nprofile %s\nmode %s\n",
+                r.flags & kStateEnabled ? "on" : "off", r.flags & kStateEditing ? "on" : "off",
+                r.flags & kStateWheelBlock ? "on" : "off", r.flags & kStateAutoProfile ? "on" : "off",
+                StateMachine::StateName((AppState)r.state),
+                r.profile.empty() ? "(base)" : r.profile.c_str(), r.mode.c_str());
+    std::printf("scroll_amount %u\ncontinuous_speed %u\ncontinuous_accel %u\nhover_speed %u\n",
+                r.scroll_amount, r.continuous_speed, r.continuous_accel, r.hover_speed);
+}
+
+// 0 accepted, 1 refused, 2 usage / connection error
+static int Run(CommandClient& client, const std::vector<std::string>& args) {
+    Command cmd;
+    if (!ParseCommand(args, cmd)) {
+        std::fprintf(stderr, "scrollnice_ctl: bad command (see the top of tools/scrollnice_ctl.cpp)\n");
+        return 2;
+    }
+    CommandReply reply;
+    if (!client.Call(cmd, reply)) {
+        std::fprintf(stderr, "scrollnice_ctl: connection lost\n");
+        return 2;
+    }
+    if (reply.status != CommandStatus::Ok) {
+        std::fprintf(stderr, "scrollnice_ctl: %s: %s\n", args[0].c_str(), CommandStatusName(reply.status));
+        return 1;
+    }
+    if (cmd.op == CommandOp::QueryState) PrintState(reply);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: scrollnice_ctl <command> [args] | scrollnice_ctl -\n");
+        return 2;
+    }
+    auto client = CreateCommandClient();
+    if (!client->Connect()) {
+        std::fprintf(stderr, "scrollnice_ctl: ScrollNice is not running\n");
+        return 2;
+    }
+
+    if (std::string(argv[1]) != "-") return Run(*client, std::vector<std::string>(argv + 1, argv + argc));
+
+    int status = 0;
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream words(line);
+        std::vector<std::string> args;
+        for (std::string w; words >> w;) args.push_back(w);
+        if (args.empty() || args[0][0] == '#') continue;
+        const int r = Run(*client, args);
+        if (r == 2) return 2;
+        if (r) status = 1;
+        std::fflush(stdout);
+    }
+    return status;
+}
@@ -0,0 +1,69 @@
+// Loopback check of the uinput wheel (src/platform/linux/LinuxUinput.h):
+// creates the virtual device, reads its own event node back and checks
+// that each Flush() arrives as one frame carrying the expected hi-res
+// and notch totals. Needs write access to /dev/uinput and read access
+// to /dev/input. Exit code 0 = pass.
+#include "platform/linux/LinuxUinput.h"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+struct Totals {
+    int hiY = 0, hiX = 0, notchY = 0, notchX = 0, frames = 0;
+};
+
+// Everything readable within `ms`
+static Totals Drain(int fd, int ms) {
+    Totals t;
+    pollfd p{fd, POLLIN, 0};
+    while (poll(&p, 1, ms) > 0) {
+        input_event evs[64];
+        const ssize_t n = read(fd, evs, sizeof(evs));
+        if (n <= 0) break;
+        for (ssize_t i = 0; i < n / (ssize_t)sizeof(input_event); i++) {
+            const input_event& ev = evs[i];
+            if (ev.type == EV_SYN && ev.code == SYN_REPORT) t.frames++;
+            if (ev.type != EV_REL) continue;
+            if (ev.code == REL_WHEEL_HI_RES)  t.hiY    += ev.value;
+            if (ev.code == REL_HWHEEL_HI_RES) t.hiX    += ev.value;
+            if (ev.code == REL_WHEEL)         t.notchY += ev.value;
+            if (ev.code == REL_HWHEEL)        t.notchX += ev.value;
+        }
+    }
+    return t;
+}
+
+int main() {
+    sn::UinputDevice dev;
+    if (!dev.Open("ScrollNice uinput check")) {
+        std::fprintf(stderr, "uinput_check: can't create a uinput device\n");
+        return 2;
+    }
+    // udev creates the node a moment after UI_DEV_CREATE
+    std::string node;
+    int fd = -1;
+    for (int i = 0; i < 50 && fd < 0; i++) {
+        node = dev.EventNode();
+        if (!node.empty()) fd = open(node.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    if (fd < 0) {
+        std::fprintf(stderr, "uinput_check: can't read the device's event node (%s)\n", node.c_str());
+        return 2;
+    }
+
+    // 60 ticks of 5 px down, 10 px right: -360 and 720 units, 3 and 6 notches
+    for (int i = 0; i < 60; i++) {
+        dev.Scroll(-5.0, 10.0);
+        dev.Flush();
+    }
+    const Totals t = Drain(fd, 200);
+    std::printf("frames %d, hi-res %d/%d, notches %d/%d\n", t.frames, t.hiY, t.hiX, t.notchY, t.notchX);
+    const bool ok = t.frames == 60 && t.hiY == -360 && t.hiX == 720 && t.notchY == -3 && t.notchX == 6;
+    close(fd);
+    std::puts(ok ? "uinput_check: ok" : "uinput_check: FAILED");
+    return ok ? 0 : 1;
+}